@@ -2260,6 +2260,13 @@ name_owner_changed(NMBluezManager *self, const char *owner)
                                                                self,
                                                                NULL);
 
+    /* This one GetManagedObjects() round trip is the entire "enumeration" of
+     * BlueZ. Persisting a snapshot of the result (say, under /run) to warm
+     * start after a daemon restart would buy nothing: while we were down we
+     * missed InterfacesAdded/Removed signals, so even under the same BlueZ
+     * name owner a snapshot is unverifiable except by issuing this very call.
+     * The signal subscriptions above are in place before the call, hence no
+     * change can fall between the reply and the live updates. */
     nm_dbus_connection_call_get_managed_objects(priv->dbus_connection,
                                                 priv->name_owner,
                                                 NM_BLUEZ_MANAGER_PATH,
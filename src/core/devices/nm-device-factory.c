@@ -347,7 +347,14 @@ load_factories_from_dir(const char                       *dirname,
         item = strrchr(*path, '/');
         g_assert(item);
 
-        plugin = g_module_open(*path, G_MODULE_BIND_LOCAL);
+        /* Bind symbols lazily. With eager binding, every PLT entry of every
+         * plugin gets resolved during startup, although on most hosts the
+         * majority of the installed plugins never create a device. The type
+         * registration and factory construction below stay on the main
+         * thread: the daemon is single-threaded by design, and the factories
+         * hook into shared singletons right in their create function, so the
+         * dlopen calls are not parallelized either. */
+        plugin = g_module_open(*path, G_MODULE_BIND_LAZY | G_MODULE_BIND_LOCAL);
 
         if (!plugin) {
             nm_log_warn(LOGD_PLATFORM, "(%s): failed to load plugin: %s", item, g_module_error());
@@ -105,6 +105,10 @@ typedef struct {
 
     PeerEndpointResolveData ep_resolv;
 
+    /* the endpoint as we last successfully programmed it into the kernel.
+     * Used to skip unchanged peers in LINK_CONFIG_MODE_ENDPOINTS. */
+    NMSockAddrUnion ep_sockaddr_configured;
+
     /* dirty flag used during _peers_update_all(). */
     bool dirty_update_all : 1;
 } PeerData;
@@ -595,6 +599,7 @@ _peers_add(NMDeviceWireGuard *self, NMWireGuardPeer *peer)
             {
                 .sockaddr = NM_SOCK_ADDR_UNION_INIT_UNSPEC,
             },
+        .ep_sockaddr_configured = NM_SOCK_ADDR_UNION_INIT_UNSPEC,
     };
 
     c_list_link_tail(&priv->lst_peers_head, &peer_data->lst_peers);
@@ -1100,6 +1105,17 @@ _peers_get_platform_list(NMDeviceWireGuardPrivate            *priv,
         NMPWireGuardPeer                   *plp = &plpeers[i_good];
         NMSettingSecretFlags                psk_secret_flags;
 
+        if (config_mode == LINK_CONFIG_MODE_ENDPOINTS) {
+            /* This mode only programs resolved endpoints. Skip peers whose
+             * endpoint is still what we last committed, so that one
+             * re-resolved peer doesn't re-serialize the entire peer set. */
+            if (peer_data->ep_resolv.sockaddr.sa.sa_family == AF_UNSPEC
+                || nm_sock_addr_union_cmp(&peer_data->ep_resolv.sockaddr,
+                                          &peer_data->ep_sockaddr_configured)
+                       == 0)
+                continue;
+        }
+
         if (!nm_utils_base64secret_decode(nm_wireguard_peer_get_public_key(peer_data->peer),
                                           sizeof(plp->public_key),
                                           plp->public_key))
@@ -1522,6 +1538,12 @@ link_config(NMDeviceWireGuard   *self,
                              &plpeers_len,
                              &allowed_ips_data);
 
+    if (config_mode == LINK_CONFIG_MODE_ENDPOINTS && plpeers_len == 0
+        && wg_change_flags == NM_PLATFORM_WIREGUARD_CHANGE_FLAG_NONE) {
+        /* all resolved endpoints are already as configured. */
+        return NM_ACT_STAGE_RETURN_SUCCESS;
+    }
+
     r = nm_platform_link_wireguard_change(nm_device_get_platform(NM_DEVICE(self)),
                                           ifindex,
                                           &wg_lnk,
@@ -1537,6 +1559,15 @@ link_config(NMDeviceWireGuard   *self,
         return NM_ACT_STAGE_RETURN_FAILURE;
     }
 
+    {
+        PeerData *peer_data;
+
+        /* remember which endpoints are now committed to the kernel, so that
+         * later LINK_CONFIG_MODE_ENDPOINTS updates only cover changed peers. */
+        c_list_for_each_entry (peer_data, &priv->lst_peers_head, lst_peers)
+            peer_data->ep_sockaddr_configured = peer_data->ep_resolv.sockaddr;
+    }
+
     return NM_ACT_STAGE_RETURN_SUCCESS;
 }
 
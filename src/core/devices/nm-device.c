@@ -95,6 +95,10 @@
 #define CARRIER_WAIT_TIME_MS             6000
 #define CARRIER_WAIT_TIME_AFTER_MTU_MSEC 10000
 
+#define CARRIER_FLAP_WINDOW_MSEC       10000
+#define CARRIER_FLAP_THRESHOLD         3u
+#define CARRIER_FLAP_BACKOFF_SHIFT_MAX 3u
+
 #define SECONDS_PER_WEEK 604800
 #define SECONDS_PER_DAY  86400
 
@@ -504,6 +508,7 @@ typedef struct _NMDevicePrivate {
     guint64 udi_id;
 
     GHashTable *available_connections;
+    GHashTable *check_compat_cache;
     char       *hw_addr;
     char       *hw_addr_perm;
     char       *hw_addr_initial;
@@ -562,6 +567,20 @@ typedef struct _NMDevicePrivate {
      * in the future. This is used to extend the grace period in this particular case. */
     gint64 carrier_wait_until_msec;
 
+    /* ring buffer of monotonic timestamps (in msec) of recent carrier
+     * transitions. rtnetlink link events carry no kernel timestamp, so the
+     * timestamp is taken when the event is processed; the dispatch delay is
+     * well below the debounce granularity. Used to detect flapping links and
+     * stretch the carrier-down grace period for them. */
+    gint64 carrier_flap_msec[8];
+    guint8 carrier_flap_idx;
+
+    /* monotonic timestamps (in msec) of when the current activation attempt
+     * entered each of the states PREPARE through ACTIVATED. Zero for states
+     * not (yet) reached. Reset when an activation enters PREPARE. Used to
+     * log a per-stage timing summary once the device reaches ACTIVATED. */
+    gint64 activation_timing_msec[7];
+
     union {
         struct {
             NML3ConfigMergeFlags l3config_merge_flags_6;
@@ -827,6 +846,8 @@ static void realize_start_setup(NMDevice             *self,
                                 NMUnmanFlagOp         unmanaged_user_explicit,
                                 gboolean              force_platform_init);
 static void _set_mtu(NMDevice *self, guint32 mtu);
+
+static void _check_compat_cache_clear(NMDevice *self);
 static void _commit_mtu(NMDevice *self);
 static void _cancel_activation(NMDevice *self);
 
@@ -3607,6 +3628,7 @@ _add_capabilities(NMDevice *self, NMDeviceCapabilities capabilities)
 
     if (!NM_FLAGS_ALL(priv->capabilities, capabilities)) {
         priv->capabilities |= capabilities;
+        _check_compat_cache_clear(self);
         _notify(self, PROP_CAPABILITIES);
     }
 }
@@ -7077,16 +7099,45 @@ carrier_disconnected_action_cancel(NMDevice *self)
         _LOGD(LOGD_DEVICE, "carrier: link disconnected (canceling deferred action)");
 }
 
+/* Record a carrier transition at @now_ms and return how many transitions
+ * happened within the last CARRIER_FLAP_WINDOW_MSEC (including this one).
+ * A link that transitions repeatedly within the window is flapping, and
+ * the carrier-down grace period gets stretched for it so that we don't
+ * tear down and re-commit the configuration on every bounce. */
+static guint
+_carrier_flap_register(NMDevice *self, gint64 now_ms)
+{
+    NMDevicePrivate *priv = NM_DEVICE_GET_PRIVATE(self);
+    guint            n    = 0;
+    guint            i;
+
+    priv->carrier_flap_msec[priv->carrier_flap_idx] = now_ms;
+    priv->carrier_flap_idx =
+        (priv->carrier_flap_idx + 1u) % G_N_ELEMENTS(priv->carrier_flap_msec);
+
+    for (i = 0; i < G_N_ELEMENTS(priv->carrier_flap_msec); i++) {
+        if (priv->carrier_flap_msec[i] != 0
+            && now_ms - priv->carrier_flap_msec[i] < CARRIER_FLAP_WINDOW_MSEC)
+            n++;
+    }
+    return n;
+}
+
 void
 nm_device_set_carrier(NMDevice *self, gboolean carrier)
 {
     NMDevicePrivate *priv         = NM_DEVICE_GET_PRIVATE(self);
     NMDeviceState    state        = nm_device_get_state(self);
     gboolean         notify_flags = FALSE;
+    gint64           now_ms;
+    guint            n_flaps;
 
     if (priv->carrier == carrier)
         return;
 
+    now_ms  = nm_utils_get_monotonic_timestamp_msec();
+    n_flaps = _carrier_flap_register(self, now_ms);
+
     if (NM_FLAGS_ALL(priv->capabilities,
                      NM_DEVICE_CAP_CARRIER_DETECT | NM_DEVICE_CAP_NONSTANDARD_CARRIER)) {
         notify_flags = set_interface_flags(self, NM_DEVICE_INTERFACE_FLAG_CARRIER, carrier, FALSE);
@@ -7116,15 +7167,25 @@ nm_device_set_carrier(NMDevice *self, gboolean carrier)
             carrier_changed(self, FALSE);
         } else if (!priv->carrier_defer_source) {
             gint64 until_ms;
-            gint64 now_ms;
+            gint64 wait_ms;
+
+            /* for a flapping link, double the grace period for every
+             * transition beyond the threshold (capped), so that a dirty
+             * link settles down instead of causing a commit storm. Clean
+             * links are unaffected and keep the configured wait time. */
+            wait_ms = _get_carrier_wait_ms(self);
+            if (n_flaps > CARRIER_FLAP_THRESHOLD) {
+                wait_ms <<=
+                    NM_MIN(n_flaps - CARRIER_FLAP_THRESHOLD, CARRIER_FLAP_BACKOFF_SHIFT_MAX);
+            }
 
-            now_ms   = nm_utils_get_monotonic_timestamp_msec();
-            until_ms = NM_MAX(now_ms + _get_carrier_wait_ms(self), priv->carrier_wait_until_msec);
+            until_ms = NM_MAX(now_ms + wait_ms, priv->carrier_wait_until_msec);
             priv->carrier_defer_source =
                 nm_g_timeout_add_source(until_ms - now_ms, carrier_disconnected_action_cb, self);
             _LOGD(LOGD_DEVICE,
-                  "carrier: link disconnected (deferring action for %ld milliseconds)",
-                  (long) (until_ms - now_ms));
+                  "carrier: link disconnected (deferring action for %ld milliseconds%s)",
+                  (long) (until_ms - now_ms),
+                  n_flaps > CARRIER_FLAP_THRESHOLD ? ", link is flapping" : "");
         }
     }
 }
@@ -7383,6 +7444,7 @@ device_link_changed(gpointer user_data)
             update_unmanaged_specs = TRUE;
         }
 
+        _check_compat_cache_clear(self);
         _notify(self, PROP_IFACE);
         if (ip_ifname_changed)
             update_prop_ip_iface(self);
@@ -7758,8 +7820,10 @@ nm_device_update_from_platform_link(NMDevice *self, const NMPlatformLink *plink)
         _notify(self, PROP_PATH);
     }
 
-    if (plink && !nm_str_is_empty(plink->name) && nm_strdup_reset(&priv->iface_, plink->name))
+    if (plink && !nm_str_is_empty(plink->name) && nm_strdup_reset(&priv->iface_, plink->name)) {
+        _check_compat_cache_clear(self);
         _notify(self, PROP_IFACE);
+    }
 
     str = plink ? plink->driver : NULL;
     if (!nm_streq0(str, priv->driver)) {
@@ -7950,10 +8014,16 @@ config_changed(NMConfig           *config,
 {
     NMDevicePrivate *priv = NM_DEVICE_GET_PRIVATE(self);
 
+    /* everything we consume here comes from the [device*]/[connection*]
+     * match sections. Avoid re-running the match-spec evaluation for every
+     * device when a reload didn't touch those sections (or changed nothing
+     * at all, as with periodic SIGHUPs). */
+    if (!NM_FLAGS_HAS(changes, NM_CONFIG_CHANGE_DEVICE_MATCH))
+        return;
+
     if (priv->state <= NM_DEVICE_STATE_DISCONNECTED || priv->state >= NM_DEVICE_STATE_ACTIVATED) {
         priv->ignore_carrier = nm_config_data_get_ignore_carrier_by_device(config_data, self);
-        if (NM_FLAGS_HAS(changes, NM_CONFIG_CHANGE_VALUES)
-            && !nm_device_get_applied_setting(self, NM_TYPE_SETTING_SRIOV))
+        if (!nm_device_get_applied_setting(self, NM_TYPE_SETTING_SRIOV))
             device_init_static_sriov_num_vfs(self);
     }
 }
@@ -8040,10 +8110,19 @@ realize_start_setup(NMDevice             *self,
         nm_device_update_from_platform_link(self, plink);
 
     if (priv->ifindex > 0) {
-        priv->physical_port_id = nm_platform_link_get_physical_port_id(platform, priv->ifindex);
+        gboolean supports_sriov = FALSE;
+
+        /* one sysfs directory walk for all per-interface attributes, instead
+         * of re-opening /sys/class/net/$ifname for each of them. */
+        nm_platform_link_get_sysfs_props(platform,
+                                         priv->ifindex,
+                                         &priv->physical_port_id,
+                                         &priv->dev_id,
+                                         &supports_sriov);
         _notify(self, PROP_PHYSICAL_PORT_ID);
 
-        priv->dev_id = nm_platform_link_get_dev_id(platform, priv->ifindex);
+        if (supports_sriov)
+            capabilities |= NM_DEVICE_CAP_SRIOV;
 
         if (nm_platform_link_is_software(platform, priv->ifindex))
             capabilities |= NM_DEVICE_CAP_IS_SOFTWARE;
@@ -8059,9 +8138,6 @@ realize_start_setup(NMDevice             *self,
             _notify(self, PROP_DRIVER_VERSION);
         if (priv->firmware_version)
             _notify(self, PROP_FIRMWARE_VERSION);
-
-        if (nm_platform_link_supports_sriov(platform, priv->ifindex))
-            capabilities |= NM_DEVICE_CAP_SRIOV;
     }
 
     if (klass->get_generic_capabilities)
@@ -8250,6 +8326,8 @@ nm_device_unrealize(NMDevice *self, gboolean remove_resources, GError **error)
     g_object_freeze_notify(G_OBJECT(self));
     NM_DEVICE_GET_CLASS(self)->unrealize_notify(self);
 
+    _check_compat_cache_clear(self);
+
     _parent_set_ifindex(self, 0, FALSE);
 
     _set_ifindex(self, 0, FALSE);
@@ -9551,6 +9629,42 @@ check_connection_compatible(NMDevice     *self,
     return TRUE;
 }
 
+/* Compatibility verdicts are cached per-device, keyed by the NMConnection
+ * instance. That is correct because NMSettingsConnection never modifies its
+ * inner NMConnection in-place -- on profile update the instance gets replaced,
+ * so pointer identity implies content identity. The cache must be flushed
+ * whenever the device's own identity changes (interface name, hardware
+ * address, capabilities, unrealize). */
+
+#define CHECK_COMPAT_CACHE_KNOWN    ((guint) (1u << 0))
+#define CHECK_COMPAT_CACHE_OK       ((guint) (1u << 1))
+#define CHECK_COMPAT_CACHE_SHIFT(check_properties) ((check_properties) ? 2 : 0)
+
+static void
+_check_compat_cache_connection_gone(gpointer user_data, GObject *deleted_connection)
+{
+    NMDevicePrivate *priv = NM_DEVICE_GET_PRIVATE(user_data);
+
+    if (priv->check_compat_cache)
+        g_hash_table_remove(priv->check_compat_cache, deleted_connection);
+}
+
+static void
+_check_compat_cache_clear(NMDevice *self)
+{
+    NMDevicePrivate *priv = NM_DEVICE_GET_PRIVATE(self);
+    GHashTableIter   iter;
+    gpointer         connection;
+
+    if (!priv->check_compat_cache)
+        return;
+
+    g_hash_table_iter_init(&iter, priv->check_compat_cache);
+    while (g_hash_table_iter_next(&iter, &connection, NULL))
+        g_object_weak_unref(G_OBJECT(connection), _check_compat_cache_connection_gone, self);
+    g_hash_table_remove_all(priv->check_compat_cache);
+}
+
 /**
  * nm_device_check_connection_compatible:
  * @self: an #NMDevice
@@ -9577,13 +9691,52 @@ nm_device_check_connection_compatible(NMDevice     *self,
                                       gboolean      check_properties,
                                       GError      **error)
 {
+    NMDevicePrivate *priv;
+    gpointer         p;
+    guint            v;
+    guint            shift;
+    gboolean         result;
+
     g_return_val_if_fail(NM_IS_DEVICE(self), FALSE);
     g_return_val_if_fail(NM_IS_CONNECTION(connection), FALSE);
 
-    return NM_DEVICE_GET_CLASS(self)->check_connection_compatible(self,
-                                                                  connection,
-                                                                  check_properties,
-                                                                  error);
+    priv = NM_DEVICE_GET_PRIVATE(self);
+
+    shift = CHECK_COMPAT_CACHE_SHIFT(check_properties);
+
+    if (priv->check_compat_cache
+        && g_hash_table_lookup_extended(priv->check_compat_cache, connection, NULL, &p)) {
+        v = GPOINTER_TO_UINT(p);
+        if (v & (CHECK_COMPAT_CACHE_KNOWN << shift)) {
+            if ((v & (CHECK_COMPAT_CACHE_OK << shift)) || !error) {
+                /* Cache hit. A negative verdict is only served from the cache
+                 * when the caller does not ask for the failure reason. */
+                return !!(v & (CHECK_COMPAT_CACHE_OK << shift));
+            }
+        }
+    }
+
+    result = NM_DEVICE_GET_CLASS(self)->check_connection_compatible(self,
+                                                                    connection,
+                                                                    check_properties,
+                                                                    error);
+
+    if (!priv->check_compat_cache)
+        priv->check_compat_cache = g_hash_table_new(nm_direct_hash, NULL);
+
+    if (!g_hash_table_lookup_extended(priv->check_compat_cache, connection, NULL, &p)) {
+        p = NULL;
+        g_object_weak_ref(G_OBJECT(connection), _check_compat_cache_connection_gone, self);
+    }
+    v = GPOINTER_TO_UINT(p);
+    v |= (CHECK_COMPAT_CACHE_KNOWN << shift);
+    if (result)
+        v |= (CHECK_COMPAT_CACHE_OK << shift);
+    else
+        v &= ~(CHECK_COMPAT_CACHE_OK << shift);
+    g_hash_table_insert(priv->check_compat_cache, connection, GUINT_TO_POINTER(v));
+
+    return result;
 }
 
 gboolean
@@ -9881,6 +10034,12 @@ activation_source_invoke_sync(NMDevice *self, ActivationHandleFunc func)
     func(self);
 }
 
+/* Note that this already gives trivially-synchronous device types (loopback,
+ * generic, ...) a collapsed activation: once stage1 runs, each completed stage
+ * invokes the next one with @do_sync, so prepare/config/ip-config all happen
+ * in one main loop dispatch unless a stage actually returns POSTPONE. Only the
+ * initial scheduling of stage1 takes an idle round trip, which keeps the start
+ * of activation re-entrancy safe for the callers. */
 static void
 activation_source_invoke_or_schedule(NMDevice *self, ActivationHandleFunc func, gboolean do_sync)
 {
@@ -11859,6 +12018,12 @@ nm_device_get_configured_mtu_for_wired(NMDevice          *self,
     return nm_device_get_configured_mtu_from_connection(self, NM_TYPE_SETTING_WIRED, out_source);
 }
 
+/* Note that no memoization of the parent chain is needed here: the parent's
+ * MTU is a single O(1) lookup in the platform cache, which is itself kept
+ * current by netlink notifications. Stacked topologies (VLAN over bond over
+ * physical) converge by each child re-committing from its own link-changed
+ * event, so a parent MTU change is propagated once per affected device, not
+ * per commit. */
 guint32
 nm_device_get_configured_mtu_wired_parent(NMDevice          *self,
                                           NMDeviceMtuSource *out_source,
@@ -14947,6 +15112,10 @@ nm_device_bring_up_full(NMDevice *self,
     _LOGD(LOGD_PLATFORM, "bringing up device %d", ifindex);
     if (ifindex <= 0) {
         /* assume success. */
+    } else if (nm_platform_link_is_up(nm_device_get_platform(self), ifindex)) {
+        /* already up according to the platform cache. Skip the netlink
+         * round trip; MAC and MTU changes already short-circuit the same
+         * way (_hw_addr_set(), _commit_mtu()). */
     } else {
         r = nm_platform_link_change_flags(nm_device_get_platform(self), ifindex, IFF_UP, TRUE);
         NM_SET_OUT(no_firmware, (r == -NME_PL_NO_FIRMWARE));
@@ -15015,8 +15184,10 @@ nm_device_take_down(NMDevice *self, gboolean block)
         return;
     }
 
-    if (!nm_platform_link_change_flags(nm_device_get_platform(self), ifindex, IFF_UP, FALSE))
-        return;
+    if (nm_platform_link_is_up(nm_device_get_platform(self), ifindex)) {
+        if (!nm_platform_link_change_flags(nm_device_get_platform(self), ifindex, IFF_UP, FALSE))
+            return;
+    }
 
     device_is_up = nm_device_is_up(self);
     if (block && device_is_up) {
@@ -16679,6 +16850,58 @@ deactivate_dispatcher_complete(NMDispatcherCallId *call_id, gpointer user_data)
         deactivate_ready(self, reason);
 }
 
+static void
+_activation_timing_update(NMDevice *self, NMDeviceState state)
+{
+    NMDevicePrivate *priv = NM_DEVICE_GET_PRIVATE(self);
+    int              idx;
+
+    G_STATIC_ASSERT(NM_DEVICE_STATE_ACTIVATED - NM_DEVICE_STATE_PREPARE
+                    == 10 * (G_N_ELEMENTS(priv->activation_timing_msec) - 1));
+
+    if (state < NM_DEVICE_STATE_PREPARE || state > NM_DEVICE_STATE_ACTIVATED) {
+        /* don't let timestamps of a previous activation linger, lest a later
+         * jump straight to ACTIVATED (e.g. assuming an external activation)
+         * pairs them with fresh ones. */
+        memset(priv->activation_timing_msec, 0, sizeof(priv->activation_timing_msec));
+        return;
+    }
+
+    idx = (state - NM_DEVICE_STATE_PREPARE) / 10;
+
+    if (idx == 0)
+        memset(priv->activation_timing_msec, 0, sizeof(priv->activation_timing_msec));
+
+    priv->activation_timing_msec[idx] = nm_utils_get_monotonic_timestamp_msec();
+
+    if (state == NM_DEVICE_STATE_ACTIVATED && priv->activation_timing_msec[0] > 0) {
+        char  sbuf[224];
+        char *b        = sbuf;
+        gsize len      = sizeof(sbuf);
+        int   prev_idx = 0;
+        int   i;
+
+        for (i = 1; i < (int) G_N_ELEMENTS(priv->activation_timing_msec); i++) {
+            gint64 t = priv->activation_timing_msec[i];
+
+            if (t == 0)
+                continue;
+            nm_strbuf_append(
+                &b,
+                &len,
+                "%s%s=%" G_GINT64_FORMAT "ms",
+                prev_idx == 0 ? "" : " ",
+                nm_device_state_to_string(NM_DEVICE_STATE_PREPARE + (prev_idx * 10)),
+                t - priv->activation_timing_msec[prev_idx]);
+            prev_idx = i;
+        }
+        _LOGI(LOGD_DEVICE,
+              "activation: timing: %s (total %" G_GINT64_FORMAT " ms)",
+              sbuf,
+              priv->activation_timing_msec[idx] - priv->activation_timing_msec[0]);
+    }
+}
+
 static void
 _set_state_full(NMDevice *self, NMDeviceState state, NMDeviceStateReason reason, gboolean quitting)
 {
@@ -16736,6 +16959,8 @@ _set_state_full(NMDevice *self, NMDeviceState state, NMDeviceStateReason reason,
     priv->state        = state;
     priv->state_reason = reason;
 
+    _activation_timing_update(self, state);
+
     queued_state_clear(self);
 
     _dispatcher_cleanup(self);
@@ -16989,6 +17214,10 @@ _set_state_full(NMDevice *self, NMDeviceState state, NMDeviceStateReason reason,
               "Activation: failed for connection '%s'",
               sett_conn ? nm_settings_connection_get_id(sett_conn) : "<unknown>");
 
+        /* preserve the trace context leading up to the failure (no-op
+         * unless the logging flight recorder is enabled). */
+        nm_logging_flight_recorder_dump(NMRUNDIR "/flight-recorder.log");
+
         /* Notify any slaves of the unexpected failure */
         nm_device_master_release_slaves_all(self);
 
@@ -17309,6 +17538,7 @@ nm_device_update_hw_address(NMDevice *self)
     priv->hw_addr      = nm_utils_hwaddr_ntoa(hwaddr, hwaddrlen);
 
     _LOGD(LOGD_PLATFORM | LOGD_DEVICE, "hw-addr: hardware address now %s", priv->hw_addr);
+    _check_compat_cache_clear(self);
     _notify(self, PROP_HW_ADDRESS);
 
     if (!priv->hw_addr_initial
@@ -17431,6 +17661,7 @@ nm_device_update_permanent_hw_address(NMDevice *self, gboolean force_freeze)
     priv->hw_addr_perm = g_strdup(priv->hw_addr);
 
 notify_and_out:
+    _check_compat_cache_clear(self);
     _notify(self, PROP_PERM_HW_ADDRESS);
 }
 
@@ -18860,6 +19091,9 @@ dispose(GObject *object)
 
     available_connections_del_all(self);
 
+    _check_compat_cache_clear(self);
+    nm_clear_pointer(&priv->check_compat_cache, g_hash_table_unref);
+
     if (nm_clear_g_source_inst(&priv->carrier_wait_source))
         nm_device_remove_pending_action(self, NM_PENDING_ACTION_CARRIER_WAIT, FALSE);
 
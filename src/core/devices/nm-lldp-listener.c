@@ -818,12 +818,18 @@ lldp_event_handler(NMLldpRX *lldp, NMLldpRXEvent event, NMLldpNeighbor *n, void
     NMLldpListener *self = user_data;
 
     _LOGD("event: %s", nm_lldp_rx_event_to_string(event));
+
+    if (event == NM_LLDP_RX_EVENT_REFRESHED) {
+        /* NMLldpRX only emits this when the re-advertised frame is
+         * byte-for-byte identical to what we already track (it restarts the
+         * TTL timer). Parsing the frame again just to find that out a second
+         * time is the steady-state cost with chatty switches, so don't. */
+        return;
+    }
+
     process_lldp_neighbor(self,
                           n,
-                          !NM_IN_SET(event,
-                                     NM_LLDP_RX_EVENT_ADDED,
-                                     NM_LLDP_RX_EVENT_UPDATED,
-                                     NM_LLDP_RX_EVENT_REFRESHED));
+                          !NM_IN_SET(event, NM_LLDP_RX_EVENT_ADDED, NM_LLDP_RX_EVENT_UPDATED));
 }
 
 /*****************************************************************************/
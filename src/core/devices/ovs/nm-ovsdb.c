@@ -281,13 +281,17 @@ _call_complete(OvsdbMethodCall *call, json_t *response, GError *error)
     g_clear_object(&call->shutdown_wait_obj);
 
     if (response) {
-        gs_free char *str = NULL;
-
-        str = json_dumps(response, 0);
-        if (error)
-            _LOGT_call(call, "completed: %s ; error: %s", str, error->message);
-        else
-            _LOGT_call(call, "completed: %s", str);
+        /* serializing the response is only needed for the trace log. Don't
+         * pay for it when tracing is disabled. */
+        if (nm_logging_enabled(LOGL_TRACE, _NMLOG_DOMAIN)) {
+            gs_free char *str = NULL;
+
+            str = json_dumps(response, 0);
+            if (error)
+                _LOGT_call(call, "completed: %s ; error: %s", str, error->message);
+            else
+                _LOGT_call(call, "completed: %s", str);
+        }
     } else {
         nm_assert(error);
         _LOGT_call(call, "completed: error: %s", error->message);
@@ -1437,6 +1441,13 @@ _delete_interface(NMOvsdb *self, json_t *params, const char *ifname)
     }
 }
 
+static int
+_json_dump_append_cb(const char *buffer, size_t size, void *user_data)
+{
+    nm_str_buf_append_len(user_data, buffer, size);
+    return 0;
+}
+
 /**
  * ovsdb_next_command:
  *
@@ -1452,8 +1463,8 @@ ovsdb_next_command(NMOvsdb *self)
 {
     NMOvsdbPrivate             *priv = NM_OVSDB_GET_PRIVATE(self);
     OvsdbMethodCall            *call;
-    nm_auto_free char          *cmd = NULL;
     nm_auto_decref_json json_t *msg = NULL;
+    gsize                       buf_offset;
 
     if (priv->conn_fd < 0)
         return;
@@ -1590,9 +1601,16 @@ ovsdb_next_command(NMOvsdb *self)
 
     g_return_if_fail(msg);
 
-    cmd = json_dumps(msg, 0);
-    _LOGT_call(call, "send: call-id=%" G_GUINT64_FORMAT ", %s", call->call_id, cmd);
-    nm_str_buf_append(&priv->output_buf, cmd);
+    /* stream the serialization directly into the output buffer, instead of
+     * json_dumps() into an intermediate heap string that is then copied. */
+    buf_offset = priv->output_buf.len;
+    if (json_dump_callback(msg, _json_dump_append_cb, &priv->output_buf, 0) != 0)
+        nm_assert_not_reached();
+
+    _LOGT_call(call,
+               "send: call-id=%" G_GUINT64_FORMAT ", %s",
+               call->call_id,
+               &nm_str_buf_get_str(&priv->output_buf)[buf_offset]);
 
     ovsdb_write_try(self);
 }
@@ -870,15 +870,24 @@ attach_port(NMDevice                  *device,
             sanitized_config = g_strdup(nm_setting_team_port_get_config(s_team_port) ?: "{}");
             g_strdelimit(sanitized_config, "\r\n", ' ');
 
-            g_hash_table_insert(priv->port_configs, g_strdup(port_iface), sanitized_config);
-
-            if (!priv->tdc) {
-                _LOGW(LOGD_TEAM,
-                      "attached team port %s config not changed, not connected to teamd",
-                      port_iface);
+            if (nm_streq0(g_hash_table_lookup(priv->port_configs, port_iface),
+                          sanitized_config)) {
+                /* teamd already has this exact port config. Pushing it again
+                 * would only make teamd re-parse the JSON and reconfigure the
+                 * port without any change. */
+                _LOGT(LOGD_TEAM, "port config for %s unchanged, skip update", port_iface);
+                g_free(sanitized_config);
             } else {
-                if (!_update_port_config(self, port_iface, sanitized_config))
-                    return FALSE;
+                g_hash_table_insert(priv->port_configs, g_strdup(port_iface), sanitized_config);
+
+                if (!priv->tdc) {
+                    _LOGW(LOGD_TEAM,
+                          "attached team port %s config not changed, not connected to teamd",
+                          port_iface);
+                } else {
+                    if (!_update_port_config(self, port_iface, sanitized_config))
+                        return FALSE;
+                }
             }
         }
         success = nm_platform_link_enslave(nm_device_get_platform(device),
@@ -88,6 +88,8 @@ typedef struct {
     GSource *scan_request_delay_source;
     GSource *roam_supplicant_wait_source;
 
+    GSource *recheck_available_connections_source;
+
     NMWifiAP *current_ap;
 
     GHashTable *scan_request_ssids_hash;
@@ -808,6 +810,31 @@ periodic_update_cb(gpointer user_data)
     return TRUE;
 }
 
+static gboolean
+_recheck_available_connections_cb(gpointer user_data)
+{
+    NMDeviceWifi        *self = user_data;
+    NMDeviceWifiPrivate *priv = NM_DEVICE_WIFI_GET_PRIVATE(self);
+
+    nm_clear_g_source_inst(&priv->recheck_available_connections_source);
+    nm_device_recheck_available_connections(NM_DEVICE(self));
+    return G_SOURCE_CONTINUE;
+}
+
+static void
+_recheck_available_connections_schedule(NMDeviceWifi *self)
+{
+    NMDeviceWifiPrivate *priv = NM_DEVICE_WIFI_GET_PRIVATE(self);
+
+    /* The supplicant notifies each BSS of a scan result individually, and
+     * rechecking the available connections iterates over all profiles. Don't
+     * do that synchronously for every BSS, coalesce the rechecks of one
+     * burst into a single idle handler. */
+    if (!priv->recheck_available_connections_source)
+        priv->recheck_available_connections_source =
+            nm_g_idle_add_source(_recheck_available_connections_cb, self);
+}
+
 static void
 ap_add_remove(NMDeviceWifi *self,
               gboolean      is_adding, /* or else removing */
@@ -824,6 +851,13 @@ ap_add_remove(NMDeviceWifi *self,
                                  nm_wifi_ap_get_supplicant_path(ap),
                                  ap))
             nm_assert_not_reached();
+        /* APs must be exported eagerly, even if no client ever looks at
+         * them: libnm consumers learn about them exclusively through the
+         * ObjectManager's InterfacesAdded signal and GetManagedObjects,
+         * so an object that materializes on first path access would never
+         * become visible. The export itself is a single registration; the
+         * expensive follow-up work (available-connections recheck,
+         * properties flush) is coalesced per burst elsewhere. */
         nm_dbus_object_export(NM_DBUS_OBJECT(ap));
         _ap_dump(self, LOGL_DEBUG, ap, "added", 0);
         nm_device_wifi_emit_signal_access_point(NM_DEVICE(self), ap, TRUE);
@@ -845,7 +879,7 @@ ap_add_remove(NMDeviceWifi *self,
 
     nm_device_recheck_auto_activate_schedule(NM_DEVICE(self));
     if (recheck_available_connections)
-        nm_device_recheck_available_connections(NM_DEVICE(self));
+        _recheck_available_connections_schedule(self);
 }
 
 static void
@@ -862,6 +896,7 @@ remove_all_aps(NMDeviceWifi *self)
     while ((ap = c_list_first_entry(&priv->aps_lst_head, NMWifiAP, aps_lst)))
         ap_add_remove(self, FALSE, ap, FALSE);
 
+    nm_clear_g_source_inst(&priv->recheck_available_connections_source);
     nm_device_recheck_available_connections(NM_DEVICE(self));
 }
 
@@ -3798,6 +3833,7 @@ dispose(GObject *object)
 
     nm_clear_g_source(&priv->periodic_update_id);
     nm_clear_g_source_inst(&priv->roam_supplicant_wait_source);
+    nm_clear_g_source_inst(&priv->recheck_available_connections_source);
 
     wifi_secrets_cancel(self);
 
@@ -399,7 +399,15 @@ modm_ensure_manager(NMModemManager *self)
 
     /* Create the GDBusObjectManagerClient. We do not request to autostart, as
      * we don't really want the MMManager creation to fail. We can always poke
-     * later on if we want to request the autostart */
+     * later on if we want to request the autostart.
+     *
+     * Note that the MMManager mirrors all of ModemManager's objects through
+     * one PropertiesChanged subscription, including properties we never look
+     * at (like signal quality). That cannot be narrowed from this side: D-Bus
+     * match rules have no negative filters, and even a dropped message first
+     * wakes us up to parse it. The frequency of such updates is the sender's
+     * policy -- we never enable ModemManager's extended signal polling, so in
+     * steady state the spam is bounded by MM's own refresh rate. */
     if (!priv->modm.manager) {
         if (!priv->main_cancellable)
             priv->main_cancellable = g_cancellable_new();
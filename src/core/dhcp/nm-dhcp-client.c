@@ -769,6 +769,7 @@ _nm_dhcp_client_notify(NMDhcpClient         *self,
     NMDhcpClientPrivate                     *priv = NM_DHCP_CLIENT_GET_PRIVATE(self);
     GHashTable                              *options;
     gboolean                                 l3cd_changed;
+    gboolean                                 wait_dhcp_commit_old;
     NMOptionBool                             acd_state;
     const int                                IS_IPv4     = NM_IS_IPv4(priv->config.addr_family);
     nm_auto_unref_l3cd const NML3ConfigData *l3cd_merged = NULL;
@@ -882,6 +883,8 @@ _nm_dhcp_client_notify(NMDhcpClient         *self,
     nm_l3_config_data_reset(&priv->l3cd_curr, priv->l3cd_next);
     priv->l3cfg_notify.wait_ipv6_dad = FALSE;
 
+    wait_dhcp_commit_old = priv->l3cfg_notify.wait_dhcp_commit;
+
     if (client_event_type == NM_DHCP_CLIENT_EVENT_TYPE_BOUND && priv->l3cd_curr
         && nm_l3_config_data_get_num_addresses(priv->l3cd_curr, priv->config.addr_family) > 0)
         priv->l3cfg_notify.wait_dhcp_commit = TRUE;
@@ -906,6 +909,17 @@ _nm_dhcp_client_notify(NMDhcpClient         *self,
         _acd_state_reset(self, TRUE, TRUE);
     }
 
+    if (client_event_type == NM_DHCP_CLIENT_EVENT_TYPE_EXTENDED && !l3cd_changed
+        && priv->l3cfg_notify.wait_dhcp_commit == wait_dhcp_commit_old) {
+        /* The renewal didn't change any of the effective configuration
+         * (including the lifetimes) nor the accepted state. Don't bother the
+         * listeners with a lease-update, it would only trigger a spurious
+         * commit. If the lease was still pending acceptance, we must emit:
+         * the update now carries accepted=TRUE, and swallowing it would
+         * leave the device waiting for the DHCP timeout. */
+        return;
+    }
+
     _emit_notify(self,
                  NM_DHCP_CLIENT_NOTIFY_TYPE_LEASE_UPDATE,
                  .lease_update = {
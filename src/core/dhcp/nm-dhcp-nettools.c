@@ -62,6 +62,10 @@ typedef struct {
 
     GSource *event_source;
     char    *lease_file;
+
+    /* The address that was last written to "lease_file". Used to skip
+     * rewriting the file on lease renewals that don't change the address. */
+    in_addr_t lease_file_saved_addr;
 } NMDhcpNettoolsPrivate;
 
 struct _NMDhcpNettools {
@@ -872,6 +876,7 @@ lease_to_ip4_config(NMDhcpNettools *self, NDhcp4ClientLease *lease, GError **err
 static void
 lease_save(NMDhcpNettools *self, NDhcp4ClientLease *lease, const char *lease_file)
 {
+    NMDhcpNettoolsPrivate   *priv = NM_DHCP_NETTOOLS_GET_PRIVATE(self);
     struct in_addr           a_address;
     nm_auto_str_buf NMStrBuf sbuf = NM_STR_BUF_INIT(NM_UTILS_GET_NEXT_REALLOC_SIZE_104, FALSE);
     char                     addr_str[NM_INET_ADDRSTRLEN];
@@ -884,11 +889,22 @@ lease_save(NMDhcpNettools *self, NDhcp4ClientLease *lease, const char *lease_fil
     if (a_address.s_addr == INADDR_ANY)
         return;
 
+    if (a_address.s_addr == priv->lease_file_saved_addr) {
+        /* lease renewals usually keep the address. Don't rewrite (and sync)
+         * the file with identical content on every renewal. */
+        return;
+    }
+
     nm_str_buf_append(&sbuf, "# This is private data. Do not parse.\n");
     nm_str_buf_append_printf(&sbuf, "ADDRESS=%s\n", nm_inet4_ntop(a_address.s_addr, addr_str));
 
-    if (!g_file_set_contents(lease_file, nm_str_buf_get_str_unsafe(&sbuf), sbuf.len, &error))
+    if (!g_file_set_contents(lease_file, nm_str_buf_get_str_unsafe(&sbuf), sbuf.len, &error)) {
         _LOGW("error saving lease to %s: %s", lease_file, error->message);
+        priv->lease_file_saved_addr = INADDR_ANY;
+        return;
+    }
+
+    priv->lease_file_saved_addr = a_address.s_addr;
 }
 
 static void
@@ -1462,7 +1478,8 @@ ip4_start(NMDhcpClient *client, GError **error)
     }
 
     g_free(priv->lease_file);
-    priv->lease_file = g_steal_pointer(&lease_file);
+    priv->lease_file            = g_steal_pointer(&lease_file);
+    priv->lease_file_saved_addr = INADDR_ANY;
 
     r = n_dhcp4_client_probe(priv->client, &priv->probe, config);
     if (r) {
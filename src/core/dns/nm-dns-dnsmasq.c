@@ -680,6 +680,12 @@ typedef struct {
 
     GVariant *set_server_ex_args;
 
+    /* The last argument that dnsmasq acknowledged. Used to elide a
+     * SetServersEx call when the server list didn't actually change.
+     * Cleared when dnsmasq goes away, because a respawned instance
+     * starts out without any servers. */
+    GVariant *set_server_ex_args_sent;
+
     GCancellable *update_cancellable;
 
     GCancellable *main_cancellable;
@@ -950,10 +956,16 @@ dnsmasq_update_done(GObject *source_object, GAsyncResult *res, gpointer user_dat
 
     nm_clear_g_cancellable(&priv->update_cancellable);
 
-    if (!response)
+    if (!response) {
         _LOGW("dnsmasq update failed: %s", error->message);
-    else
+        /* dnsmasq's state is now unknown. Make sure the next update is
+         * sent even if the server list is unchanged. */
+        nm_clear_pointer(&priv->set_server_ex_args_sent, g_variant_unref);
+    } else {
         _LOGD("dnsmasq update successful");
+        nm_clear_pointer(&priv->set_server_ex_args_sent, g_variant_unref);
+        priv->set_server_ex_args_sent = g_variant_ref(priv->set_server_ex_args);
+    }
 
     _update_pending_maybe_changed(self);
 }
@@ -1001,6 +1013,7 @@ _main_cleanup(NMDnsDnsmasq *self, gboolean emit_failed)
 
     priv->process_pid = 0;
     nm_clear_g_free(&priv->name_owner);
+    nm_clear_pointer(&priv->set_server_ex_args_sent, g_variant_unref);
 
     nm_clear_g_dbus_connection_signal(priv->dbus_connection, &priv->name_owner_changed_id);
 
@@ -1218,6 +1231,15 @@ update(NMDnsPlugin             *plugin,
     nm_clear_pointer(&priv->set_server_ex_args, g_variant_unref);
     priv->set_server_ex_args =
         g_variant_ref_sink(create_update_args(self, global_config, ip_data_lst_head, hostdomain));
+
+    if (priv->set_server_ex_args_sent
+        && g_variant_equal(priv->set_server_ex_args, priv->set_server_ex_args_sent)) {
+        /* dnsmasq already has exactly this server list. */
+        _LOGD("dnsmasq update not necessary (nameservers unchanged)");
+        _update_pending_maybe_changed(self);
+        return TRUE;
+    }
+
     priv->set_server_ex_args_dirty = TRUE;
 
     send_dnsmasq_update(self);
@@ -1254,7 +1276,25 @@ nm_dns_dnsmasq_init(NMDnsDnsmasq *self)
 NMDnsPlugin *
 nm_dns_dnsmasq_new(void)
 {
-    return g_object_new(NM_TYPE_DNS_DNSMASQ, NULL);
+    NMDnsDnsmasq         *self;
+    gs_free_error GError *error = NULL;
+
+    self = g_object_new(NM_TYPE_DNS_DNSMASQ, NULL);
+
+    /* Pre-spawn dnsmasq right when the plugin gets selected, instead of waiting
+     * for the first update. The instance starts out with an empty server list
+     * and receives the real configuration via the regular SetServersEx update
+     * path once the first update arrives. This way dnsmasq's startup and D-Bus
+     * registration overlap with the rest of the daemon's startup and don't
+     * extend the window during which name resolution is unavailable.
+     *
+     * A failure here is not fatal. The first update() calls start_dnsmasq()
+     * again and propagates the error, so that NMDnsManager can fall back to a
+     * non-caching configuration. */
+    if (!start_dnsmasq(self, FALSE, &error))
+        _LOGD("pre-spawn of dnsmasq failed: %s", error->message);
+
+    return NM_DNS_PLUGIN(self);
 }
 
 static void
@@ -1270,6 +1310,7 @@ dispose(GObject *object)
     _main_cleanup(self, FALSE);
 
     nm_clear_pointer(&priv->set_server_ex_args, g_variant_unref);
+    nm_clear_pointer(&priv->set_server_ex_args_sent, g_variant_unref);
 
     G_OBJECT_CLASS(nm_dns_dnsmasq_parent_class)->dispose(object);
 
@@ -25,6 +25,7 @@
 #endif
 
 #include "libnm-core-intern/nm-core-internal.h"
+#include "libnm-glib-aux/nm-perf-counter.h"
 #include "libnm-glib-aux/nm-str-buf.h"
 
 #include "NetworkManagerUtils.h"
@@ -98,6 +99,11 @@ typedef struct {
      * "update_pending_unblock" timer ticking. */
     GSource *update_pending_unblock;
 
+    /* Scheduled when an update comes in outside an explicit
+     * begin_updates()/end_updates() batch. Coalesces a burst of
+     * per-interface changes into one commit per main loop iteration. */
+    GSource *update_commit_source;
+
     bool ip_data_lst_need_sort : 1;
 
     bool configs_lst_need_sort : 1;
@@ -1753,6 +1759,8 @@ _mgr_configs_data_clear(NMDnsManager *self)
 
 /*****************************************************************************/
 
+NM_PERF_COUNTER_DEFINE(_perf_dns_updates, "dns.updates");
+
 static gboolean
 update_dns(NMDnsManager *self, gboolean no_caching, gboolean force_emit, GError **error)
 {
@@ -1773,6 +1781,8 @@ update_dns(NMDnsManager *self, gboolean no_caching, gboolean force_emit, GError
 
     nm_assert(!error || !*error);
 
+    NM_PERF_COUNTER_INC(_perf_dns_updates);
+
     priv->config_changed = FALSE;
 
     if (priv->is_stopped) {
@@ -1781,6 +1791,7 @@ update_dns(NMDnsManager *self, gboolean no_caching, gboolean force_emit, GError
     }
 
     nm_clear_g_source(&priv->plugin_ratelimit.timer);
+    nm_clear_g_source_inst(&priv->update_commit_source);
 
     if (NM_IN_SET(priv->rc_manager,
                   NM_DNS_MANAGER_RESOLV_CONF_MAN_UNMANAGED,
@@ -1984,6 +1995,32 @@ plugin_skip:;
     return TRUE;
 }
 
+static gboolean
+_update_commit_cb(gpointer user_data)
+{
+    NMDnsManager         *self  = user_data;
+    NMDnsManagerPrivate  *priv  = NM_DNS_MANAGER_GET_PRIVATE(self);
+    gs_free_error GError *error = NULL;
+
+    nm_clear_g_source_inst(&priv->update_commit_source);
+
+    if (!update_dns(self, FALSE, FALSE, &error))
+        _LOGW("could not commit DNS changes: %s", error->message);
+
+    return G_SOURCE_CONTINUE;
+}
+
+static void
+_update_commit_schedule(NMDnsManager *self)
+{
+    NMDnsManagerPrivate *priv = NM_DNS_MANAGER_GET_PRIVATE(self);
+
+    if (priv->update_commit_source)
+        return;
+
+    priv->update_commit_source = nm_g_idle_add_source(_update_commit_cb, self);
+}
+
 gboolean
 nm_dns_manager_is_unmanaged(NMDnsManager *self)
 {
@@ -2167,12 +2204,8 @@ done:
     if (data && c_list_is_empty(&data->data_lst_head))
         g_hash_table_remove(priv->configs_dict, data);
 
-    if (!priv->updates_queue) {
-        gs_free_error GError *error = NULL;
-
-        if (!update_dns(self, FALSE, FALSE, &error))
-            _LOGW("could not commit DNS changes: %s", error->message);
-    }
+    if (!priv->updates_queue)
+        _update_commit_schedule(self);
 
     return TRUE;
 }
@@ -2223,12 +2256,8 @@ nm_dns_manager_set_hostname(NMDnsManager *self, const char *hostname, gboolean s
     if (skip_update)
         return;
 
-    if (!priv->updates_queue) {
-        gs_free_error GError *error = NULL;
-
-        if (!update_dns(self, FALSE, FALSE, &error))
-            _LOGW("could not commit DNS changes: %s", error->message);
-    }
+    if (!priv->updates_queue)
+        _update_commit_schedule(self);
 }
 
 void
@@ -2289,6 +2318,15 @@ nm_dns_manager_stop(NMDnsManager *self)
 
     _LOGT("stopping...");
 
+    /* Flush a deferred commit, so that we don't shut down with a stale
+     * resolv.conf. */
+    if (priv->update_commit_source) {
+        gs_free_error GError *error = NULL;
+
+        if (!update_dns(self, FALSE, FALSE, &error))
+            _LOGW("could not commit DNS changes: %s", error->message);
+    }
+
     /* If we're quitting, leave a valid resolv.conf in place, not one
      * pointing to 127.0.0.1 if dnsmasq was active.  But if we haven't
      * done any DNS updates yet, there's no reason to touch resolv.conf
@@ -2871,6 +2909,7 @@ dispose(GObject *object)
     _clear_plugin(self);
 
     nm_clear_g_source_inst(&priv->update_pending_unblock);
+    nm_clear_g_source_inst(&priv->update_commit_source);
 
     priv->best_ip_config_4 = NULL;
     priv->best_ip_config_6 = NULL;
@@ -78,6 +78,13 @@ struct _NMDnsSystemdResolvedResolveHandle {
 typedef struct {
     GDBusConnection *dbus_connection;
     GHashTable      *dirty_interfaces;
+
+    /* Cache of the last argument that systemd-resolved acknowledged, keyed
+     * by "$OPERATION@$IFINDEX". Used to skip re-sending identical requests
+     * when an unrelated interface changes. Flushed on name-owner changes,
+     * because a restarted systemd-resolved lost all per-link state. */
+    GHashTable *sent_cache;
+
     GCancellable    *cancellable;
     GCancellable    *service_start_cancellable;
     CList            request_queue_lst_head;
@@ -267,11 +274,18 @@ _interface_config_free(InterfaceConfig *config)
     nm_g_slice_free(config);
 }
 
+static char *
+_sent_cache_key(const char *operation, int ifindex)
+{
+    return g_strdup_printf("%s@%d", operation, ifindex);
+}
+
 static void
 call_done(GObject *source, GAsyncResult *r, gpointer user_data)
 {
-    gs_unref_variant GVariant   *v     = NULL;
-    gs_free_error GError        *error = NULL;
+    gs_unref_variant GVariant   *v        = NULL;
+    gs_unref_variant GVariant   *argument = NULL;
+    gs_free_error GError        *error    = NULL;
     NMDnsSystemdResolved        *self;
     NMDnsSystemdResolvedPrivate *priv;
     RequestItem                 *request_item;
@@ -284,6 +298,7 @@ call_done(GObject *source, GAsyncResult *r, gpointer user_data)
     self         = request_item->self;
     operation    = request_item->operation;
     ifindex      = request_item->ifindex;
+    argument     = g_variant_ref(request_item->argument);
     _request_item_unref(request_item);
 
     priv = NM_DNS_SYSTEMD_RESOLVED_GET_PRIVATE(self);
@@ -310,6 +325,9 @@ call_done(GObject *source, GAsyncResult *r, gpointer user_data)
             }
         }
         priv->send_updates_warn_ratelimited = FALSE;
+        g_hash_table_insert(priv->sent_cache,
+                            _sent_cache_key(operation, ifindex),
+                            g_steal_pointer(&argument));
         goto out_dec_pending;
     }
 
@@ -713,7 +731,9 @@ send_updates(NMDnsSystemdResolved *self)
     _LOGT("send-updates: start %zu requests", c_list_length(&priv->request_queue_lst_head));
 
     c_list_for_each_entry (request_item, &priv->request_queue_lst_head, request_queue_lst) {
-        gs_free char *ss = NULL;
+        gs_free char *ss        = NULL;
+        gs_free char *cache_key = NULL;
+        GVariant     *sent_argument;
 
         if ((request_item->operation == DBUS_OP_SET_LINK_DEFAULT_ROUTE
              && priv->has_set_link_default_route == NM_TERNARY_FALSE)
@@ -727,6 +747,14 @@ send_updates(NMDnsSystemdResolved *self)
             continue;
         }
 
+        cache_key     = _sent_cache_key(request_item->operation, request_item->ifindex);
+        sent_argument = g_hash_table_lookup(priv->sent_cache, cache_key);
+        if (sent_argument && g_variant_equal(sent_argument, request_item->argument)) {
+            /* systemd-resolved already acknowledged this exact configuration
+             * for the link. Don't repeat it. */
+            continue;
+        }
+
         _LOGT("send-updates: %s ( %s )",
               request_item->operation,
               (ss = g_variant_print(request_item->argument, FALSE)));
@@ -886,6 +914,10 @@ name_owner_changed(NMDnsSystemdResolved *self, const char *owner)
     nm_clear_g_cancellable(&priv->service_start_cancellable);
     nm_strdup_reset(&priv->dbus_owner, owner);
 
+    /* A new (or no) instance doesn't have the configuration we sent to the
+     * previous one. Everything must be sent again. */
+    g_hash_table_remove_all(priv->sent_cache);
+
     if (owner) {
         priv->try_start_blocked    = FALSE;
         priv->send_updates_waiting = TRUE;
@@ -1258,6 +1290,8 @@ nm_dns_systemd_resolved_init(NMDnsSystemdResolved *self)
     c_list_init(&priv->request_queue_lst_head);
     c_list_init(&priv->handle_lst_head);
     priv->dirty_interfaces = g_hash_table_new(nm_direct_hash, NULL);
+    priv->sent_cache =
+        g_hash_table_new_full(nm_str_hash, g_str_equal, g_free, (GDestroyNotify) g_variant_unref);
 
     priv->dbus_connection = nm_g_object_ref(NM_MAIN_DBUS_CONNECTION_GET);
     if (!priv->dbus_connection) {
@@ -1298,6 +1332,7 @@ dispose(GObject *object)
 
     g_clear_object(&priv->dbus_connection);
     nm_clear_pointer(&priv->dirty_interfaces, g_hash_table_destroy);
+    nm_clear_pointer(&priv->sent_cache, g_hash_table_destroy);
 
     G_OBJECT_CLASS(nm_dns_systemd_resolved_parent_class)->dispose(object);
 }
@@ -17,6 +17,8 @@
 #include <sys/types.h>
 #include <sys/resource.h>
 
+#include "libnm-glib-aux/nm-perf-trace.h"
+#include "libnm-glib-aux/nm-time-utils.h"
 #include "main-utils.h"
 #include "nm-dbus-interface.h"
 #include "NetworkManagerUtils.h"
@@ -32,6 +34,7 @@
 #include "nm-auth-manager.h"
 #include "libnm-core-intern/nm-core-internal.h"
 #include "nm-dbus-object.h"
+#include "nm-state-mirror.h"
 #include "nm-connectivity.h"
 #include "dns/nm-dns-manager.h"
 #include "libnm-systemd-core/nm-sd.h"
@@ -51,6 +54,7 @@ static gboolean   configure_and_quit = FALSE;
 static struct {
     gboolean show_version;
     gboolean print_config;
+    gboolean print_startup_timing;
     gboolean become_daemon;
     gboolean g_fatal_warnings;
     gboolean run_from_build_dir;
@@ -71,6 +75,101 @@ _set_g_fatal_warnings(void)
     g_log_set_always_fatal(fatal_mask);
 }
 
+/* An iteration of the main loop that spends longer than this in
+ * check/dispatch (that is, in our callbacks) gets logged as a stall. */
+#define MAIN_LOOP_STALL_THRESHOLD_MSEC 100
+
+static GPollFunc _main_loop_poll_orig;
+static gint64    _main_loop_poll_done_msec;
+
+static gint
+_main_loop_stall_watchdog_poll(GPollFD *ufds, guint nfds, gint timeout)
+{
+    gint64 now_msec;
+    gint   r;
+
+    /* the time from the end of the previous poll until we poll again is
+     * what this iteration spent dispatching sources. Time blocked inside
+     * poll itself is idle time and doesn't count. */
+    now_msec = nm_utils_get_monotonic_timestamp_msec();
+    if (_main_loop_poll_done_msec != 0
+        && now_msec - _main_loop_poll_done_msec >= MAIN_LOOP_STALL_THRESHOLD_MSEC) {
+        nm_log_warn(LOGD_CORE,
+                    "main-loop: stall: dispatch took %" G_GINT64_FORMAT " msec",
+                    now_msec - _main_loop_poll_done_msec);
+    }
+
+    r = _main_loop_poll_orig(ufds, nfds, timeout);
+
+    _main_loop_poll_done_msec = nm_utils_get_monotonic_timestamp_msec();
+    return r;
+}
+
+static void
+_main_loop_stall_watchdog_setup(void)
+{
+    GMainContext *context = g_main_loop_get_context(main_loop);
+
+    _main_loop_poll_orig = g_main_context_get_poll_func(context);
+    g_main_context_set_poll_func(context, _main_loop_stall_watchdog_poll);
+}
+
+/* Monotonic timestamps of the startup phases, recorded as main() passes
+ * through them. Always collected (five timestamp reads per boot); the
+ * consolidated report is emitted once startup completes. */
+static struct {
+    gint64 begin_msec;
+    gint64 config_msec;
+    gint64 platform_msec;
+    gint64 manager_start_msec;
+} _startup_timing;
+
+static void
+_startup_timing_manager_notify_startup(GObject *object, GParamSpec *pspec, gpointer user_data)
+{
+    gboolean startup;
+    gint64   now_msec;
+
+    g_object_get(object, NM_MANAGER_STARTUP, &startup, NULL);
+    if (startup)
+        return;
+
+    g_signal_handlers_disconnect_by_func(object,
+                                         G_CALLBACK(_startup_timing_manager_notify_startup),
+                                         user_data);
+
+    now_msec = nm_utils_get_monotonic_timestamp_msec();
+
+    /* with no devices to wait for, startup can complete inside
+     * nm_manager_start() before main() records that timestamp. */
+    if (_startup_timing.manager_start_msec == 0)
+        _startup_timing.manager_start_msec = now_msec;
+
+    nm_log_info(LOGD_CORE,
+                "startup-timing: config=%" G_GINT64_FORMAT "ms platform-init=%" G_GINT64_FORMAT
+                "ms manager-start=%" G_GINT64_FORMAT "ms startup-complete=%" G_GINT64_FORMAT
+                "ms total=%" G_GINT64_FORMAT "ms",
+                _startup_timing.config_msec - _startup_timing.begin_msec,
+                _startup_timing.platform_msec - _startup_timing.config_msec,
+                _startup_timing.manager_start_msec - _startup_timing.platform_msec,
+                now_msec - _startup_timing.manager_start_msec,
+                now_msec - _startup_timing.begin_msec);
+
+    if (global_opt.print_startup_timing) {
+        /* one parseable line on stdout for the image pipeline. Only useful
+         * together with --no-daemon, otherwise stdout is detached. */
+        printf("startup-timing: config=%" G_GINT64_FORMAT "ms platform-init=%" G_GINT64_FORMAT
+               "ms manager-start=%" G_GINT64_FORMAT "ms startup-complete=%" G_GINT64_FORMAT
+               "ms total=%" G_GINT64_FORMAT "ms\n",
+               _startup_timing.config_msec - _startup_timing.begin_msec,
+               _startup_timing.platform_msec - _startup_timing.config_msec,
+               _startup_timing.manager_start_msec - _startup_timing.platform_msec,
+               now_msec - _startup_timing.manager_start_msec,
+               now_msec - _startup_timing.begin_msec);
+        fflush(stdout);
+    }
+}
+
 static void
 _init_nm_debug(NMConfig *config)
 {
@@ -78,10 +177,12 @@ _init_nm_debug(NMConfig *config)
     enum {
         D_RLIMIT_CORE    = (1 << 0),
         D_FATAL_WARNINGS = (1 << 1),
+        D_PERF_TRACE     = (1 << 2),
     };
     GDebugKey keys[] = {
         {"RLIMIT_CORE", D_RLIMIT_CORE},
         {"fatal-warnings", D_FATAL_WARNINGS},
+        {"perf-trace", D_PERF_TRACE},
     };
     guint       flags;
     const char *env = getenv("NM_DEBUG");
@@ -109,6 +210,12 @@ _init_nm_debug(NMConfig *config)
 
     if (NM_FLAGS_HAS(flags, D_FATAL_WARNINGS))
         _set_g_fatal_warnings();
+
+    if (NM_FLAGS_HAS(flags, D_PERF_TRACE)) {
+        /* record hot-path trace events in a ring buffer, dumped to the
+         * log together with the perf counters on SIGUSR1. */
+        nm_perf_trace_enable();
+    }
 }
 
 void
@@ -239,6 +346,14 @@ do_early_setup(int *argc, char **argv[], NMConfigCmdLineOptions *config_cli)
                                &global_opt.print_config,
                                N_("Print NetworkManager configuration and exit"),
                                NULL},
+                              {"print-startup-timing",
+                               0,
+                               0,
+                               G_OPTION_ARG_NONE,
+                               &global_opt.print_startup_timing,
+                               N_("Print a startup phase timing report on stdout once startup "
+                                  "completes (use with --no-daemon)"),
+                               NULL},
                               {NULL}};
 
     if (!nm_main_utils_early_setup(
@@ -298,6 +413,8 @@ main(int argc, char *argv[])
 
     _nm_utils_is_manager_process = TRUE;
 
+    _startup_timing.begin_msec = nm_utils_get_monotonic_timestamp_msec();
+
     /* Known to cause a possible deadlock upon GDBus initialization:
      * https://bugzilla.gnome.org/show_bug.cgi?id=674885 */
     g_type_ensure(G_TYPE_SOCKET);
@@ -380,6 +497,8 @@ main(int argc, char *argv[])
         exit(1);
     }
 
+    _startup_timing.config_msec = nm_utils_get_monotonic_timestamp_msec();
+
     _init_nm_debug(config);
 
     /* Initialize logging from config file *only* if not explicitly
@@ -409,6 +528,8 @@ main(int argc, char *argv[])
 
     main_loop = g_main_loop_new(NULL, FALSE);
 
+    _main_loop_stall_watchdog_setup();
+
     /* Set up unix signal handling - before creating threads, but after daemonizing! */
     nm_main_utils_setup_signals(main_loop);
 
@@ -422,6 +543,31 @@ main(int argc, char *argv[])
         nm_logging_init(v, nm_config_get_is_debug(config));
     }
 
+    {
+        gs_free char *v = NULL;
+
+        v = nm_config_data_get_value(NM_CONFIG_GET_DATA_ORIG,
+                                     NM_CONFIG_KEYFILE_GROUP_LOGGING,
+                                     NM_CONFIG_KEYFILE_KEY_LOGGING_DEVICE_FILTER,
+                                     NM_CONFIG_GET_VALUE_STRIP | NM_CONFIG_GET_VALUE_NO_EMPTY);
+        if (v)
+            nm_logging_setup_device_filter(v);
+    }
+
+    {
+        gint64 v;
+
+        v = nm_config_data_get_value_int64(NM_CONFIG_GET_DATA_ORIG,
+                                           NM_CONFIG_KEYFILE_GROUP_LOGGING,
+                                           NM_CONFIG_KEYFILE_KEY_LOGGING_FLIGHT_RECORDER_SIZE,
+                                           10,
+                                           0,
+                                           G_MAXINT32,
+                                           0);
+        if (v > 0)
+            nm_logging_setup_flight_recorder(v);
+    }
+
     nm_log_info(LOGD_CORE,
                 "NetworkManager (version " NM_DIST_VERSION ") is starting... (%s%sboot:%s)",
                 nm_config_get_first_start(config) ? "" : "after a restart, ",
@@ -475,6 +621,8 @@ main(int argc, char *argv[])
 
     nm_linux_platform_setup();
 
+    _startup_timing.platform_msec = nm_utils_get_monotonic_timestamp_msec();
+
     NM_UTILS_KEEP_ALIVE(config, nm_netns_get(), "NMConfig-depends-on-NMNetns");
 
     nm_auth_manager_setup(nm_config_data_get_main_auth_polkit(nm_config_get_data_orig(config)));
@@ -488,11 +636,20 @@ main(int argc, char *argv[])
                      G_CALLBACK(manager_configure_quit),
                      config);
 
+    g_signal_connect(manager,
+                     "notify::" NM_MANAGER_STARTUP,
+                     G_CALLBACK(_startup_timing_manager_notify_startup),
+                     NULL);
+
     if (!nm_manager_start(manager, &error)) {
         nm_log_err(LOGD_CORE, "failed to initialize: %s", error->message);
         goto done;
     }
 
+    _startup_timing.manager_start_msec = nm_utils_get_monotonic_timestamp_msec();
+
+    nm_state_mirror_setup(manager);
+
     nm_platform_process_events(NM_PLATFORM_GET);
 
     /* Make sure the loopback interface is up. If interface is down, we bring
@@ -521,6 +678,8 @@ main(int argc, char *argv[])
 
 done:
 
+    nm_state_mirror_shutdown();
+
     /* write the device-state to file. Note that we only persist the
      * state here. We don't bother updating the state as devices
      * change during regular operation. If NM is killed with SIGKILL,
@@ -8,25 +8,53 @@
 #include "nm-lndp-ndisc.h"
 
 #include <arpa/inet.h>
+#include <linux/sock_diag.h>
 #include <netinet/icmp6.h>
 #include <stdarg.h>
+#include <sys/socket.h>
 #include <ndp.h>
 
 #include "NetworkManagerUtils.h"
+#include "libnm-glib-aux/nm-perf-counter.h"
 #include "libnm-glib-aux/nm-str-buf.h"
 #include "libnm-platform/nm-platform.h"
 #include "libnm-platform/nmp-netns.h"
 #include "libnm-systemd-shared/nm-sd-utils-shared.h"
+#include "nm-config.h"
 #include "nm-l3cfg.h"
 #include "nm-ndisc-private.h"
 
 #define _NMLOG_PREFIX_NAME "ndisc-lndp"
 
+#ifndef SO_BUSY_POLL
+#define SO_BUSY_POLL 46
+#endif
+#ifndef SO_MEMINFO
+#define SO_MEMINFO 55
+#endif
+
 /*****************************************************************************/
 
+/* All NMLndpNDisc instances on the same netns (that is, the same NMPlatform)
+ * share one "struct ndp" raw ICMPv6 socket. libndp already demuxes received
+ * messages to the handlers registered per-ifindex, so there is no need to
+ * keep one socket and one GSource armed per interface. */
 typedef struct {
+    NMPlatform *platform;
     struct ndp *ndp;
     GSource    *event_source;
+    guint       ref_count;
+
+    /* SK_MEMINFO_DROPS of the socket as of the last sample, to turn the
+     * kernel's absolute drop count into perf counter increments. */
+    guint32 sock_drops;
+} SharedNdp;
+
+static GHashTable *shared_ndp_by_platform;
+
+typedef struct {
+    SharedNdp *shared;
+    bool       handler_registered : 1;
 } NMLndpNDiscPrivate;
 
 /*****************************************************************************/
@@ -49,6 +77,135 @@ G_DEFINE_TYPE(NMLndpNDisc, nm_lndp_ndisc, NM_TYPE_NDISC)
 
 /*****************************************************************************/
 
+NM_PERF_COUNTER_DEFINE(_perf_ndisc_events, "ndisc.sock-events");
+NM_PERF_COUNTER_DEFINE(_perf_ndisc_rx_drops, "ndisc.sock-rx-drops");
+
+/* Fold the kernel's receive-drop accounting for the shared ICMPv6 socket
+ * into the perf counters. SO_MEMINFO is one cheap getsockopt() and the
+ * event rate on this socket is low (RAs and NAs), so sampling on every
+ * wakeup is fine. */
+static void
+_shared_ndp_sample_meminfo(SharedNdp *shared)
+{
+    guint32   meminfo[SK_MEMINFO_VARS];
+    socklen_t len = sizeof(meminfo);
+
+    if (getsockopt(ndp_get_eventfd(shared->ndp), SOL_SOCKET, SO_MEMINFO, meminfo, &len) != 0
+        || len < sizeof(meminfo))
+        return;
+
+    if (meminfo[SK_MEMINFO_DROPS] != shared->sock_drops) {
+        nm_perf_counter_add(&_perf_ndisc_rx_drops, meminfo[SK_MEMINFO_DROPS] - shared->sock_drops);
+        shared->sock_drops = meminfo[SK_MEMINFO_DROPS];
+        nm_log_dbg(LOGD_IP6,
+                   "ndisc-lndp: ICMPv6 socket dropped packets (%u since socket creation)",
+                   (guint) shared->sock_drops);
+    }
+}
+
+static gboolean
+_shared_ndp_event_ready(int fd, GIOCondition condition, gpointer user_data)
+{
+    SharedNdp                  *shared = user_data;
+    nm_auto_pop_netns NMPNetns *netns  = NULL;
+
+    if (!nm_platform_netns_push(shared->platform, &netns)) {
+        /* something is very wrong. Stop handling events. */
+        nm_clear_g_source_inst(&shared->event_source);
+        return G_SOURCE_REMOVE;
+    }
+
+    NM_PERF_COUNTER_INC(_perf_ndisc_events);
+    ndp_callall_eventfd_handler(shared->ndp);
+    _shared_ndp_sample_meminfo(shared);
+    return G_SOURCE_CONTINUE;
+}
+
+static SharedNdp *
+_shared_ndp_acquire(NMPlatform *platform, int *out_errsv)
+{
+    SharedNdp *shared;
+    gint64     busy_poll_usec;
+    int        errsv;
+
+    /* must be called inside the netns of "platform". */
+
+    if (G_UNLIKELY(!shared_ndp_by_platform))
+        shared_ndp_by_platform = g_hash_table_new(nm_direct_hash, NULL);
+    else {
+        shared = g_hash_table_lookup(shared_ndp_by_platform, platform);
+        if (shared) {
+            shared->ref_count++;
+            NM_SET_OUT(out_errsv, 0);
+            return shared;
+        }
+    }
+
+    shared  = g_slice_new(SharedNdp);
+    *shared = (SharedNdp){
+        .platform  = g_object_ref(platform),
+        .ref_count = 1,
+    };
+
+    errsv = ndp_open(&shared->ndp);
+    if (errsv != 0) {
+        g_object_unref(shared->platform);
+        nm_g_slice_free(shared);
+        NM_SET_OUT(out_errsv, errsv);
+        return NULL;
+    }
+
+    shared->event_source = nm_g_unix_fd_add_source(ndp_get_eventfd(shared->ndp),
+                                                   G_IO_IN,
+                                                   _shared_ndp_event_ready,
+                                                   shared);
+
+    busy_poll_usec = nm_config_data_get_value_int64(NM_CONFIG_GET_DATA,
+                                                    NM_CONFIG_KEYFILE_GROUP_MAIN,
+                                                    NM_CONFIG_KEYFILE_KEY_MAIN_BUSY_POLL_USEC,
+                                                    10,
+                                                    0,
+                                                    G_MAXINT32,
+                                                    0);
+    if (busy_poll_usec > 0) {
+        int v = busy_poll_usec;
+
+        if (setsockopt(ndp_get_eventfd(shared->ndp), SOL_SOCKET, SO_BUSY_POLL, &v, sizeof(v)) != 0) {
+            nm_log_dbg(LOGD_IP6,
+                       "ndisc-lndp: failed to enable busy polling (%d usec) on ICMPv6 socket: %s",
+                       v,
+                       nm_strerror_native(errno));
+        } else {
+            nm_log_dbg(LOGD_IP6,
+                       "ndisc-lndp: enabled busy polling (%d usec) on ICMPv6 socket",
+                       v);
+        }
+    }
+
+    g_hash_table_insert(shared_ndp_by_platform, platform, shared);
+    NM_SET_OUT(out_errsv, 0);
+    return shared;
+}
+
+static void
+_shared_ndp_release(SharedNdp *shared)
+{
+    nm_assert(shared);
+    nm_assert(shared->ref_count > 0);
+    nm_assert(g_hash_table_lookup(shared_ndp_by_platform, shared->platform) == shared);
+
+    if (--shared->ref_count > 0)
+        return;
+
+    g_hash_table_remove(shared_ndp_by_platform, shared->platform);
+    nm_clear_g_source_inst(&shared->event_source);
+    ndp_close(shared->ndp);
+    g_object_unref(shared->platform);
+    nm_g_slice_free(shared);
+}
+
+/*****************************************************************************/
+
 static gboolean
 send_rs(NMNDisc *ndisc, GError **error)
 {
@@ -66,7 +223,7 @@ send_rs(NMNDisc *ndisc, GError **error)
     }
     ndp_msg_ifindex_set(msg, nm_ndisc_get_ifindex(ndisc));
 
-    errsv = ndp_msg_send(priv->ndp, msg);
+    errsv = ndp_msg_send(priv->shared->ndp, msg);
     ndp_msg_destroy(msg);
     if (errsv) {
         errsv = nm_errno_native(errsv);
@@ -542,7 +699,7 @@ dns_servers_done:
     }
 dns_domains_done:
 
-    errsv = ndp_msg_send(priv->ndp, msg);
+    errsv = ndp_msg_send(priv->shared->ndp, msg);
 
     ndp_msg_destroy(msg);
     if (errsv) {
@@ -568,50 +725,26 @@ receive_rs(struct ndp *ndp, struct ndp_msg *msg, gpointer user_data)
     return 0;
 }
 
-static gboolean
-event_ready(int fd, GIOCondition condition, gpointer user_data)
-{
-    gs_unref_object NMNDisc    *ndisc = g_object_ref(NM_NDISC(user_data));
-    nm_auto_pop_netns NMPNetns *netns = NULL;
-    NMLndpNDiscPrivate         *priv  = NM_LNDP_NDISC_GET_PRIVATE(ndisc);
-
-    _LOGD("processing libndp events");
-
-    if (!nm_ndisc_netns_push(ndisc, &netns)) {
-        /* something is very wrong. Stop handling events. */
-        nm_clear_g_source_inst(&priv->event_source);
-        return G_SOURCE_REMOVE;
-    }
-
-    ndp_callall_eventfd_handler(priv->ndp);
-    return G_SOURCE_CONTINUE;
-}
-
 static void
 start(NMNDisc *ndisc)
 {
     NMLndpNDiscPrivate *priv = NM_LNDP_NDISC_GET_PRIVATE(ndisc);
-    int                 fd;
-
-    g_return_if_fail(!priv->event_source);
-
-    fd = ndp_get_eventfd(priv->ndp);
 
-    priv->event_source = nm_g_unix_fd_add_source(fd, G_IO_IN, event_ready, ndisc);
+    g_return_if_fail(!priv->handler_registered);
 
     /* Flush any pending messages to avoid using obsolete information */
-    event_ready(fd, 0, ndisc);
+    _shared_ndp_event_ready(ndp_get_eventfd(priv->shared->ndp), 0, priv->shared);
 
     switch (nm_ndisc_get_node_type(ndisc)) {
     case NM_NDISC_NODE_TYPE_HOST:
-        ndp_msgrcv_handler_register(priv->ndp,
+        ndp_msgrcv_handler_register(priv->shared->ndp,
                                     receive_ra,
                                     NDP_MSG_RA,
                                     nm_ndisc_get_ifindex(ndisc),
                                     ndisc);
         break;
     case NM_NDISC_NODE_TYPE_ROUTER:
-        ndp_msgrcv_handler_register(priv->ndp,
+        ndp_msgrcv_handler_register(priv->shared->ndp,
                                     receive_rs,
                                     NDP_MSG_RS,
                                     nm_ndisc_get_ifindex(ndisc),
@@ -620,6 +753,8 @@ start(NMNDisc *ndisc)
     default:
         g_assert_not_reached();
     }
+
+    priv->handler_registered = TRUE;
 }
 
 static void
@@ -627,19 +762,20 @@ _cleanup(NMNDisc *ndisc)
 {
     NMLndpNDiscPrivate *priv = NM_LNDP_NDISC_GET_PRIVATE(ndisc);
 
-    nm_clear_g_source_inst(&priv->event_source);
+    if (!priv->shared)
+        return;
 
-    if (priv->ndp) {
+    if (priv->handler_registered) {
         switch (nm_ndisc_get_node_type(ndisc)) {
         case NM_NDISC_NODE_TYPE_HOST:
-            ndp_msgrcv_handler_unregister(priv->ndp,
+            ndp_msgrcv_handler_unregister(priv->shared->ndp,
                                           receive_ra,
                                           NDP_MSG_RA,
                                           nm_ndisc_get_ifindex(ndisc),
                                           ndisc);
             break;
         case NM_NDISC_NODE_TYPE_ROUTER:
-            ndp_msgrcv_handler_unregister(priv->ndp,
+            ndp_msgrcv_handler_unregister(priv->shared->ndp,
                                           receive_rs,
                                           NDP_MSG_RS,
                                           nm_ndisc_get_ifindex(ndisc),
@@ -649,9 +785,10 @@ _cleanup(NMNDisc *ndisc)
             nm_assert_not_reached();
             break;
         }
-        ndp_close(priv->ndp);
-        priv->ndp = NULL;
+        priv->handler_registered = FALSE;
     }
+
+    _shared_ndp_release(g_steal_pointer(&priv->shared));
 }
 
 static void
@@ -689,9 +826,9 @@ nm_lndp_ndisc_new(const NMNDiscConfig *config)
 
     priv = NM_LNDP_NDISC_GET_PRIVATE(ndisc);
 
-    errsv = ndp_open(&priv->ndp);
+    priv->shared = _shared_ndp_acquire(nm_l3cfg_get_platform(config->l3cfg), &errsv);
 
-    if (errsv != 0) {
+    if (!priv->shared) {
         /* This is serious. It might be ENOMEM or the inability to open (or modify)
          * a file descriptor. In all cases there is not much reason trying to recover
          * from that. File descriptors are a basic resource, that we just require (just
@@ -437,7 +437,8 @@ nm_ndisc_emit_config_change(NMNDisc *self, NMNDiscConfigMap changed)
 gboolean
 nm_ndisc_add_gateway(NMNDisc *ndisc, const NMNDiscGateway *new_item, gint64 now_msec)
 {
-    NMNDiscDataInternal *rdata = &NM_NDISC_GET_PRIVATE(ndisc)->rdata;
+    NMNDiscDataInternal *rdata    = &NM_NDISC_GET_PRIVATE(ndisc)->rdata;
+    const int            new_prio = _preference_to_priority(new_item->preference);
     guint                i;
     guint                insert_idx = G_MAXUINT;
 
@@ -465,9 +466,7 @@ nm_ndisc_add_gateway(NMNDisc *ndisc, const NMNDiscGateway *new_item, gint64 now_
         }
 
         /* Put before less preferable gateways. */
-        if (_preference_to_priority(item->preference)
-                < _preference_to_priority(new_item->preference)
-            && insert_idx == G_MAXUINT)
+        if (_preference_to_priority(item->preference) < new_prio && insert_idx == G_MAXUINT)
             insert_idx = i;
 
         i++;
@@ -672,6 +671,7 @@ nm_ndisc_add_route(NMNDisc *ndisc, const NMNDiscRoute *new_item, gint64 now_msec
 {
     NMNDiscPrivate      *priv;
     NMNDiscDataInternal *rdata;
+    int                  new_prio;
     guint                i;
     guint                insert_idx = G_MAXUINT;
     gboolean             changed    = FALSE;
@@ -687,8 +687,9 @@ nm_ndisc_add_route(NMNDisc *ndisc, const NMNDiscRoute *new_item, gint64 now_msec
         g_return_val_if_reached(FALSE);
     }
 
-    priv  = NM_NDISC_GET_PRIVATE(ndisc);
-    rdata = &priv->rdata;
+    priv     = NM_NDISC_GET_PRIVATE(ndisc);
+    rdata    = &priv->rdata;
+    new_prio = _preference_to_priority(new_item->preference);
 
     for (i = 0; i < rdata->routes->len;) {
         NMNDiscRoute *item = &nm_g_array_index(rdata->routes, NMNDiscRoute, i);
@@ -702,8 +703,8 @@ nm_ndisc_add_route(NMNDisc *ndisc, const NMNDiscRoute *new_item, gint64 now_msec
          * Hence, if both routes differ in the on-link flag,
          * comparison is aborted, and both routes are added.
          */
-        if (IN6_ARE_ADDR_EQUAL(&item->network, &new_item->network) && item->plen == new_item->plen
-            && item->on_link == new_item->on_link) {
+        if (item->plen == new_item->plen && item->on_link == new_item->on_link
+            && IN6_ARE_ADDR_EQUAL(&item->network, &new_item->network)) {
             if (new_item->expiry_msec <= now_msec) {
                 g_array_remove_index(rdata->routes, i);
                 return TRUE;
@@ -725,9 +726,7 @@ nm_ndisc_add_route(NMNDisc *ndisc, const NMNDiscRoute *new_item, gint64 now_msec
         }
 
         /* Put before less preferable routes. */
-        if (_preference_to_priority(item->preference)
-                < _preference_to_priority(new_item->preference)
-            && insert_idx == G_MAXUINT)
+        if (_preference_to_priority(item->preference) < new_prio && insert_idx == G_MAXUINT)
             insert_idx = i;
 
         i++;
@@ -1901,11 +1900,19 @@ nm_ndisc_init(NMNDisc *ndisc)
 
     rdata = &priv->rdata;
 
-    rdata->gateways    = g_array_new(FALSE, FALSE, sizeof(NMNDiscGateway));
-    rdata->addresses   = g_array_new(FALSE, FALSE, sizeof(NMNDiscAddress));
-    rdata->routes      = g_array_new(FALSE, FALSE, sizeof(NMNDiscRoute));
-    rdata->dns_servers = g_array_new(FALSE, FALSE, sizeof(NMNDiscDNSServer));
-    rdata->dns_domains = g_array_new(FALSE, FALSE, sizeof(NMNDiscDNSDomain));
+    /* The elements are stored inline in the GArray buffer (one contiguous
+     * block per collection), and GLib already grows the buffer in powers of
+     * two. Reserve capacity for the typical interface upfront (few gateways
+     * and DNS entries, a handful of addresses/routes), so that processing
+     * the first RA doesn't realloc these long-lived arrays several times.
+     * A container type with in-struct inline capacity was considered, but
+     * it would only save a single indirection on structures that are each
+     * touched once per RA, which doesn't justify a new array type. */
+    rdata->gateways    = g_array_sized_new(FALSE, FALSE, sizeof(NMNDiscGateway), 2);
+    rdata->addresses   = g_array_sized_new(FALSE, FALSE, sizeof(NMNDiscAddress), 8);
+    rdata->routes      = g_array_sized_new(FALSE, FALSE, sizeof(NMNDiscRoute), 8);
+    rdata->dns_servers = g_array_sized_new(FALSE, FALSE, sizeof(NMNDiscDNSServer), 2);
+    rdata->dns_domains = g_array_sized_new(FALSE, FALSE, sizeof(NMNDiscDNSDomain), 2);
     g_array_set_clear_func(rdata->dns_domains, dns_domain_free);
     priv->rdata.public.hop_limit = 64;
 }
@@ -13,6 +13,7 @@
 
 #define NM_VALUE_TYPE_DEFINE_FUNCTIONS
 
+#include "c-list/src/c-list.h"
 #include "libnm-core-aux-intern/nm-auth-subject.h"
 #include "libnm-glib-aux/nm-str-buf.h"
 #include "libnm-glib-aux/nm-value-type.h"
@@ -39,9 +40,24 @@ typedef struct {
 
 /*****************************************************************************/
 
+#if HAVE_LIBAUDIT
+typedef struct {
+    CList lst;
+    bool  success;
+    char  msg[];
+} AuditdMessage;
+#endif
+
 typedef struct {
     NMConfig *config;
     int       auditd_fd;
+
+    /* Records that still need to be written to the audit socket. The write
+     * waits for the kernel's acknowledgment and thus can block the caller,
+     * so it is deferred to an idle handler instead of happening inside the
+     * operation that is being audited. */
+    CList    auditd_msg_lst_head;
+    GSource *auditd_msg_idle_source;
 } NMAuditManagerPrivate;
 
 struct _NMAuditManager {
@@ -166,6 +182,58 @@ build_message(NMStrBuf *strbuf, AuditBackend backend, GPtrArray *fields)
     return nm_str_buf_get_str(strbuf);
 }
 
+#if HAVE_LIBAUDIT
+static void
+_auditd_message_flush(NMAuditManager *self)
+{
+    NMAuditManagerPrivate *priv = NM_AUDIT_MANAGER_GET_PRIVATE(self);
+    AuditdMessage         *msg;
+
+    nm_clear_g_source_inst(&priv->auditd_msg_idle_source);
+
+    while ((msg = c_list_first_entry(&priv->auditd_msg_lst_head, AuditdMessage, lst))) {
+        c_list_unlink_stale(&msg->lst);
+        if (priv->auditd_fd >= 0) {
+            int r;
+
+            r = audit_log_user_message(priv->auditd_fd,
+                                       AUDIT_USYS_CONFIG,
+                                       msg->msg,
+                                       NULL,
+                                       NULL,
+                                       NULL,
+                                       msg->success);
+            (void) r;
+        }
+        g_free(msg);
+    }
+}
+
+static gboolean
+_auditd_message_flush_cb(gpointer user_data)
+{
+    _auditd_message_flush(user_data);
+    return G_SOURCE_CONTINUE;
+}
+
+static void
+_auditd_message_queue(NMAuditManager *self, const char *message, gboolean success)
+{
+    NMAuditManagerPrivate *priv = NM_AUDIT_MANAGER_GET_PRIVATE(self);
+    AuditdMessage         *msg;
+    gsize                  l;
+
+    l            = strlen(message) + 1;
+    msg          = g_malloc(sizeof(AuditdMessage) + l);
+    msg->success = success;
+    memcpy(msg->msg, message, l);
+    c_list_link_tail(&priv->auditd_msg_lst_head, &msg->lst);
+
+    if (!priv->auditd_msg_idle_source)
+        priv->auditd_msg_idle_source = nm_g_idle_add_source(_auditd_message_flush_cb, self);
+}
+#endif /* HAVE_LIBAUDIT */
+
 static void
 nm_audit_log(NMAuditManager *self,
              GPtrArray      *fields,
@@ -185,16 +253,11 @@ nm_audit_log(NMAuditManager *self,
     priv = NM_AUDIT_MANAGER_GET_PRIVATE(self);
 
     if (priv->auditd_fd >= 0) {
-        int r;
-
-        r = audit_log_user_message(priv->auditd_fd,
-                                   AUDIT_USYS_CONFIG,
-                                   build_message(&strbuf, BACKEND_AUDITD, fields),
-                                   NULL,
-                                   NULL,
-                                   NULL,
-                                   success);
-        (void) r;
+        /* The fields only borrow the caller's strings, so the record must be
+         * formatted now. The actual write happens from an idle handler: audit
+         * logging is called from activation paths and must not stall them on
+         * the audit socket. */
+        _auditd_message_queue(self, build_message(&strbuf, BACKEND_AUDITD, fields), success);
     }
 #endif
 
@@ -425,6 +488,7 @@ init_auditd(NMAuditManager *self)
         }
     } else {
         if (priv->auditd_fd >= 0) {
+            _auditd_message_flush(self);
             audit_close(priv->auditd_fd);
             priv->auditd_fd = -1;
             _LOGD(LOGD_CORE, "socket closed");
@@ -452,6 +516,8 @@ nm_audit_manager_init(NMAuditManager *self)
 #if HAVE_LIBAUDIT
     NMAuditManagerPrivate *priv = NM_AUDIT_MANAGER_GET_PRIVATE(self);
 
+    c_list_init(&priv->auditd_msg_lst_head);
+
     priv->config = g_object_ref(nm_config_get());
     g_signal_connect(G_OBJECT(priv->config),
                      NM_CONFIG_SIGNAL_CONFIG_CHANGED,
@@ -475,6 +541,10 @@ dispose(GObject *object)
         g_clear_object(&priv->config);
     }
 
+    /* flush pending records while the socket is still open, so that no
+     * audit event is lost on shutdown. */
+    _auditd_message_flush(self);
+
     if (priv->auditd_fd >= 0) {
         audit_close(priv->auditd_fd);
         priv->auditd_fd = -1;
@@ -21,6 +21,11 @@
 #define CANCELLATION_ID_PREFIX  "cancellation-id-"
 #define CANCELLATION_TIMEOUT_MS 5000
 
+/* polkit emits "Changed" when rules or temporary authorizations change, which
+ * drops the cache. The TTL only bounds staleness against conditions that
+ * don't trigger "Changed" (like a session becoming inactive). */
+#define CACHED_DECISION_TTL_MSEC 15000
+
 /*****************************************************************************/
 
 NM_GOBJECT_PROPERTIES_DEFINE_BASE(PROP_POLKIT_ENABLED, );
@@ -37,6 +42,7 @@ typedef struct {
     GDBusConnection *dbus_connection;
     GCancellable    *main_cancellable;
     char            *name_owner;
+    GHashTable      *cached_decisions;
     guint64          call_numid_counter;
     guint            changed_id;
     guint            name_owner_changed_id;
@@ -136,15 +142,106 @@ typedef enum {
     POLKIT_CHECK_AUTHORIZATION_FLAGS_ALLOW_USER_INTERACTION = (1 << 0),
 } PolkitCheckAuthorizationFlags;
 
+/*****************************************************************************/
+
+/* A cached CheckAuthorization() decision. The subject is identified by the
+ * unique D-Bus name of the requester: unique names are never reused on a bus
+ * instance, so - unlike a (pid,uid) pair - the key cannot accidentally match
+ * a recycled process. */
+typedef struct {
+    char  *dbus_sender;
+    char  *action_id;
+    gint64 expires_at_msec;
+    bool   allow_user_interaction : 1;
+    bool   is_authorized : 1;
+} AuthCacheEntry;
+
+static guint
+_cache_entry_hash(gconstpointer ptr)
+{
+    const AuthCacheEntry *entry = ptr;
+    NMHashState           h;
+
+    nm_hash_init(&h, 437036382u);
+    nm_hash_update_str(&h, entry->dbus_sender);
+    nm_hash_update_str(&h, entry->action_id);
+    nm_hash_update_val(&h, (bool) entry->allow_user_interaction);
+    return nm_hash_complete(&h);
+}
+
+static gboolean
+_cache_entry_equal(gconstpointer ptr_a, gconstpointer ptr_b)
+{
+    const AuthCacheEntry *a = ptr_a;
+    const AuthCacheEntry *b = ptr_b;
+
+    return nm_streq(a->dbus_sender, b->dbus_sender) && nm_streq(a->action_id, b->action_id)
+           && a->allow_user_interaction == b->allow_user_interaction;
+}
+
+static void
+_cache_entry_free(AuthCacheEntry *entry)
+{
+    g_free(entry->dbus_sender);
+    g_free(entry->action_id);
+    g_slice_free(AuthCacheEntry, entry);
+}
+
+static void
+_cached_decisions_clear(NMAuthManager *self)
+{
+    NMAuthManagerPrivate *priv = NM_AUTH_MANAGER_GET_PRIVATE(self);
+
+    nm_clear_pointer(&priv->cached_decisions, g_hash_table_destroy);
+}
+
+static const AuthCacheEntry *
+_cached_decision_lookup(NMAuthManager *self,
+                        const char    *dbus_sender,
+                        const char    *action_id,
+                        gboolean       allow_user_interaction)
+{
+    NMAuthManagerPrivate *priv  = NM_AUTH_MANAGER_GET_PRIVATE(self);
+    const AuthCacheEntry  needle = {
+        .dbus_sender            = (char *) dbus_sender,
+        .action_id              = (char *) action_id,
+        .allow_user_interaction = !!allow_user_interaction,
+    };
+    AuthCacheEntry *entry;
+
+    if (!priv->cached_decisions)
+        return NULL;
+
+    entry = g_hash_table_lookup(priv->cached_decisions, &needle);
+    if (!entry)
+        return NULL;
+
+    if (nm_utils_get_monotonic_timestamp_msec() >= entry->expires_at_msec) {
+        g_hash_table_remove(priv->cached_decisions, entry);
+        return NULL;
+    }
+
+    return entry;
+}
+
+/*****************************************************************************/
+
 struct _NMAuthManagerCallId {
     CList                                   calls_lst;
     NMAuthManager                          *self;
     GCancellable                           *dbus_cancellable;
     NMAuthManagerCheckAuthorizationCallback callback;
     gpointer                                user_data;
-    guint64                                 call_numid;
-    guint                                   idle_id;
-    bool                                    idle_is_authorized : 1;
+
+    /* set when a pending D-Bus request should populate the decision cache
+     * on completion. */
+    char *cache_dbus_sender;
+    char *cache_action_id;
+
+    guint64 call_numid;
+    guint   idle_id;
+    bool    cache_allow_user_interaction : 1;
+    bool    idle_is_authorized : 1;
 };
 
 #define cancellation_id_to_str_a(call_numid)                     \
@@ -165,10 +262,39 @@ _call_id_free(NMAuthManagerCallId *call_id)
         return;
     }
 
+    g_free(call_id->cache_dbus_sender);
+    g_free(call_id->cache_action_id);
     g_object_unref(call_id->self);
     g_slice_free(NMAuthManagerCallId, call_id);
 }
 
+static void
+_cached_decision_store(NMAuthManager *self, NMAuthManagerCallId *call_id, gboolean is_authorized)
+{
+    NMAuthManagerPrivate *priv = NM_AUTH_MANAGER_GET_PRIVATE(self);
+    AuthCacheEntry       *entry;
+
+    nm_assert(call_id->cache_dbus_sender);
+    nm_assert(call_id->cache_action_id);
+
+    if (!priv->cached_decisions) {
+        priv->cached_decisions = g_hash_table_new_full(_cache_entry_hash,
+                                                       _cache_entry_equal,
+                                                       (GDestroyNotify) _cache_entry_free,
+                                                       NULL);
+    }
+
+    entry  = g_slice_new(AuthCacheEntry);
+    *entry = (AuthCacheEntry){
+        .dbus_sender            = g_steal_pointer(&call_id->cache_dbus_sender),
+        .action_id              = g_steal_pointer(&call_id->cache_action_id),
+        .allow_user_interaction = call_id->cache_allow_user_interaction,
+        .is_authorized          = is_authorized,
+        .expires_at_msec = nm_utils_get_monotonic_timestamp_msec() + CACHED_DECISION_TTL_MSEC,
+    };
+    g_hash_table_add(priv->cached_decisions, entry);
+}
+
 static void
 _call_id_invoke_callback(NMAuthManagerCallId *call_id,
                          gboolean             is_authorized,
@@ -260,6 +386,10 @@ _call_check_authorize_cb(GObject *proxy, GAsyncResult *res, gpointer user_data)
     if (!error) {
         g_variant_get(value, "((bb@a{ss}))", &is_authorized, &is_challenge, NULL);
         _LOG2T(call_id, "completed: authorized=%d, challenge=%d", is_authorized, is_challenge);
+
+        /* challenge results are not definite decisions and don't get cached. */
+        if (call_id->cache_dbus_sender && !is_challenge)
+            _cached_decision_store(self, call_id, is_authorized);
     } else
         _LOG2T(call_id, "completed: failed: %s", error->message);
 
@@ -358,10 +488,32 @@ nm_auth_manager_check_authorization(NMAuthManager                          *self
         call_id->idle_is_authorized = (priv->auth_polkit_mode == NM_AUTH_POLKIT_MODE_ALLOW_ALL);
         call_id->idle_id            = g_idle_add(_call_on_idle, call_id);
     } else {
-        GVariant       *parameters;
-        GVariantBuilder builder;
-        GVariant       *subject_value;
-        GVariant       *details_value;
+        GVariant             *parameters;
+        GVariantBuilder       builder;
+        GVariant             *subject_value;
+        GVariant             *details_value;
+        const char           *dbus_sender;
+        const AuthCacheEntry *cached;
+
+        dbus_sender = nm_auth_subject_get_unix_process_dbus_sender(subject);
+
+        if (dbus_sender) {
+            cached = _cached_decision_lookup(self, dbus_sender, action_id, allow_user_interaction);
+            if (cached) {
+                _LOG2T(call_id,
+                       "CheckAuthorization(%s), subject=%s (cached: %s)",
+                       action_id,
+                       nm_auth_subject_to_string(subject, subject_buf, sizeof(subject_buf)),
+                       cached->is_authorized ? "authorized" : "not authorized");
+                call_id->idle_is_authorized = cached->is_authorized;
+                call_id->idle_id            = g_idle_add(_call_on_idle, call_id);
+                return call_id;
+            }
+
+            call_id->cache_dbus_sender            = g_strdup(dbus_sender);
+            call_id->cache_action_id              = g_strdup(action_id);
+            call_id->cache_allow_user_interaction = !!allow_user_interaction;
+        }
 
         subject_value = nm_auth_subject_unix_to_polkit_gvariant(subject);
         nm_assert(g_variant_is_floating(subject_value));
@@ -445,8 +597,10 @@ changed_signal_cb(GDBusConnection *connection,
 
     _LOGD("dbus-signal: \"Changed\" notification%s", valid_sender ? "" : " (ignore)");
 
-    if (valid_sender)
+    if (valid_sender) {
+        _cached_decisions_clear(self);
         _emit_changed_signal(self);
+    }
 }
 
 static void
@@ -469,6 +623,7 @@ _name_owner_changed(NMAuthManager *self, const char *name_owner, gboolean is_ini
     if (is_changed) {
         old_name_owner   = g_steal_pointer(&priv->name_owner);
         priv->name_owner = g_strdup(name_owner);
+        _cached_decisions_clear(self);
     } else {
         if (!is_initial)
             return;
@@ -706,6 +861,8 @@ dispose(GObject *object)
 
     priv->disposing = TRUE;
 
+    _cached_decisions_clear(self);
+
     nm_clear_g_cancellable(&priv->main_cancellable);
 
     nm_clear_g_dbus_connection_signal(priv->dbus_connection, &priv->name_owner_changed_id);
@@ -19,6 +19,7 @@
 #include "settings/nm-settings-connection.h"
 #include "nm-simple-connection.h"
 #include "nm-utils.h"
+#include "libnm-core-intern/nm-core-internal.h"
 
 /*****************************************************************************/
 
@@ -592,9 +593,16 @@ device_checkpoint_create(NMCheckpoint *checkpoint, NMDevice *device)
         settings_connection = nm_act_request_get_settings_connection(act_request);
         applied_connection  = nm_act_request_get_applied_connection(act_request);
 
-        dev_checkpoint->applied_connection  = nm_simple_connection_new_clone(applied_connection);
-        dev_checkpoint->settings_connection = nm_simple_connection_new_clone(
-            nm_settings_connection_get_connection(settings_connection));
+        /* The applied connection can be modified in place on reapply
+         * (see FIXME(applied-connection-immutable)), hence a deep copy is
+         * needed to freeze its content. The settings connection's
+         * NMConnection on the other hand is unchanging: on profile update a
+         * new instance gets swapped in, while our reference continues to
+         * point to the content from checkpoint time. */
+        dev_checkpoint->applied_connection = nm_simple_connection_new_clone(applied_connection);
+        dev_checkpoint->settings_connection =
+            g_object_ref(nm_settings_connection_get_connection(settings_connection));
+        nm_assert_connection_unchanging(dev_checkpoint->settings_connection);
         dev_checkpoint->ac_version_id =
             nm_active_connection_version_id_get(NM_ACTIVE_CONNECTION(act_request));
         dev_checkpoint->activation_reason =
@@ -1978,6 +1978,77 @@ _match_section_infos_construct(GKeyFile *keyfile, gboolean is_device)
 
 /*****************************************************************************/
 
+static gboolean
+_diff_match_group_relevant(const char *group)
+{
+    return NM_STR_HAS_PREFIX(group, NM_CONFIG_KEYFILE_GROUPPREFIX_DEVICE)
+           || NM_STR_HAS_PREFIX(group, NM_CONFIG_KEYFILE_GROUPPREFIX_CONNECTION);
+}
+
+static gboolean
+_diff_group_equal(GKeyFile *kf_a, GKeyFile *kf_b, const char *group)
+{
+    gs_strfreev char **keys_a = NULL;
+    gs_strfreev char **keys_b = NULL;
+    gsize              i;
+
+    keys_a = g_key_file_get_keys(kf_a, group, NULL, NULL);
+    keys_b = g_key_file_get_keys(kf_b, group, NULL, NULL);
+
+    if (NM_PTRARRAY_LEN(keys_a) != NM_PTRARRAY_LEN(keys_b))
+        return FALSE;
+
+    for (i = 0; keys_a && keys_a[i]; i++) {
+        gs_free char *val_a = NULL;
+        gs_free char *val_b = NULL;
+
+        if (!nm_streq(keys_a[i], keys_b[i]))
+            return FALSE;
+        val_a = g_key_file_get_value(kf_a, group, keys_a[i], NULL);
+        val_b = g_key_file_get_value(kf_b, group, keys_b[i], NULL);
+        if (!nm_streq0(val_a, val_b))
+            return FALSE;
+    }
+    return TRUE;
+}
+
+/* compare the [device*] and [connection*] sections of the merged keyfiles.
+ * The order of the sections matters for match-spec lookup, hence compare
+ * the (ordered) sequence of matching groups, not just the set. */
+static gboolean
+_diff_match_sections_equal(GKeyFile *kf_a, GKeyFile *kf_b)
+{
+    gs_strfreev char **groups_a = NULL;
+    gs_strfreev char **groups_b = NULL;
+    gsize              i_a      = 0;
+    gsize              i_b      = 0;
+
+    groups_a = g_key_file_get_groups(kf_a, NULL);
+    groups_b = g_key_file_get_groups(kf_b, NULL);
+
+    for (;;) {
+        const char *g_a;
+        const char *g_b;
+
+        while (groups_a && groups_a[i_a] && !_diff_match_group_relevant(groups_a[i_a]))
+            i_a++;
+        while (groups_b && groups_b[i_b] && !_diff_match_group_relevant(groups_b[i_b]))
+            i_b++;
+
+        g_a = groups_a ? groups_a[i_a] : NULL;
+        g_b = groups_b ? groups_b[i_b] : NULL;
+
+        if (!g_a || !g_b)
+            return !g_a && !g_b;
+        if (!nm_streq(g_a, g_b))
+            return FALSE;
+        if (!_diff_group_equal(kf_a, kf_b, g_a))
+            return FALSE;
+        i_a++;
+        i_b++;
+    }
+}
+
 NMConfigChangeFlags
 nm_config_data_diff(NMConfigData *old_data, NMConfigData *new_data)
 {
@@ -1996,6 +2067,10 @@ nm_config_data_diff(NMConfigData *old_data, NMConfigData *new_data)
     if (!_nm_keyfile_equal(priv_old->keyfile_intern, priv_new->keyfile_intern, TRUE))
         changes |= NM_CONFIG_CHANGE_VALUES | NM_CONFIG_CHANGE_VALUES_INTERN;
 
+    if (NM_FLAGS_HAS(changes, NM_CONFIG_CHANGE_VALUES)
+        && !_diff_match_sections_equal(priv_old->keyfile, priv_new->keyfile))
+        changes |= NM_CONFIG_CHANGE_DEVICE_MATCH;
+
     if (!nm_streq0(nm_config_data_get_config_main_file(old_data),
                    nm_config_data_get_config_main_file(new_data))
         || !nm_streq0(nm_config_data_get_config_description(old_data),
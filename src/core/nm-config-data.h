@@ -117,6 +117,11 @@ typedef enum {
     /* configuration regarding global dns-config changed */
     NM_CONFIG_CHANGE_GLOBAL_DNS_CONFIG = (1L << 18),
 
+    /* configuration in the [device*] or [connection*] match sections
+     * changed. Per-device subscribers can skip re-evaluating their
+     * match-spec based settings unless this is set. */
+    NM_CONFIG_CHANGE_DEVICE_MATCH = (1L << 19),
+
 } NMConfigChangeFlags;
 
 typedef struct _NMConfigDataClass NMConfigDataClass;
@@ -845,14 +845,17 @@ static const ConfigGroup config_groups[] = {
         .keys  = NM_MAKE_STRV(NM_CONFIG_KEYFILE_KEY_MAIN_ASSUME_IPV6LL_ONLY,
                              NM_CONFIG_KEYFILE_KEY_MAIN_AUTH_POLKIT,
                              NM_CONFIG_KEYFILE_KEY_MAIN_AUTOCONNECT_RETRIES_DEFAULT,
+                             NM_CONFIG_KEYFILE_KEY_MAIN_BUSY_POLL_USEC,
                              NM_CONFIG_KEYFILE_KEY_MAIN_CONFIGURE_AND_QUIT,
                              NM_CONFIG_KEYFILE_KEY_MAIN_DEBUG,
+                             NM_CONFIG_KEYFILE_KEY_MAIN_DEVICE_REALIZE_ORDER,
                              NM_CONFIG_KEYFILE_KEY_MAIN_DHCP,
                              NM_CONFIG_KEYFILE_KEY_MAIN_DNS,
                              NM_CONFIG_KEYFILE_KEY_MAIN_FIREWALL_BACKEND,
                              NM_CONFIG_KEYFILE_KEY_MAIN_HOSTNAME_MODE,
                              NM_CONFIG_KEYFILE_KEY_MAIN_IGNORE_CARRIER,
                              NM_CONFIG_KEYFILE_KEY_MAIN_IWD_CONFIG_PATH,
+                             NM_CONFIG_KEYFILE_KEY_MAIN_MAX_ACTIVATIONS_PER_CLIENT,
                              NM_CONFIG_KEYFILE_KEY_MAIN_MIGRATE_IFCFG_RH,
                              NM_CONFIG_KEYFILE_KEY_MAIN_MONITOR_CONNECTION_FILES,
                              NM_CONFIG_KEYFILE_KEY_MAIN_NO_AUTO_DEFAULT,
@@ -864,7 +867,9 @@ static const ConfigGroup config_groups[] = {
         .group = NM_CONFIG_KEYFILE_GROUP_LOGGING,
         .keys  = NM_MAKE_STRV(NM_CONFIG_KEYFILE_KEY_LOGGING_AUDIT,
                              NM_CONFIG_KEYFILE_KEY_LOGGING_BACKEND,
+                             NM_CONFIG_KEYFILE_KEY_LOGGING_DEVICE_FILTER,
                              NM_CONFIG_KEYFILE_KEY_LOGGING_DOMAINS,
+                             NM_CONFIG_KEYFILE_KEY_LOGGING_FLIGHT_RECORDER_SIZE,
                              NM_CONFIG_KEYFILE_KEY_LOGGING_LEVEL, ),
     },
     {
@@ -2915,7 +2920,8 @@ NM_UTILS_FLAGS2STR_DEFINE(nm_config_change_flags_to_string,
                           NM_UTILS_FLAGS2STR(NM_CONFIG_CHANGE_DNS_MODE, "dns-mode"),
                           NM_UTILS_FLAGS2STR(NM_CONFIG_CHANGE_RC_MANAGER, "rc-manager"),
                           NM_UTILS_FLAGS2STR(NM_CONFIG_CHANGE_GLOBAL_DNS_CONFIG,
-                                             "global-dns-config"), );
+                                             "global-dns-config"),
+                          NM_UTILS_FLAGS2STR(NM_CONFIG_CHANGE_DEVICE_MATCH, "device-match"), );
 
 static void
 _set_config_data(NMConfig *self, NMConfigData *new_data, NMConfigChangeFlags reload_flags)
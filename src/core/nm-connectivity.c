@@ -74,13 +74,9 @@ struct _NMConnectivityCheckHandle {
         ConConfig *con_config;
 
         GCancellable      *resolve_cancellable;
-        CURLM             *curl_mhandle;
         CURL              *curl_ehandle;
-        struct curl_slist *request_headers;
         struct curl_slist *hosts;
 
-        GSource *curl_timer;
-
         gsize response_good_cnt;
     } concheck;
 #endif
@@ -110,6 +106,16 @@ typedef struct {
     ConConfig *con_config;
     guint      interval;
 
+#if WITH_CONCHECK
+    /* One multi handle shared by all pending checks. Aside from driving all
+     * transfers with one timer, this keeps libcurl's connection cache alive
+     * between checks, so that periodic rechecks can reuse the connection to
+     * the probe endpoint (connections are matched also by the bound
+     * interface, so checks on different devices never share a socket). */
+    CURLM   *curl_mhandle;
+    GSource *curl_timer;
+#endif
+
     bool enabled : 1;
     bool uri_valid : 1;
 } NMConnectivityPrivate;
@@ -232,16 +238,13 @@ cb_data_complete(NMConnectivityCheckHandle *cb_data,
         curl_easy_setopt(cb_data->concheck.curl_ehandle, CURLOPT_HEADERFUNCTION, NULL);
         curl_easy_setopt(cb_data->concheck.curl_ehandle, CURLOPT_HEADERDATA, NULL);
         curl_easy_setopt(cb_data->concheck.curl_ehandle, CURLOPT_PRIVATE, NULL);
-        curl_easy_setopt(cb_data->concheck.curl_ehandle, CURLOPT_HTTPHEADER, NULL);
 
-        curl_multi_remove_handle(cb_data->concheck.curl_mhandle, cb_data->concheck.curl_ehandle);
+        curl_multi_remove_handle(NM_CONNECTIVITY_GET_PRIVATE(self)->curl_mhandle,
+                                 cb_data->concheck.curl_ehandle);
         curl_easy_cleanup(cb_data->concheck.curl_ehandle);
-        curl_multi_cleanup(cb_data->concheck.curl_mhandle);
 
-        curl_slist_free_all(cb_data->concheck.request_headers);
         curl_slist_free_all(cb_data->concheck.hosts);
     }
-    nm_clear_g_source_inst(&cb_data->concheck.curl_timer);
     nm_clear_g_cancellable(&cb_data->concheck.resolve_cancellable);
 #endif
 
@@ -404,29 +407,29 @@ _con_curl_check_connectivity(CURLM *mhandle, int sockfd, int ev_bitmask)
 static gboolean
 _con_curl_timeout_cb(gpointer user_data)
 {
-    NMConnectivityCheckHandle *cb_data = user_data;
+    NMConnectivity        *self = user_data;
+    NMConnectivityPrivate *priv = NM_CONNECTIVITY_GET_PRIVATE(self);
 
-    nm_clear_g_source_inst(&cb_data->concheck.curl_timer);
-    _con_curl_check_connectivity(cb_data->concheck.curl_mhandle, CURL_SOCKET_TIMEOUT, 0);
-    _complete_queued(cb_data->self);
+    nm_clear_g_source_inst(&priv->curl_timer);
+    _con_curl_check_connectivity(priv->curl_mhandle, CURL_SOCKET_TIMEOUT, 0);
+    _complete_queued(self);
     return G_SOURCE_CONTINUE;
 }
 
 static int
 multi_timer_cb(CURLM *multi, long timeout_msec, void *userdata)
 {
-    NMConnectivityCheckHandle *cb_data = userdata;
+    NMConnectivity        *self = userdata;
+    NMConnectivityPrivate *priv = NM_CONNECTIVITY_GET_PRIVATE(self);
 
-    nm_clear_g_source_inst(&cb_data->concheck.curl_timer);
-    if (timeout_msec != -1) {
-        cb_data->concheck.curl_timer =
-            nm_g_timeout_add_source(timeout_msec, _con_curl_timeout_cb, cb_data);
-    }
+    nm_clear_g_source_inst(&priv->curl_timer);
+    if (timeout_msec != -1)
+        priv->curl_timer = nm_g_timeout_add_source(timeout_msec, _con_curl_timeout_cb, self);
     return 0;
 }
 
 typedef struct {
-    NMConnectivityCheckHandle *cb_data;
+    NMConnectivity *self;
 
     GSource *source;
 
@@ -442,11 +445,11 @@ typedef struct {
 static gboolean
 _con_curl_socketevent_cb(int fd, GIOCondition condition, gpointer user_data)
 {
-    ConCurlSockData           *fdp           = user_data;
-    NMConnectivityCheckHandle *cb_data       = fdp->cb_data;
-    int                        action        = 0;
-    gboolean                   fdp_destroyed = FALSE;
-    gboolean                   success;
+    ConCurlSockData *fdp           = user_data;
+    NMConnectivity  *self          = fdp->self;
+    int              action        = 0;
+    gboolean         fdp_destroyed = FALSE;
+    gboolean         success;
 
     if (condition & G_IO_IN)
         action |= CURL_CSELECT_IN;
@@ -458,7 +461,8 @@ _con_curl_socketevent_cb(int fd, GIOCondition condition, gpointer user_data)
     nm_assert(!fdp->destroy_notify);
     fdp->destroy_notify = &fdp_destroyed;
 
-    success = _con_curl_check_connectivity(cb_data->concheck.curl_mhandle, fd, action);
+    success =
+        _con_curl_check_connectivity(NM_CONNECTIVITY_GET_PRIVATE(self)->curl_mhandle, fd, action);
 
     if (fdp_destroyed) {
         /* hups. fdp got invalidated during _con_curl_check_connectivity(). That's fine,
@@ -470,7 +474,7 @@ _con_curl_socketevent_cb(int fd, GIOCondition condition, gpointer user_data)
             nm_clear_g_source_inst(&fdp->source);
     }
 
-    _complete_queued(cb_data->self);
+    _complete_queued(self);
 
     return G_SOURCE_CONTINUE;
 }
@@ -478,8 +482,9 @@ _con_curl_socketevent_cb(int fd, GIOCondition condition, gpointer user_data)
 static int
 multi_socket_cb(CURL *e_handle, curl_socket_t fd, int what, void *userdata, void *socketp)
 {
-    NMConnectivityCheckHandle *cb_data = userdata;
-    ConCurlSockData           *fdp     = socketp;
+    NMConnectivity        *self = userdata;
+    NMConnectivityPrivate *priv = NM_CONNECTIVITY_GET_PRIVATE(self);
+    ConCurlSockData       *fdp  = socketp;
 
     (void) _NM_ENSURE_TYPE(int, fd);
 
@@ -488,7 +493,7 @@ multi_socket_cb(CURL *e_handle, curl_socket_t fd, int what, void *userdata, void
             if (fdp->destroy_notify)
                 *fdp->destroy_notify = TRUE;
             nm_clear_g_source_inst(&fdp->source);
-            curl_multi_assign(cb_data->concheck.curl_mhandle, fd, NULL);
+            curl_multi_assign(priv->curl_mhandle, fd, NULL);
             g_slice_free(ConCurlSockData, fdp);
         }
     } else {
@@ -497,9 +502,9 @@ multi_socket_cb(CURL *e_handle, curl_socket_t fd, int what, void *userdata, void
         if (!fdp) {
             fdp  = g_slice_new(ConCurlSockData);
             *fdp = (ConCurlSockData){
-                .cb_data = cb_data,
+                .self = self,
             };
-            curl_multi_assign(cb_data->concheck.curl_mhandle, fd, fdp);
+            curl_multi_assign(priv->curl_mhandle, fd, fdp);
         } else
             nm_clear_g_source_inst(&fdp->source);
 
@@ -711,6 +716,28 @@ _idle_cb(gpointer user_data)
 }
 
 #if WITH_CONCHECK
+static CURLM *
+_con_curl_multi_get(NMConnectivity *self)
+{
+    NMConnectivityPrivate *priv = NM_CONNECTIVITY_GET_PRIVATE(self);
+    CURLM                 *mhandle;
+
+    if (G_LIKELY(priv->curl_mhandle))
+        return priv->curl_mhandle;
+
+    mhandle = curl_multi_init();
+    if (!mhandle)
+        return NULL;
+
+    curl_multi_setopt(mhandle, CURLMOPT_SOCKETFUNCTION, multi_socket_cb);
+    curl_multi_setopt(mhandle, CURLMOPT_SOCKETDATA, self);
+    curl_multi_setopt(mhandle, CURLMOPT_TIMERFUNCTION, multi_timer_cb);
+    curl_multi_setopt(mhandle, CURLMOPT_TIMERDATA, self);
+
+    priv->curl_mhandle = mhandle;
+    return mhandle;
+}
+
 static void
 do_curl_request(NMConnectivityCheckHandle *cb_data, const char *hosts)
 {
@@ -720,7 +747,7 @@ do_curl_request(NMConnectivityCheckHandle *cb_data, const char *hosts)
 
     _LOG2T("set curl resolve list to '%s'", hosts);
 
-    mhandle = curl_multi_init();
+    mhandle = _con_curl_multi_get(cb_data->self);
     if (!mhandle) {
         cb_data_complete(cb_data, NM_CONNECTIVITY_ERROR, "curl error");
         return;
@@ -728,22 +755,14 @@ do_curl_request(NMConnectivityCheckHandle *cb_data, const char *hosts)
 
     ehandle = curl_easy_init();
     if (!ehandle) {
-        curl_multi_cleanup(mhandle);
         cb_data_complete(cb_data, NM_CONNECTIVITY_ERROR, "curl error");
         return;
     }
 
     cb_data->concheck.hosts = curl_slist_append(NULL, hosts);
 
-    cb_data->concheck.curl_mhandle    = mhandle;
-    cb_data->concheck.curl_ehandle    = ehandle;
-    cb_data->concheck.request_headers = curl_slist_append(NULL, "Connection: close");
-    cb_data->timeout_source           = nm_g_timeout_add_seconds_source(20, _timeout_cb, cb_data);
-
-    curl_multi_setopt(mhandle, CURLMOPT_SOCKETFUNCTION, multi_socket_cb);
-    curl_multi_setopt(mhandle, CURLMOPT_SOCKETDATA, cb_data);
-    curl_multi_setopt(mhandle, CURLMOPT_TIMERFUNCTION, multi_timer_cb);
-    curl_multi_setopt(mhandle, CURLMOPT_TIMERDATA, cb_data);
+    cb_data->concheck.curl_ehandle = ehandle;
+    cb_data->timeout_source        = nm_g_timeout_add_seconds_source(20, _timeout_cb, cb_data);
 
     switch (cb_data->addr_family) {
     case AF_INET:
@@ -766,7 +785,6 @@ do_curl_request(NMConnectivityCheckHandle *cb_data, const char *hosts)
     curl_easy_setopt(ehandle, CURLOPT_HEADERFUNCTION, easy_header_cb);
     curl_easy_setopt(ehandle, CURLOPT_HEADERDATA, cb_data);
     curl_easy_setopt(ehandle, CURLOPT_PRIVATE, cb_data);
-    curl_easy_setopt(ehandle, CURLOPT_HTTPHEADER, cb_data->concheck.request_headers);
     curl_easy_setopt(ehandle, CURLOPT_INTERFACE, cb_data->ifspec);
     curl_easy_setopt(ehandle, CURLOPT_RESOLVE, cb_data->concheck.hosts);
     curl_easy_setopt(ehandle, CURLOPT_IPRESOLVE, resolve);
@@ -783,6 +801,9 @@ do_curl_request(NMConnectivityCheckHandle *cb_data, const char *hosts)
         curl_easy_setopt(ehandle, CURLOPT_VERBOSE, 1L);
     }
 
+    /* Note that we don't send "Connection: close" (as we used to), so that
+     * the connection can stay in the shared multi handle's cache and be
+     * reused by the next periodic check on the same interface. */
     curl_multi_add_handle(mhandle, ehandle);
 }
 
@@ -1374,6 +1395,8 @@ dispose(GObject *object)
     nm_clear_pointer(&priv->con_config, _con_config_unref);
 
 #if WITH_CONCHECK
+    nm_clear_g_source_inst(&priv->curl_timer);
+    nm_clear_pointer(&priv->curl_mhandle, curl_multi_cleanup);
     curl_global_cleanup();
 #endif
 
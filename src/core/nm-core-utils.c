@@ -5237,6 +5237,21 @@ helper_cancelled(GObject *object, gpointer user_data)
     helper_complete(info, error);
 }
 
+/* Spawns one nm-daemon-helper process per request, on purpose. A persistent
+ * helper with a pipelined request protocol looks cheaper on paper, but:
+ *
+ * - the point of the helper is to keep NSS modules out of the daemon. A
+ *   long-lived helper would accumulate NSS module state (cached resolv.conf,
+ *   nsswitch.conf, loaded plugins) that per-request spawning discards for
+ *   free;
+ * - the helper performs blocking calls (getnameinfo()). A single persistent
+ *   process cannot really serve multiple outstanding requests, it would just
+ *   queue them behind the current lookup, and one hung DNS query would stall
+ *   the whole queue. Here a hung lookup only costs its own process, which
+ *   the timeout below kills without affecting other requests;
+ * - a pool of persistent helpers would fix that, but then idle helpers pin
+ *   memory and the lifecycle management outweighs the ~2-3ms fork/exec of
+ *   this small binary. */
 void
 nm_utils_spawn_helper(const char *const  *args,
                       GCancellable       *cancellable,
@@ -14,6 +14,8 @@
 
 #include "c-list/src/c-list.h"
 #include "libnm-glib-aux/nm-c-list.h"
+#include "libnm-glib-aux/nm-perf-counter.h"
+#include "libnm-glib-aux/nm-perf-trace.h"
 #include "nm-dbus-interface.h"
 #include "libnm-core-intern/nm-core-internal.h"
 #include "libnm-std-aux/nm-dbus-compat.h"
@@ -43,6 +45,16 @@ typedef struct {
 
 typedef struct {
     GVariant *value;
+
+    /* the cached @value (if any) is stale and must be refetched before use. */
+    bool dirty : 1;
+
+    /* the property changed since the last PropertiesChanged emission. Only
+     * _props_changed_flush_reg_data() may clear this. It is tracked
+     * separately from @dirty, because a Get/GetAll/GetManagedObjects served
+     * between the notify and the flush refreshes the cached value (clearing
+     * @dirty), which must not cancel the pending signal. */
+    bool signal_pending : 1;
 } PropertyCacheData;
 
 typedef struct {
@@ -51,7 +63,17 @@ typedef struct {
     NMDBusObjectClass *klass;
     guint              info_idx;
     guint              registration_id;
-    PropertyCacheData  property_cache[];
+
+    /* linked in NMDBusManagerPrivate.changed_registrations_lst_head while
+     * any property in @property_cache is dirty. */
+    CList changed_lst;
+
+    /* the assembled "a{sv}" of all properties of the interface, as handed
+     * out by GetManagedObjects and InterfacesAdded. Cleared whenever any
+     * property gets dirty. */
+    GVariant *props_all_value;
+
+    PropertyCacheData property_cache[];
 } RegistrationData;
 
 /* we require that @path is the first member of NMDBusManagerData
@@ -80,6 +102,15 @@ typedef struct {
 
     CList caller_info_lst_head;
 
+    /* Property changes are not emitted right away. Instead, the affected
+     * registrations get linked here and one merged PropertiesChanged signal
+     * per (object, interface) goes out from an idle handler at default
+     * priority, that is, still within the current main loop iteration.
+     * That coalesces the flurry of per-property notifications during
+     * activation into few signals, with a bounded delay. */
+    CList    changed_registrations_lst_head;
+    GSource *props_changed_flush_source;
+
     guint objmgr_registration_id;
     bool  started : 1;
     bool  shutting_down : 1;
@@ -762,6 +793,20 @@ _reg_data_get_interface_info(RegistrationData *reg_data)
 
 /*****************************************************************************/
 
+NM_PERF_COUNTER_DEFINE(_perf_dbus_method_calls, "dbus.method-calls");
+
+/* Method calls are dispatched in arrival order; there is deliberately no
+ * priority queue that lets control calls (ActivateConnection & Co.) overtake
+ * read calls from monitoring tools. By the time we could reorder, GDBus has
+ * already received and unmarshalled the message, which is the bulk of the
+ * per-call cost. What remains of a read call is cheap: property Get/GetAll
+ * are answered synchronously from the property cache (see
+ * _obj_get_property()/props_all_value) without calling into device code.
+ * Control calls on the other hand return to the main loop almost
+ * immediately and perform their real work asynchronously, so their latency
+ * is dominated by that work, not by queueing behind reads. If scrapers ever
+ * really hurt, the lever is the D-Bus policy/rate at the sender, not
+ * reordering here. */
 static void
 dbus_vtable_method_call(GDBusConnection       *connection,
                         const char            *sender,
@@ -780,6 +825,8 @@ dbus_vtable_method_call(GDBusConnection       *connection,
     const NMDBusMethodInfoExtended    *method_info    = NULL;
     gboolean                           on_same_interface;
 
+    NM_PERF_COUNTER_INC(_perf_dbus_method_calls);
+
     on_same_interface = nm_streq(interface_info->parent.name, interface_name);
 
     /* handle property setter first... */
@@ -869,7 +916,7 @@ _obj_get_property(RegistrationData *reg_data, guint property_idx, gboolean refet
     property_info =
         (const NMDBusPropertyInfoExtended *) (interface_info->parent.properties[property_idx]);
 
-    if (refetch)
+    if (refetch || reg_data->property_cache[property_idx].dirty)
         nm_clear_g_variant(&reg_data->property_cache[property_idx].value);
     else {
         value = reg_data->property_cache[property_idx].value;
@@ -877,6 +924,8 @@ _obj_get_property(RegistrationData *reg_data, guint property_idx, gboolean refet
             goto out;
     }
 
+    reg_data->property_cache[property_idx].dirty = FALSE;
+
     value = nm_dbus_utils_get_property(G_OBJECT(reg_data->obj),
                                        property_info->parent.signature,
                                        property_info->property_name);
@@ -964,6 +1013,7 @@ _obj_register(NMDBusManager *self, NMDBusObject *obj)
             guint prop_len = NM_PTRARRAY_LEN(interface_info->parent.properties);
 
             reg_data = g_malloc0(sizeof(RegistrationData) + (sizeof(PropertyCacheData) * prop_len));
+            c_list_init(&reg_data->changed_lst);
 
             registration_id = g_dbus_connection_register_object(
                 priv->main_dbus_connection,
@@ -1038,6 +1088,11 @@ _obj_unregister(NMDBusManager *self, NMDBusObject *obj)
         guint                              i;
 
         g_variant_builder_add(&builder, "s", interface_info->parent.name);
+
+        /* pending property changes are dropped. The InterfacesRemoved signal
+         * below tells clients that the object is gone, which supersedes them. */
+        c_list_unlink(&reg_data->changed_lst);
+
         c_list_unlink_stale(&reg_data->registration_lst);
         if (!g_dbus_connection_unregister_object(priv->main_dbus_connection,
                                                  reg_data->registration_id))
@@ -1047,6 +1102,7 @@ _obj_unregister(NMDBusManager *self, NMDBusObject *obj)
             for (i = 0; interface_info->parent.properties[i]; i++)
                 nm_clear_g_variant(&reg_data->property_cache[i].value);
         }
+        nm_clear_g_variant(&reg_data->props_all_value);
 
         g_type_class_unref(reg_data->klass);
         g_free(reg_data);
@@ -1147,6 +1203,75 @@ _nm_dbus_manager_obj_unexport(NMDBusObject *obj)
     c_list_unlink(&obj->internal.objects_lst);
 }
 
+static void
+_props_changed_flush_reg_data(NMDBusManager *self, RegistrationData *reg_data)
+{
+    NMDBusManagerPrivate              *priv           = NM_DBUS_MANAGER_GET_PRIVATE(self);
+    const NMDBusInterfaceInfoExtended *interface_info = _reg_data_get_interface_info(reg_data);
+    gboolean                           has_properties = FALSE;
+    GVariantBuilder                    builder;
+    GVariantBuilder                    invalidated_builder;
+    GVariant                          *args;
+    guint                              i;
+
+    nm_assert(interface_info->parent.properties);
+
+    for (i = 0; interface_info->parent.properties[i]; i++) {
+        const NMDBusPropertyInfoExtended *property_info =
+            (const NMDBusPropertyInfoExtended *) interface_info->parent.properties[i];
+        gs_unref_variant GVariant *value = NULL;
+
+        if (!reg_data->property_cache[i].signal_pending)
+            continue;
+
+        reg_data->property_cache[i].signal_pending = FALSE;
+
+        value = _obj_get_property(reg_data, i, FALSE);
+
+        if (!has_properties) {
+            has_properties = TRUE;
+            g_variant_builder_init(&builder, G_VARIANT_TYPE("a{sv}"));
+        }
+        g_variant_builder_add(&builder, "{sv}", property_info->parent.name, value);
+    }
+
+    if (!has_properties)
+        return;
+
+    args = g_variant_builder_end(&builder);
+
+    nm_perf_trace(NM_PERF_TRACE_EVENT_DBUS_PROPS_CHANGED, 0, reg_data->obj->internal.path);
+
+    g_variant_builder_init(&invalidated_builder, G_VARIANT_TYPE("as"));
+    g_dbus_connection_emit_signal(
+        priv->main_dbus_connection,
+        NULL,
+        reg_data->obj->internal.path,
+        DBUS_INTERFACE_PROPERTIES,
+        "PropertiesChanged",
+        g_variant_new("(s@a{sv}as)", interface_info->parent.name, args, &invalidated_builder),
+        NULL);
+}
+
+static gboolean
+_props_changed_flush_cb(gpointer user_data)
+{
+    NMDBusManager        *self = user_data;
+    NMDBusManagerPrivate *priv = NM_DBUS_MANAGER_GET_PRIVATE(self);
+    RegistrationData     *reg_data;
+
+    nm_clear_g_source_inst(&priv->props_changed_flush_source);
+
+    while ((reg_data = c_list_first_entry(&priv->changed_registrations_lst_head,
+                                          RegistrationData,
+                                          changed_lst))) {
+        c_list_unlink(&reg_data->changed_lst);
+        _props_changed_flush_reg_data(self, reg_data);
+    }
+
+    return G_SOURCE_CONTINUE;
+}
+
 void
 _nm_dbus_manager_obj_notify(NMDBusObject *obj, guint n_pspecs, const GParamSpec *const *pspecs)
 {
@@ -1174,15 +1299,14 @@ _nm_dbus_manager_obj_notify(NMDBusObject *obj, guint n_pspecs, const GParamSpec
      * (interfaces x properties) is static and possibly small, this naive search is effectively
      * O(1). We might wanna introduce some index to lookup the properties in question faster.
      *
-     * The nice part of this implementation is however, that the order in which properties
-     * are added to the GVariant is strictly defined to be the order in which the D-Bus property-info
-     * is declared. Getting a defined ordering with some smart lookup would be hard. */
+     * We only mark the properties as dirty here. The merged PropertiesChanged
+     * signals get emitted from _props_changed_flush_cb(), with the values
+     * fetched at that point. If a property changes multiple times before the
+     * flush, only the last value goes out. Note that _obj_get_property()
+     * refetches dirty properties, so clients that call Get/GetAll (or
+     * GetManagedObjects) before the flush still see the current values. */
     c_list_for_each_entry (reg_data, &obj->internal.registration_lst_head, registration_lst) {
         const NMDBusInterfaceInfoExtended *interface_info = _reg_data_get_interface_info(reg_data);
-        gboolean                           has_properties = FALSE;
-        GVariantBuilder                    builder;
-        GVariantBuilder                    invalidated_builder;
-        GVariant                          *args;
 
         if (!interface_info->parent.properties)
             continue;
@@ -1192,36 +1316,29 @@ _nm_dbus_manager_obj_notify(NMDBusObject *obj, guint n_pspecs, const GParamSpec
                 (const NMDBusPropertyInfoExtended *) interface_info->parent.properties[i];
 
             for (p = 0; p < n_pspecs; p++) {
-                const GParamSpec          *pspec = pspecs[p];
-                gs_unref_variant GVariant *value = NULL;
-
-                if (!nm_streq(property_info->property_name, pspec->name))
+                if (!nm_streq(property_info->property_name, pspecs[p]->name))
                     continue;
 
-                value = _obj_get_property(reg_data, i, TRUE);
-
-                if (!has_properties) {
-                    has_properties = TRUE;
-                    g_variant_builder_init(&builder, G_VARIANT_TYPE("a{sv}"));
-                }
-                g_variant_builder_add(&builder, "{sv}", property_info->parent.name, value);
+                reg_data->property_cache[i].dirty          = TRUE;
+                reg_data->property_cache[i].signal_pending = TRUE;
+                nm_clear_g_variant(&reg_data->props_all_value);
+                if (c_list_is_empty(&reg_data->changed_lst))
+                    c_list_link_tail(&priv->changed_registrations_lst_head, &reg_data->changed_lst);
             }
         }
+    }
 
-        if (!has_properties)
-            continue;
-
-        args = g_variant_builder_end(&builder);
-
-        g_variant_builder_init(&invalidated_builder, G_VARIANT_TYPE("as"));
-        g_dbus_connection_emit_signal(
-            priv->main_dbus_connection,
-            NULL,
-            obj->internal.path,
-            DBUS_INTERFACE_PROPERTIES,
-            "PropertiesChanged",
-            g_variant_new("(s@a{sv}as)", interface_info->parent.name, args, &invalidated_builder),
-            NULL);
+    if (!c_list_is_empty(&priv->changed_registrations_lst_head)
+        && !priv->props_changed_flush_source) {
+        /* an idle source at G_PRIORITY_DEFAULT (not the lower idle default),
+         * so that the flush cannot be starved by other events and happens
+         * before the main loop polls again. */
+        priv->props_changed_flush_source =
+            nm_g_source_attach(nm_g_idle_source_new(G_PRIORITY_DEFAULT,
+                                                    _props_changed_flush_cb,
+                                                    self,
+                                                    NULL),
+                               NULL);
     }
 }
 
@@ -1247,6 +1364,8 @@ _nm_dbus_manager_obj_emit_signal(NMDBusObject                      *obj,
         return;
     }
 
+    nm_perf_trace(NM_PERF_TRACE_EVENT_DBUS_SIGNAL, 0, signal_info->name);
+
     g_dbus_connection_emit_signal(priv->main_dbus_connection,
                                   NULL,
                                   obj->internal.path,
@@ -1258,15 +1377,21 @@ _nm_dbus_manager_obj_emit_signal(NMDBusObject                      *obj,
 
 /*****************************************************************************/
 
-static GVariantBuilder *
-_obj_collect_properties_per_interface(NMDBusObject     *obj,
-                                      RegistrationData *reg_data,
-                                      GVariantBuilder  *builder)
+static GVariant *
+_obj_collect_properties_per_interface(NMDBusObject *obj, RegistrationData *reg_data)
 {
     const NMDBusInterfaceInfoExtended *interface_info = _reg_data_get_interface_info(reg_data);
+    GVariantBuilder                    builder;
     guint                              i;
 
-    g_variant_builder_init(builder, G_VARIANT_TYPE("a{sv}"));
+    /* the payload is identical for every caller until a property changes.
+     * Especially during client startup bursts, GetManagedObjects requests
+     * arrive back-to-back; serve them from the cached container instead of
+     * re-assembling the (possibly large) dictionary each time. */
+    if (reg_data->props_all_value)
+        return g_variant_ref(reg_data->props_all_value);
+
+    g_variant_builder_init(&builder, G_VARIANT_TYPE("a{sv}"));
     if (interface_info->parent.properties) {
         for (i = 0; interface_info->parent.properties[i]; i++) {
             const NMDBusPropertyInfoExtended *property_info =
@@ -1274,10 +1399,12 @@ _obj_collect_properties_per_interface(NMDBusObject     *obj,
             gs_unref_variant GVariant *variant = NULL;
 
             variant = _obj_get_property(reg_data, i, FALSE);
-            g_variant_builder_add(builder, "{sv}", property_info->parent.name, variant);
+            g_variant_builder_add(&builder, "{sv}", property_info->parent.name, variant);
         }
     }
-    return builder;
+
+    reg_data->props_all_value = g_variant_ref_sink(g_variant_builder_end(&builder));
+    return g_variant_ref(reg_data->props_all_value);
 }
 
 static GVariantBuilder *
@@ -1288,13 +1415,13 @@ _obj_collect_properties_all(NMDBusObject *obj, GVariantBuilder *builder)
     g_variant_builder_init(builder, G_VARIANT_TYPE("a{sa{sv}}"));
 
     c_list_for_each_entry (reg_data, &obj->internal.registration_lst_head, registration_lst) {
-        GVariantBuilder properties_builder;
+        gs_unref_variant GVariant *props = NULL;
 
-        g_variant_builder_add(
-            builder,
-            "{sa{sv}}",
-            _reg_data_get_interface_info(reg_data)->parent.name,
-            _obj_collect_properties_per_interface(obj, reg_data, &properties_builder));
+        props = _obj_collect_properties_per_interface(obj, reg_data);
+        g_variant_builder_add(builder,
+                              "{s@a{sv}}",
+                              _reg_data_get_interface_info(reg_data)->parent.name,
+                              props);
     }
 
     return builder;
@@ -1542,6 +1669,7 @@ nm_dbus_manager_init(NMDBusManager *self)
         g_hash_table_new((GHashFunc) _objects_by_path_hash, (GEqualFunc) _objects_by_path_equal);
 
     c_list_init(&priv->caller_info_lst_head);
+    c_list_init(&priv->changed_registrations_lst_head);
 }
 
 static void
@@ -1556,6 +1684,9 @@ dispose(GObject *object)
      * expect any remaining objects. */
     nm_assert(!priv->objects_by_path || g_hash_table_size(priv->objects_by_path) == 0);
     nm_assert(c_list_is_empty(&priv->objects_lst_head));
+    nm_assert(c_list_is_empty(&priv->changed_registrations_lst_head));
+
+    nm_clear_g_source_inst(&priv->props_changed_flush_source);
 
     nm_clear_pointer(&priv->objects_by_path, g_hash_table_destroy);
 
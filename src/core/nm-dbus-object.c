@@ -8,6 +8,7 @@
 #include "nm-dbus-object.h"
 
 #include "nm-dbus-manager.h"
+#include "nm-state-mirror.h"
 #include "NetworkManagerUtils.h"
 
 /*****************************************************************************/
@@ -252,6 +253,10 @@ dispatch_properties_changed(GObject *object, guint n_pspecs, GParamSpec **pspecs
     if (self->internal.path)
         _nm_dbus_manager_obj_notify(self, n_pspecs, (const GParamSpec *const *) pspecs);
 
+    /* cheap no-op unless the shared-memory state mirror is enabled; it
+     * only arms an idle source that refreshes the mirror once per burst. */
+    nm_state_mirror_schedule_update();
+
     G_OBJECT_CLASS(nm_dbus_object_parent_class)
         ->dispatch_properties_changed(object, n_pspecs, pspecs);
 }
@@ -283,12 +288,12 @@ constructed(GObject *object)
      * a good idea.
      *
      * It's not a good idea, because NMDBusObject uses dispatch_properties_changed()
-     * to emit signals about a bunch of property changes. So, we want to make
-     * use of g_object_freeze_notify() / g_object_thaw_notify() to combine multiple
-     * property changes in one signal on D-Bus. Note that notify() is not invoked
-     * while the signal is frozen, that means, whatever you do inside notify()
-     * will not make it into the same batch of PropertiesChanged signal. That is
-     * confusing, and probably not what you want.
+     * to collect property changes, which NMDBusManager coalesces into merged
+     * PropertiesChanged signals at the end of the main loop iteration. Note that
+     * notify() is not invoked while notifications are frozen via
+     * g_object_freeze_notify() / g_object_thaw_notify(), that means, whatever
+     * you do inside notify() will not make it into the same batch of
+     * PropertiesChanged signal. That is confusing, and probably not what you want.
      *
      * Simple solution: don't overwrite notify(). */
     nm_assert(!G_OBJECT_CLASS(klass)->notify);
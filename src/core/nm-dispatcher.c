@@ -88,6 +88,113 @@ static struct {
 
 /*****************************************************************************/
 
+/* Monitor the dispatcher script directories, so that the common case -- no
+ * scripts installed for an action -- skips the D-Bus call (and possibly the
+ * activation of the nm-dispatcher service) without any per-event I/O. */
+typedef struct {
+    const char   *dir;
+    GFileMonitor *monitor;
+
+    /* changes only mark the directory for rescan; the rescan happens
+     * lazily on the next dispatcher call. */
+    bool needs_rescan : 1;
+    bool has_scripts : 1;
+} ScriptDirInfo;
+
+#define SCRIPT_DIRS_IDX_DEFAULT  0
+#define SCRIPT_DIRS_IDX_PRE_UP   2
+#define SCRIPT_DIRS_IDX_PRE_DOWN 4
+
+/* the directories scanned by nm-dispatcher's find_scripts(), grouped
+ * pairwise per action class. */
+static ScriptDirInfo script_dirs[] = {
+    [SCRIPT_DIRS_IDX_DEFAULT]      = {.dir = NMLIBDIR "/dispatcher.d"},
+    [SCRIPT_DIRS_IDX_DEFAULT + 1]  = {.dir = NMCONFDIR "/dispatcher.d"},
+    [SCRIPT_DIRS_IDX_PRE_UP]       = {.dir = NMLIBDIR "/dispatcher.d/pre-up.d"},
+    [SCRIPT_DIRS_IDX_PRE_UP + 1]   = {.dir = NMCONFDIR "/dispatcher.d/pre-up.d"},
+    [SCRIPT_DIRS_IDX_PRE_DOWN]     = {.dir = NMLIBDIR "/dispatcher.d/pre-down.d"},
+    [SCRIPT_DIRS_IDX_PRE_DOWN + 1] = {.dir = NMCONFDIR "/dispatcher.d/pre-down.d"},
+};
+
+static void
+script_dir_rescan(ScriptDirInfo *info)
+{
+    gs_free_error GError *error = NULL;
+    GDir                 *dir;
+    const char           *name;
+
+    info->needs_rescan = FALSE;
+    info->has_scripts  = FALSE;
+
+    dir = g_dir_open(info->dir, 0, &error);
+    if (!dir) {
+        /* unless the directory is really absent, assume it has scripts. */
+        info->has_scripts = !g_error_matches(error, G_FILE_ERROR, G_FILE_ERROR_NOENT);
+        return;
+    }
+
+    while ((name = g_dir_read_name(dir))) {
+        gs_free char *full_name = NULL;
+
+        /* any regular file counts. nm-dispatcher applies the full filename
+         * and permission checks; this only needs to be a conservative
+         * superset of what it would run. */
+        full_name = g_build_filename(info->dir, name, NULL);
+        if (g_file_test(full_name, G_FILE_TEST_IS_REGULAR)) {
+            info->has_scripts = TRUE;
+            break;
+        }
+    }
+    g_dir_close(dir);
+}
+
+static void
+script_dir_changed_cb(GFileMonitor     *monitor,
+                      GFile            *file,
+                      GFile            *other_file,
+                      GFileMonitorEvent event_type,
+                      gpointer          user_data)
+{
+    ScriptDirInfo *info = user_data;
+
+    info->needs_rescan = TRUE;
+}
+
+static gboolean
+action_has_scripts(NMDispatcherAction action)
+{
+    guint idx;
+    guint i;
+
+    switch (action) {
+    case NM_DISPATCHER_ACTION_PRE_UP:
+    case NM_DISPATCHER_ACTION_VPN_PRE_UP:
+        idx = SCRIPT_DIRS_IDX_PRE_UP;
+        break;
+    case NM_DISPATCHER_ACTION_PRE_DOWN:
+    case NM_DISPATCHER_ACTION_VPN_PRE_DOWN:
+        idx = SCRIPT_DIRS_IDX_PRE_DOWN;
+        break;
+    default:
+        idx = SCRIPT_DIRS_IDX_DEFAULT;
+        break;
+    }
+
+    for (i = idx; i < idx + 2u; i++) {
+        ScriptDirInfo *info = &script_dirs[i];
+
+        /* without a monitor we cannot cache the result and rescan every
+         * time, which is no worse than what nm-dispatcher would do. */
+        if (info->needs_rescan || !info->monitor)
+            script_dir_rescan(info);
+        if (info->has_scripts)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+/*****************************************************************************/
+
 /* All actions except 'hostname', 'connectivity-change' and 'dns-change' require
  * a device */
 static gboolean
@@ -134,6 +241,7 @@ dispatcher_call_id_new(guint32              request_id,
     call_id->user_data     = user_data;
     call_id->idle_id       = 0;
     call_id->is_action2    = TRUE;
+    call_id->action_params = NULL;
 
     extra_strings = &call_id->extra_strings[0];
 
@@ -166,12 +274,29 @@ dispatcher_call_id_free(NMDispatcherCallId *call_id)
 static void
 _init_dispatcher(void)
 {
+    guint i;
+
     if (G_UNLIKELY(gl.requests == NULL)) {
         gl.requests        = g_hash_table_new(nm_direct_hash, NULL);
         gl.dbus_connection = nm_g_object_ref(NM_MAIN_DBUS_CONNECTION_GET);
 
         if (!gl.dbus_connection)
             _LOGD("No D-Bus connection to talk with NetworkManager-dispatcher service");
+
+        for (i = 0; i < G_N_ELEMENTS(script_dirs); i++) {
+            ScriptDirInfo        *info  = &script_dirs[i];
+            gs_unref_object GFile *file = NULL;
+
+            file          = g_file_new_for_path(info->dir);
+            info->monitor = g_file_monitor_directory(file, G_FILE_MONITOR_NONE, NULL, NULL);
+            if (info->monitor) {
+                g_signal_connect(info->monitor,
+                                 "changed",
+                                 G_CALLBACK(script_dir_changed_cb),
+                                 info);
+                info->needs_rescan = TRUE;
+            }
+        }
     }
 }
 
@@ -619,6 +744,28 @@ dispatcher_done_cb(GObject *source, GAsyncResult *result, gpointer user_data)
     dispatcher_call_id_free(call_id);
 }
 
+static gboolean
+dispatcher_idle_cb(gpointer user_data)
+{
+    NMDispatcherCallId *call_id = user_data;
+
+    call_id->idle_id = 0;
+    g_hash_table_remove(gl.requests, call_id);
+
+    if (call_id->callback) {
+        NMDispatcherFunc cb = (NMDispatcherFunc) call_id->callback;
+
+        /* device-handler actions are never completed via idle, they
+         * always go through the dispatcher service. */
+        nm_assert(!action_is_device_handler(call_id->action));
+
+        cb(call_id, call_id->user_data);
+    }
+
+    dispatcher_call_id_free(call_id);
+    return G_SOURCE_REMOVE;
+}
+
 static const char *action_table[] = {
     [NM_DISPATCHER_ACTION_HOSTNAME]            = NMD_ACTION_HOSTNAME,
     [NM_DISPATCHER_ACTION_PRE_UP]              = NMD_ACTION_PRE_UP,
@@ -654,8 +801,7 @@ build_call_parameters(NMDispatcherAction    action,
                       gboolean              activation_type_external,
                       NMConnectivityState   connectivity_state,
                       const char           *vpn_iface,
-                      const NML3ConfigData *l3cd,
-                      gboolean              is_action2)
+                      const NML3ConfigData *l3cd)
 {
     const char                *connectivity_state_string = "UNKNOWN";
     GVariant                  *connection_dict;
@@ -727,28 +873,7 @@ build_call_parameters(NMDispatcherAction    action,
 
     connectivity_state_string = nm_connectivity_state_to_string(connectivity_state);
 
-    if (is_action2) {
-        return g_variant_new(
-            "(s@a{sa{sv}}a{sv}a{sv}a{sv}a{sv}a{sv}@a{sv}@a{sv}ssa{sv}a{sv}a{sv}b@a{sv})",
-            action_to_string(action),
-            connection_dict,
-            &connection_props,
-            &device_props,
-            &device_proxy_props,
-            &device_ip4_props,
-            &device_ip6_props,
-            device_dhcp4_props ?: nm_g_variant_singleton_aLsvI(),
-            device_dhcp6_props ?: nm_g_variant_singleton_aLsvI(),
-            connectivity_state_string,
-            vpn_iface ?: "",
-            &vpn_proxy_props,
-            &vpn_ip4_props,
-            &vpn_ip6_props,
-            nm_logging_enabled(LOGL_DEBUG, LOGD_DISPATCH),
-            nm_g_variant_singleton_aLsvI());
-    }
-
-    return g_variant_new("(s@a{sa{sv}}a{sv}a{sv}a{sv}a{sv}a{sv}@a{sv}@a{sv}ssa{sv}a{sv}a{sv}b)",
+    return g_variant_new("(s@a{sa{sv}}a{sv}a{sv}a{sv}a{sv}a{sv}@a{sv}@a{sv}ssa{sv}a{sv}a{sv}b@a{sv})",
                          action_to_string(action),
                          connection_dict,
                          &connection_props,
@@ -763,7 +888,32 @@ build_call_parameters(NMDispatcherAction    action,
                          &vpn_proxy_props,
                          &vpn_ip4_props,
                          &vpn_ip6_props,
-                         nm_logging_enabled(LOGL_DEBUG, LOGD_DISPATCH));
+                         nm_logging_enabled(LOGL_DEBUG, LOGD_DISPATCH),
+                         nm_g_variant_singleton_aLsvI());
+}
+
+static GVariant *
+build_legacy_call_parameters(GVariant *parameters)
+{
+    GVariantBuilder builder;
+    gsize           n;
+    gsize           i;
+
+    /* The arguments of the legacy Action() method are exactly the arguments
+     * of Action2() without the trailing options dictionary. Repackage the
+     * tuple that we already built, instead of serializing the connection and
+     * all the IP/DHCP properties a second time. */
+    g_variant_builder_init(
+        &builder,
+        G_VARIANT_TYPE("(sa{sa{sv}}a{sv}a{sv}a{sv}a{sv}a{sv}a{sv}a{sv}ssa{sv}a{sv}a{sv}b)"));
+    n = g_variant_n_children(parameters);
+    nm_assert(n == 16);
+    for (i = 0; i < n - 1; i++) {
+        gs_unref_variant GVariant *child = g_variant_get_child_value(parameters, i);
+
+        g_variant_builder_add_value(&builder, child);
+    }
+    return g_variant_builder_end(&builder);
 }
 
 static gboolean
@@ -786,8 +936,8 @@ _dispatcher_call(NMDispatcherAction    action,
     const char                *log_con_uuid;
     gint64                     start_at_msec;
     gint64                     now_msec;
-    gs_unref_variant GVariant *parameters_floating = NULL;
-    gboolean                   is_action2          = TRUE;
+    gs_unref_variant GVariant *parameters = NULL;
+    gboolean                   is_action2 = TRUE;
 
     g_return_val_if_fail(!blocking || (!callback && !user_data), FALSE);
 
@@ -825,16 +975,37 @@ _dispatcher_call(NMDispatcherAction    action,
                blocking ? " (blocking)" : (callback ? " (with callback)" : ""));
     }
 
-    parameters_floating = build_call_parameters(action,
-                                                device,
-                                                settings_connection,
-                                                applied_connection,
-                                                activation_type_external,
-                                                connectivity_state,
-                                                vpn_iface,
-                                                l3cd,
-                                                TRUE);
-    start_at_msec       = nm_utils_get_monotonic_timestamp_msec();
+    /* Don't bother the dispatcher service (or even D-Bus activate it) when
+     * no scripts exist for this action. Device-handler actions are exempt,
+     * because there a missing script must be reported as failure to the
+     * caller. */
+    if (!action_is_device_handler(action) && !action_has_scripts(action)) {
+        _LOG2D(request_id, log_ifname, log_con_uuid, "ignoring request; no scripts in dispatcher.d");
+        if (!blocking && callback) {
+            call_id = dispatcher_call_id_new(request_id,
+                                             nm_utils_get_monotonic_timestamp_msec(),
+                                             action,
+                                             callback,
+                                             user_data,
+                                             log_ifname,
+                                             log_con_uuid);
+
+            call_id->idle_id = g_idle_add(dispatcher_idle_cb, call_id);
+            g_hash_table_add(gl.requests, call_id);
+            NM_SET_OUT(out_call_id, call_id);
+        }
+        return TRUE;
+    }
+
+    parameters    = g_variant_ref_sink(build_call_parameters(action,
+                                                          device,
+                                                          settings_connection,
+                                                          applied_connection,
+                                                          activation_type_external,
+                                                          connectivity_state,
+                                                          vpn_iface,
+                                                          l3cd));
+    start_at_msec = nm_utils_get_monotonic_timestamp_msec();
 
     /* Send the action to the dispatcher */
     if (blocking) {
@@ -846,7 +1017,7 @@ _dispatcher_call(NMDispatcherAction    action,
                                           NM_DISPATCHER_DBUS_PATH,
                                           NM_DISPATCHER_DBUS_INTERFACE,
                                           "Action2",
-                                          g_steal_pointer(&parameters_floating),
+                                          parameters,
                                           G_VARIANT_TYPE("(a(susa{sv}))"),
                                           G_DBUS_CALL_FLAGS_NONE,
                                           CALL_TIMEOUT,
@@ -860,27 +1031,18 @@ _dispatcher_call(NMDispatcherAction    action,
                 log_con_uuid,
                 "dispatcher service does not implement Action2() method, falling back to Action()");
             g_clear_error(&error);
-            parameters_floating = build_call_parameters(action,
-                                                        device,
-                                                        settings_connection,
-                                                        applied_connection,
-                                                        activation_type_external,
-                                                        connectivity_state,
-                                                        vpn_iface,
-                                                        l3cd,
-                                                        FALSE);
-            ret                 = g_dbus_connection_call_sync(gl.dbus_connection,
+            ret        = g_dbus_connection_call_sync(gl.dbus_connection,
                                               NM_DISPATCHER_DBUS_SERVICE,
                                               NM_DISPATCHER_DBUS_PATH,
                                               NM_DISPATCHER_DBUS_INTERFACE,
                                               "Action",
-                                              g_steal_pointer(&parameters_floating),
+                                              build_legacy_call_parameters(parameters),
                                               G_VARIANT_TYPE("(a(sus))"),
                                               G_DBUS_CALL_FLAGS_NONE,
                                               CALL_TIMEOUT,
                                               NULL,
                                               &error);
-            is_action2          = FALSE;
+            is_action2 = FALSE;
         }
 
         now_msec = nm_utils_get_monotonic_timestamp_msec();
@@ -920,22 +1082,14 @@ _dispatcher_call(NMDispatcherAction    action,
 
     /* Since we don't want to cache all the input parameters, already build
      * and cache the argument for the Action() method in case Action2() fails. */
-    call_id->action_params = build_call_parameters(action,
-                                                   device,
-                                                   settings_connection,
-                                                   applied_connection,
-                                                   activation_type_external,
-                                                   connectivity_state,
-                                                   vpn_iface,
-                                                   l3cd,
-                                                   FALSE);
+    call_id->action_params = build_legacy_call_parameters(parameters);
 
     g_dbus_connection_call(gl.dbus_connection,
                            NM_DISPATCHER_DBUS_SERVICE,
                            NM_DISPATCHER_DBUS_PATH,
                            NM_DISPATCHER_DBUS_INTERFACE,
                            "Action2",
-                           g_steal_pointer(&parameters_floating),
+                           parameters,
                            G_VARIANT_TYPE("(a(susa{sv}))"),
                            G_DBUS_CALL_FLAGS_NONE,
                            CALL_TIMEOUT,
@@ -18,6 +18,12 @@
 #define FIREWALL_DBUS_INTERFACE      "org.fedoraproject.FirewallD1"
 #define FIREWALL_DBUS_INTERFACE_ZONE "org.fedoraproject.FirewallD1.zone"
 
+/* Maximum number of D-Bus requests that we issue to firewalld in parallel.
+ * During mass activation we can queue hundreds of zone changes; beyond a
+ * certain window additional in-flight calls only pile up in firewalld's
+ * receive queue. Further requests stay queued until a slot frees up. */
+#define FIREWALL_MAX_PARALLEL_REQUESTS 8
+
 /*****************************************************************************/
 
 enum { STATE_CHANGED, LAST_SIGNAL };
@@ -31,11 +37,18 @@ typedef struct {
 
     CList pending_calls;
 
+    /* the zone that we last successfully configured in firewalld, per
+     * interface. Only tracks what we set ourselves; flushed whenever the
+     * name owner changes or firewalld reloads. */
+    GHashTable *zone_state;
+
     char *name_owner;
 
     guint reloaded_id;
     guint name_owner_changed_id;
 
+    guint num_started;
+
     bool dbus_inited : 1;
 } NMFirewalldManagerPrivate;
 
@@ -71,6 +84,7 @@ struct _NMFirewalldManagerCallId {
     NMFirewalldManager *self;
 
     char *iface;
+    char *zone;
 
     NMFirewalldManagerAddRemoveCallback callback;
     gpointer                            user_data;
@@ -88,6 +102,7 @@ struct _NMFirewalldManagerCallId {
     OpsType ops_type;
 
     bool is_idle : 1;
+    bool dbus_started : 1;
 };
 
 /*****************************************************************************/
@@ -194,6 +209,7 @@ _cb_info_create(NMFirewalldManager                 *self,
     call_id->self      = g_object_ref(self);
     call_id->ops_type  = ops_type;
     call_id->iface     = g_strdup(iface);
+    call_id->zone      = g_strdup(zone ?: "");
     call_id->callback  = callback;
     call_id->user_data = user_data;
 
@@ -208,9 +224,14 @@ _cb_info_create(NMFirewalldManager                 *self,
     return call_id;
 }
 
+static void _handle_dbus_start_next(NMFirewalldManager *self);
+
 static void
 _cb_info_complete(NMFirewalldManagerCallId *call_id, GError *error)
 {
+    NMFirewalldManager *self         = call_id->self;
+    gboolean            dbus_started = FALSE;
+
     c_list_unlink(&call_id->lst);
 
     if (call_id->callback)
@@ -221,10 +242,17 @@ _cb_info_complete(NMFirewalldManagerCallId *call_id, GError *error)
     else {
         nm_g_variant_unref(call_id->dbus.arg);
         nm_clear_g_cancellable(&call_id->dbus.cancellable);
+        dbus_started = call_id->dbus_started;
     }
     g_free(call_id->iface);
-    g_object_unref(call_id->self);
+    g_free(call_id->zone);
     nm_g_slice_free(call_id);
+
+    if (dbus_started) {
+        NM_FIREWALLD_MANAGER_GET_PRIVATE(self)->num_started--;
+        _handle_dbus_start_next(self);
+    }
+    g_object_unref(self);
 }
 
 static gboolean
@@ -313,6 +341,26 @@ _handle_dbus_cb(GObject *source, GAsyncResult *result, gpointer user_data)
     } else
         _LOGD(call_id, "complete: success");
 
+    if (!error) {
+        NMFirewalldManagerPrivate *priv = NM_FIREWALLD_MANAGER_GET_PRIVATE(self);
+
+        switch (call_id->ops_type) {
+        case OPS_TYPE_ADD:
+        case OPS_TYPE_CHANGE:
+            g_hash_table_insert(priv->zone_state,
+                                g_strdup(call_id->iface),
+                                g_strdup(call_id->zone));
+            break;
+        case OPS_TYPE_REMOVE:
+            g_hash_table_remove(priv->zone_state, call_id->iface);
+            break;
+        }
+    } else {
+        /* the request failed, we no longer know which zone the interface
+         * is in. */
+        g_hash_table_remove(NM_FIREWALLD_MANAGER_GET_PRIVATE(self)->zone_state, call_id->iface);
+    }
+
     g_clear_object(&call_id->dbus.cancellable);
 
     _cb_info_complete(call_id, error);
@@ -328,8 +376,16 @@ _handle_dbus_start(NMFirewalldManager *self, NMFirewalldManagerCallId *call_id)
     nm_assert(call_id);
     nm_assert(priv->name_owner);
     nm_assert(!call_id->is_idle);
+    nm_assert(!call_id->dbus_started);
     nm_assert(c_list_contains(&priv->pending_calls, &call_id->lst));
 
+    if (priv->num_started >= FIREWALL_MAX_PARALLEL_REQUESTS) {
+        /* too many requests in flight. The request stays queued and is
+         * dispatched from _handle_dbus_start_next() once a slot frees up. */
+        _LOGT(call_id, "queued: %u requests in flight", priv->num_started);
+        return;
+    }
+
     switch (call_id->ops_type) {
     case OPS_TYPE_ADD:
         dbus_method = "addInterface";
@@ -349,7 +405,9 @@ _handle_dbus_start(NMFirewalldManager *self, NMFirewalldManagerCallId *call_id)
 
     nm_assert(!call_id->dbus.cancellable);
 
+    call_id->dbus_started     = TRUE;
     call_id->dbus.cancellable = g_cancellable_new();
+    priv->num_started++;
 
     g_dbus_connection_call(priv->dbus_connection,
                            priv->name_owner,
@@ -365,6 +423,58 @@ _handle_dbus_start(NMFirewalldManager *self, NMFirewalldManagerCallId *call_id)
                            call_id);
 }
 
+static void
+_handle_dbus_start_next(NMFirewalldManager *self)
+{
+    NMFirewalldManagerPrivate *priv = NM_FIREWALLD_MANAGER_GET_PRIVATE(self);
+    NMFirewalldManagerCallId  *call_id;
+
+    if (!priv->name_owner)
+        return;
+
+    c_list_for_each_entry (call_id, &priv->pending_calls, lst) {
+        if (priv->num_started >= FIREWALL_MAX_PARALLEL_REQUESTS)
+            return;
+        if (call_id->is_idle || call_id->dbus_started)
+            continue;
+        _handle_dbus_start(self, call_id);
+    }
+}
+
+static void
+_supersede_queued_requests(NMFirewalldManager *self, const char *iface)
+{
+    NMFirewalldManagerPrivate *priv = NM_FIREWALLD_MANAGER_GET_PRIVATE(self);
+    NMFirewalldManagerCallId  *call_id;
+    NMFirewalldManagerCallId  *call_id_safe;
+
+    c_list_for_each_entry_safe (call_id, call_id_safe, &priv->pending_calls, lst) {
+        if (call_id->is_idle || call_id->dbus_started)
+            continue;
+        if (!nm_streq(call_id->iface, iface))
+            continue;
+
+        /* this request was still waiting for a dispatch slot and a newer
+         * request for the same interface arrived. Only the newer request
+         * determines the final state in firewalld, so the older one is
+         * moot. Complete it right away (as success). */
+        _LOGD(call_id, "complete: superseded by a newer request");
+        _cb_info_complete(call_id, NULL);
+    }
+}
+
+static gboolean
+_iface_call_in_flight(NMFirewalldManagerPrivate *priv, const char *iface)
+{
+    NMFirewalldManagerCallId *call_id;
+
+    c_list_for_each_entry (call_id, &priv->pending_calls, lst) {
+        if (!call_id->is_idle && call_id->dbus_started && nm_streq(call_id->iface, iface))
+            return TRUE;
+    }
+    return FALSE;
+}
+
 static NMFirewalldManagerCallId *
 _start_request(NMFirewalldManager                 *self,
                OpsType                             ops_type,
@@ -381,6 +491,9 @@ _start_request(NMFirewalldManager                 *self,
 
     priv = NM_FIREWALLD_MANAGER_GET_PRIVATE(self);
 
+    if (_get_running(priv))
+        _supersede_queued_requests(self, iface);
+
     call_id = _cb_info_create(self, ops_type, iface, zone, callback, user_data);
 
     _LOGD(call_id,
@@ -392,8 +505,22 @@ _start_request(NMFirewalldManager                 *self,
                            : (!priv->name_owner ? " (waiting to initialize)" : ""));
 
     if (!call_id->is_idle) {
-        if (priv->name_owner)
+        if (priv->name_owner) {
+            if (NM_IN_SET(call_id->ops_type, OPS_TYPE_ADD, OPS_TYPE_CHANGE)
+                && nm_streq0(g_hash_table_lookup(priv->zone_state, iface), call_id->zone)
+                && !_iface_call_in_flight(priv, iface)) {
+                /* firewalld already has the interface in the requested zone
+                 * (we put it there ourselves) and no conflicting request is
+                 * in flight. Skip the round trip and signal success on idle. */
+                nm_clear_pointer(&call_id->dbus.arg, g_variant_unref);
+                call_id->is_idle = TRUE;
+                _LOGD(call_id, "zone unchanged, skip D-Bus request");
+                if (!_handle_idle_start(self, call_id))
+                    return NULL;
+                return call_id;
+            }
             _handle_dbus_start(self, call_id);
+        }
         if (!call_id->callback) {
             /* if the user did not provide a callback, the call_id is useless.
              * Especially, the user cannot use the call-id to cancel the request,
@@ -489,6 +616,9 @@ name_owner_changed(NMFirewalldManager *self, const char *owner)
     priv->dbus_inited  = TRUE;
     name_owner_changed = nm_strdup_reset(&priv->name_owner, owner);
 
+    if (name_owner_changed)
+        g_hash_table_remove_all(priv->zone_state);
+
     now_running = _get_running(priv);
 
     if (just_initied) {
@@ -546,6 +676,7 @@ reloaded_cb(GDBusConnection *connection,
         return;
 
     _LOGT(NULL, "reloaded signal received");
+    g_hash_table_remove_all(priv->zone_state);
     _signal_emit_state_changed(self, NM_FIREWALLD_MANAGER_STATE_CHANGED_TYPE_RELOADED);
 }
 
@@ -595,6 +726,8 @@ nm_firewalld_manager_init(NMFirewalldManager *self)
 
     c_list_init(&priv->pending_calls);
 
+    priv->zone_state = g_hash_table_new_full(nm_str_hash, g_str_equal, g_free, g_free);
+
     priv->dbus_connection = nm_g_object_ref(NM_MAIN_DBUS_CONNECTION_GET);
 
     if (!priv->dbus_connection) {
@@ -644,6 +777,8 @@ dispose(GObject *object)
 
     nm_clear_g_cancellable(&priv->get_name_owner_cancellable);
 
+    nm_clear_pointer(&priv->zone_state, g_hash_table_unref);
+
     G_OBJECT_CLASS(nm_firewalld_manager_parent_class)->dispose(object);
 
     g_clear_object(&priv->dbus_connection);
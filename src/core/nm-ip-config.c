@@ -823,6 +823,25 @@ _handle_l3cd_changed(NMIPConfig *self, const NML3ConfigData *l3cd)
     _notify_all(self, changed_params, n_changed_params);
 }
 
+static gboolean
+_variant_arr_equal(GVariant *a, GVariant *b)
+{
+    if (a == b)
+        return TRUE;
+    if (!a || !b)
+        return FALSE;
+
+    /* g_variant_equal() serializes both arrays to compare them byte-wise.
+     * For an IP config with thousands of routes that is a significant cost,
+     * paid on every (rate limited) platform change, and the arrays almost
+     * always differ when we get here. Reject cheaply on differing lengths
+     * before falling back to the full comparison. */
+    if (g_variant_n_children(a) != g_variant_n_children(b))
+        return FALSE;
+
+    return g_variant_equal(a, b);
+}
+
 static void
 _handle_platform_change(NMIPConfig *self, guint32 obj_type_flags, gboolean is_init)
 {
@@ -897,12 +916,12 @@ _handle_platform_change(NMIPConfig *self, guint32 obj_type_flags, gboolean is_in
                                       &x_address_data,
                                       &x_addresses);
 
-        if (!nm_g_variant_equal(priv->v_address_data, x_address_data)) {
+        if (!_variant_arr_equal(priv->v_address_data, x_address_data)) {
             changed_params[n_changed_params++] = obj_properties_ip[PROP_IP_ADDRESS_DATA];
             g_variant_ref_sink(x_address_data);
             NM_SWAP(&priv->v_address_data, &x_address_data);
         }
-        if (!nm_g_variant_equal(priv->v_addresses, x_addresses)) {
+        if (!_variant_arr_equal(priv->v_addresses, x_addresses)) {
             changed_params[n_changed_params++] = IS_IPv4 ? obj_properties_ip4[PROP_IP4_ADDRESSES]
                                                          : obj_properties_ip6[PROP_IP6_ADDRESSES];
             g_variant_ref_sink(x_addresses);
@@ -919,12 +938,12 @@ _handle_platform_change(NMIPConfig *self, guint32 obj_type_flags, gboolean is_in
 
         nm_utils_ip_routes_to_dbus(addr_family, head_entry_routes, &x_route_data, &x_routes);
 
-        if (!nm_g_variant_equal(priv->v_route_data, x_route_data)) {
+        if (!_variant_arr_equal(priv->v_route_data, x_route_data)) {
             changed_params[n_changed_params++] = obj_properties_ip[PROP_IP_ROUTE_DATA];
             g_variant_ref_sink(x_route_data);
             NM_SWAP(&priv->v_route_data, &x_route_data);
         }
-        if (!nm_g_variant_equal(priv->v_routes, x_routes)) {
+        if (!_variant_arr_equal(priv->v_routes, x_routes)) {
             changed_params[n_changed_params++] =
                 IS_IPv4 ? obj_properties_ip4[PROP_IP4_ROUTES] : obj_properties_ip6[PROP_IP6_ROUTES];
             g_variant_ref_sink(x_routes);
@@ -174,7 +174,15 @@ _garray_inaddr_ensure(GArray **p_arr, int addr_family)
     nm_assert_addr_family(addr_family);
 
     if (G_UNLIKELY(!*p_arr)) {
-        *p_arr = g_array_new(FALSE, FALSE, nm_utils_addr_family_to_size(addr_family));
+        /* These arrays hold few, tiny elements (WINS/NIS servers and the
+         * like). They stay NULL while unused; once used, reserve space for
+         * the typical count right away so that appending the usual one to
+         * three entries doesn't go through several reallocs of 4/8 byte
+         * blocks. Note that the addresses/routes, which are the collections
+         * that actually grow large, are NMPObjects tracked via the dedup
+         * index and are not affected by GArray storage at all. */
+        *p_arr =
+            g_array_sized_new(FALSE, FALSE, nm_utils_addr_family_to_size(addr_family), 4);
     }
     return *p_arr;
 }
@@ -3316,6 +3324,17 @@ nm_l3_config_data_merge(NML3ConfigData       *self,
                 }
 
                 if (!NM_FLAGS_HAS(merge_flags, NM_L3_CONFIG_MERGE_FLAGS_CLONE)) {
+                    const gboolean is_default = NM_PLATFORM_IP_ROUTE_IS_DEFAULT(r_src);
+
+                    /* check this before resolving table/metric below, so that
+                     * skipped default routes don't get copied and rewritten
+                     * just to be thrown away. */
+                    if (is_default
+                        && NM_FLAGS_HAS(merge_flags, NM_L3_CONFIG_MERGE_FLAGS_NO_DEFAULT_ROUTES)
+                        && !NM_FLAGS_HAS(src->flags,
+                                         NM_L3_CONFIG_DAT_FLAGS_IGNORE_MERGE_NO_DEFAULT_ROUTES))
+                        continue;
+
                     if (r_src->table_any) {
                         _ensure_r();
                         r.rx.table_any     = FALSE;
@@ -3329,17 +3348,12 @@ nm_l3_config_data_merge(NML3ConfigData       *self,
                             nm_add_clamped_u32(r.rx.metric, default_route_metric_x[IS_IPv4]);
                     }
 
-                    if (NM_PLATFORM_IP_ROUTE_IS_DEFAULT(r_src)) {
-                        if (NM_FLAGS_HAS(merge_flags, NM_L3_CONFIG_MERGE_FLAGS_NO_DEFAULT_ROUTES)
-                            && !NM_FLAGS_HAS(src->flags,
-                                             NM_L3_CONFIG_DAT_FLAGS_IGNORE_MERGE_NO_DEFAULT_ROUTES))
-                            continue;
-                        if (default_route_penalty_x && default_route_penalty_x[IS_IPv4] > 0) {
-                            _ensure_r();
-                            r.rx.metric =
-                                nm_utils_ip_route_metric_penalize(r.rx.metric,
-                                                                  default_route_penalty_x[IS_IPv4]);
-                        }
+                    if (is_default && default_route_penalty_x
+                        && default_route_penalty_x[IS_IPv4] > 0) {
+                        _ensure_r();
+                        r.rx.metric =
+                            nm_utils_ip_route_metric_penalize(r.rx.metric,
+                                                              default_route_penalty_x[IS_IPv4]);
                     }
                 }
 
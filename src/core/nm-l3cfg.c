@@ -11,6 +11,8 @@
 #include <linux/if_ether.h>
 #include <linux/rtnetlink.h>
 
+#include "libnm-glib-aux/nm-perf-counter.h"
+#include "libnm-glib-aux/nm-perf-trace.h"
 #include "libnm-glib-aux/nm-prioq.h"
 #include "libnm-glib-aux/nm-time-utils.h"
 #include "libnm-platform/nm-platform.h"
@@ -87,7 +89,15 @@ typedef struct {
 
     NAcdProbe *nacd_probe;
 
-    GSource *acd_data_timeout_source;
+    /* The expiry (in nm_utils_get_monotonic_timestamp_msec() scale) of the
+     * pending ACD timeout. All AcdData instances of one NML3Cfg share a single
+     * GSource, tracked via "priv->acd_data_timeout_prioq". This is only
+     * meaningful while "acd_data_timeout_prioq_idx" is not NM_PRIOQ_IDX_NULL. */
+    gint64 acd_data_timeout_expiry_msec;
+
+    /* The index into "priv->acd_data_timeout_prioq", or NM_PRIOQ_IDX_NULL if
+     * no timeout is pending. */
+    guint acd_data_timeout_prioq_idx;
 
     /* see probing_timeout_msec. */
     gint64 probing_timestamp_msec;
@@ -308,6 +318,13 @@ typedef struct _NML3CfgPrivate {
     GSource *failedobj_timeout_source;
     gint64   failedobj_timeout_expiry_msec;
 
+    /* All pending AcdData timeouts, ordered by their expiry. They share one
+     * "acd_data_timeout_source" (which ticks for the earliest expiry), instead
+     * of one GSource per probed address. */
+    NMPrioq  acd_data_timeout_prioq;
+    GSource *acd_data_timeout_source;
+    gint64   acd_data_timeout_expiry_msec;
+
     NML3CfgCommitType commit_on_idle_type;
 
     gint8 commit_reentrant_count;
@@ -422,6 +439,8 @@ static void _l3_acd_data_state_change(NML3Cfg           *self,
 
 static AcdData *_l3_acd_data_find(NML3Cfg *self, in_addr_t addr);
 
+static void _l3_acd_data_timeout_cancel(AcdData *acd_data);
+
 /*****************************************************************************/
 
 static NM_UTILS_ENUM2STR_DEFINE(_l3_cfg_commit_type_to_string,
@@ -1312,6 +1331,9 @@ _commit_collect_routes(NML3Cfg          *self,
     if (!head_entry)
         goto loop_done;
 
+    is_dhcp_enabled =
+        nm_l3_config_data_get_dhcp_enabled(self->priv.p->combined_l3cd_commited, addr_family);
+
     c_list_for_each_entry (entry, &head_entry->lst_entries_head, lst_entries) {
         const NMPObject *obj = entry->obj;
         GPtrArray      **r;
@@ -1321,9 +1343,6 @@ _commit_collect_routes(NML3Cfg          *self,
         else {
             nm_assert(NMP_OBJECT_CAST_IP_ROUTE(obj)->ifindex == self->priv.ifindex);
 
-            is_dhcp_enabled =
-                nm_l3_config_data_get_dhcp_enabled(self->priv.p->combined_l3cd_commited,
-                                                   addr_family);
             if (!any_addrs && is_dhcp_enabled) {
                 /* This is a unicast route (or a similar route, which has an
                  * ifindex).
@@ -1658,7 +1677,7 @@ _acd_data_free(AcdData *acd_data)
     nm_assert(acd_data->info.n_track_infos == 0u);
 
     n_acd_probe_free(acd_data->nacd_probe);
-    nm_clear_g_source_inst(&acd_data->acd_data_timeout_source);
+    _l3_acd_data_timeout_cancel(acd_data);
     c_list_unlink_stale(&acd_data->acd_lst);
     c_list_unlink_stale(&acd_data->acd_event_notify_lst);
     g_free((NML3AcdAddrTrackInfo *) acd_data->info.track_infos);
@@ -2173,6 +2192,7 @@ _l3_acd_data_add(NML3Cfg              *self,
                 },
             .n_track_infos_alloc       = 0,
             .acd_event_notify_lst      = C_LIST_INIT(acd_data->acd_event_notify_lst),
+            .acd_data_timeout_prioq_idx = NM_PRIOQ_IDX_NULL,
             .probing_timestamp_msec    = 0,
             .acd_defend_type_desired   = _NM_L3_ACD_DEFEND_TYPE_NONE,
             .acd_defend_type_current   = _NM_L3_ACD_DEFEND_TYPE_NONE,
@@ -2275,22 +2295,72 @@ _l3_acd_data_add_all(NML3Cfg                   *self,
     }
 }
 
+static int
+_l3_acd_data_timeout_prioq_cmp(gconstpointer a, gconstpointer b)
+{
+    const AcdData *acd_data_a = a;
+    const AcdData *acd_data_b = b;
+
+    nm_assert(acd_data_a);
+    nm_assert(acd_data_b);
+
+    NM_CMP_SELF(acd_data_a, acd_data_b);
+    NM_CMP_FIELD(acd_data_a, acd_data_b, acd_data_timeout_expiry_msec);
+    return 0;
+}
+
+static gboolean _l3_acd_data_timeout_cb(gpointer user_data);
+
+static void
+_l3_acd_data_timeout_reschedule(NML3Cfg *self)
+{
+    AcdData *acd_data;
+
+    acd_data = nm_prioq_peek(&self->priv.p->acd_data_timeout_prioq);
+
+    if (!acd_data) {
+        nm_clear_g_source_inst(&self->priv.p->acd_data_timeout_source);
+        return;
+    }
+
+    nm_g_timeout_reschedule(&self->priv.p->acd_data_timeout_source,
+                            &self->priv.p->acd_data_timeout_expiry_msec,
+                            acd_data->acd_data_timeout_expiry_msec,
+                            _l3_acd_data_timeout_cb,
+                            self);
+}
+
 static gboolean
 _l3_acd_data_timeout_cb(gpointer user_data)
 {
-    AcdData *acd_data = user_data;
-    NML3Cfg *self     = acd_data->info.l3cfg;
+    NML3Cfg *self = NM_L3CFG(user_data);
+    AcdData *acd_data;
+    gint64   now_msec;
 
-    nm_assert(NM_IS_L3CFG(self));
+    nm_clear_g_source_inst(&self->priv.p->acd_data_timeout_source);
 
-    nm_clear_g_source_inst(&acd_data->acd_data_timeout_source);
-    _l3_acd_data_state_change(self, acd_data, ACD_STATE_CHANGE_MODE_TIMEOUT, NULL, NULL);
-    return G_SOURCE_REMOVE;
+    now_msec = nm_utils_get_monotonic_timestamp_msec();
+
+    /* handle all expired entries in one sweep. Re-peek after every state
+     * change, because the callee may schedule/cancel timeouts or delete
+     * AcdData instances. */
+    while ((acd_data = nm_prioq_peek(&self->priv.p->acd_data_timeout_prioq))
+           && acd_data->acd_data_timeout_expiry_msec <= now_msec) {
+        nm_prioq_remove(&self->priv.p->acd_data_timeout_prioq,
+                        acd_data,
+                        &acd_data->acd_data_timeout_prioq_idx);
+        _l3_acd_data_state_change(self, acd_data, ACD_STATE_CHANGE_MODE_TIMEOUT, NULL, NULL);
+    }
+
+    _l3_acd_data_timeout_reschedule(self);
+    return G_SOURCE_CONTINUE;
 }
 
 static void
 _l3_acd_data_timeout_schedule(AcdData *acd_data, gint64 timeout_msec)
 {
+    NML3Cfg *self = acd_data->info.l3cfg;
+
     /* in _l3_acd_data_state_set_full() we clear the timer. At the same time,
      * in _l3_acd_data_state_change(ACD_STATE_CHANGE_MODE_TIMEOUT) we only
      * expect timeouts in certain states.
@@ -2304,11 +2374,27 @@ _l3_acd_data_timeout_schedule(AcdData *acd_data, gint64 timeout_msec)
                         NM_L3_ACD_ADDR_STATE_DEFENDING,
                         NM_L3_ACD_ADDR_STATE_CONFLICT));
 
-    nm_clear_g_source_inst(&acd_data->acd_data_timeout_source);
-    acd_data->acd_data_timeout_source =
-        nm_g_timeout_add_source(NM_CLAMP((gint64) 0, timeout_msec, (gint64) G_MAXUINT),
-                                _l3_acd_data_timeout_cb,
-                                acd_data);
+    acd_data->acd_data_timeout_expiry_msec =
+        nm_utils_get_monotonic_timestamp_msec() + NM_MAX((gint64) 0, timeout_msec);
+    nm_prioq_update(&self->priv.p->acd_data_timeout_prioq,
+                    acd_data,
+                    &acd_data->acd_data_timeout_prioq_idx,
+                    TRUE);
+    _l3_acd_data_timeout_reschedule(self);
+}
+
+static void
+_l3_acd_data_timeout_cancel(AcdData *acd_data)
+{
+    if (acd_data->acd_data_timeout_prioq_idx == NM_PRIOQ_IDX_NULL)
+        return;
+
+    /* we don't bother to reschedule the shared timeout source. If it fires
+     * without any expired entry, _l3_acd_data_timeout_cb() will rearm (or
+     * clear) it. */
+    nm_prioq_remove(&acd_data->info.l3cfg->priv.p->acd_data_timeout_prioq,
+                    acd_data,
+                    &acd_data->acd_data_timeout_prioq_idx);
 }
 
 static void
@@ -2421,7 +2507,7 @@ _nm_printf(5, 6) static void _l3_acd_data_state_set_full(NML3Cfg         *self,
 
     /* in every state we only have one timer possibly running. Resetting
      * the states makes the previous timeout obsolete. */
-    nm_clear_g_source_inst(&acd_data->acd_data_timeout_source);
+    _l3_acd_data_timeout_cancel(acd_data);
 
     old_state            = acd_data->info.state;
     acd_data->info.state = state;
@@ -2796,7 +2882,7 @@ handle_init:
                                     "acd completed with address already in use by %s",
                                     nm_ether_addr_to_string_a(sender_addr));
 
-        if (!acd_data->acd_data_timeout_source)
+        if (acd_data->acd_data_timeout_prioq_idx == NM_PRIOQ_IDX_NULL)
             _l3_acd_data_timeout_schedule(acd_data, ACD_WAIT_TIME_PROBING_FULL_RESTART_MSEC);
 
         if (!_l3_acd_data_defendconflict_warning_ratelimited(acd_data, p_now_msec)) {
@@ -2846,7 +2932,7 @@ handle_init:
         acd_data->nacd_probe              = n_acd_probe_free(acd_data->nacd_probe);
         acd_data->info.last_conflict_addr = *sender_addr;
         _l3_acd_data_state_set(self, acd_data, NM_L3_ACD_ADDR_STATE_CONFLICT, TRUE);
-        if (!acd_data->acd_data_timeout_source)
+        if (acd_data->acd_data_timeout_prioq_idx == NM_PRIOQ_IDX_NULL)
             _l3_acd_data_timeout_schedule(acd_data, ACD_WAIT_TIME_CONFLICT_RESTART_MSEC);
         return;
 
@@ -3125,7 +3211,7 @@ handle_start_defending:
         const char *failure_reason;
         NAcdProbe  *probe;
 
-        if (acd_data->acd_data_timeout_source) {
+        if (acd_data->acd_data_timeout_prioq_idx != NM_PRIOQ_IDX_NULL) {
             /* we already failed to create a probe. We are ratelimited to retry, but
              * we have a timer pending... */
             return;
@@ -4991,7 +5077,12 @@ _l3_commit_one(NML3Cfg              *self,
                                                      addr_family)
             : NM_IP_ROUTE_TABLE_SYNC_MODE_NONE;
 
-    if (!IS_IPv4) {
+    if (!IS_IPv4 && (changed_combined_l3cd || commit_type >= NM_L3_CFG_COMMIT_TYPE_REAPPLY)) {
+        /* these sections depend solely on the combined l3cd (each keeps its
+         * own record of what was last written to the kernel). Unlike
+         * addresses/routes, they need no re-diff against platform on every
+         * commit, so only touch them when their input changed (or on
+         * reapply, which re-asserts everything). */
         _l3_commit_ip6_privacy(self, commit_type);
         _l3_commit_ndisc_params(self, commit_type);
         _l3_commit_ip6_token(self, commit_type);
@@ -5097,6 +5188,8 @@ _l3_commit_one(NML3Cfg              *self,
     _failedobj_handle_routes(self, addr_family, routes_failed);
 }
 
+NM_PERF_COUNTER_DEFINE(_perf_l3_commits, "l3cfg.commits");
+
 static void
 _l3_commit(NML3Cfg *self, NML3CfgCommitType commit_type, gboolean is_idle)
 {
@@ -5116,6 +5209,8 @@ _l3_commit(NML3Cfg *self, NML3CfgCommitType commit_type, gboolean is_idle)
                         NM_L3_CFG_COMMIT_TYPE_REAPPLY));
     nm_assert(self->priv.p->commit_reentrant_count == 0);
 
+    NM_PERF_COUNTER_INC(_perf_l3_commits);
+
     /* The actual commit type is always the maximum of what is requested
      * and what is registered via nm_l3cfg_commit_type_register(), combined
      * with the ad-hoc requested @commit_type argument. */
@@ -5139,6 +5234,10 @@ _l3_commit(NML3Cfg *self, NML3CfgCommitType commit_type, gboolean is_idle)
     } else
         self->priv.p->commit_type_update_sticky = TRUE;
 
+    nm_perf_trace(NM_PERF_TRACE_EVENT_L3CFG_COMMIT,
+                  (guint64) self->priv.ifindex,
+                  _l3_cfg_commit_type_to_string(commit_type, sbuf_ct, sizeof(sbuf_ct)));
+
     _LOGT("commit %s%s%s%s",
           _l3_cfg_commit_type_to_string(commit_type, sbuf_ct, sizeof(sbuf_ct)),
           commit_type_from_auto ? " (auto)" : "",
@@ -5543,6 +5642,7 @@ nm_l3cfg_init(NML3Cfg *self)
                                                          NULL);
 
     nm_prioq_init(&self->priv.p->failedobj_prioq, _failedobj_prioq_cmp);
+    nm_prioq_init(&self->priv.p->acd_data_timeout_prioq, _l3_acd_data_timeout_prioq_cmp);
 }
 
 static void
@@ -5593,6 +5693,9 @@ finalize(GObject *object)
     nm_prioq_destroy(&self->priv.p->failedobj_prioq);
     nm_clear_g_source_inst(&self->priv.p->failedobj_timeout_source);
 
+    nm_prioq_destroy(&self->priv.p->acd_data_timeout_prioq);
+    nm_clear_g_source_inst(&self->priv.p->acd_data_timeout_source);
+
     nm_assert(c_list_is_empty(&self->internal_netns.signal_pending_lst));
     nm_assert(c_list_is_empty(&self->internal_netns.ecmp_track_ifindex_lst_head));
 
@@ -9,6 +9,7 @@
 #include "nm-manager.h"
 
 #include <fcntl.h>
+#include <fnmatch.h>
 #include <limits.h>
 #include <stdlib.h>
 #include <sys/sendfile.h>
@@ -26,6 +27,8 @@
 #include "libnm-core-aux-intern/nm-common-macros.h"
 #include "libnm-core-intern/nm-core-internal.h"
 #include "libnm-glib-aux/nm-c-list.h"
+#include "libnm-glib-aux/nm-perf-counter.h"
+#include "libnm-glib-aux/nm-perf-trace.h"
 #include "libnm-platform/nm-platform.h"
 #include "libnm-platform/nmp-object.h"
 #include "libnm-std-aux/nm-dbus-compat.h"
@@ -206,6 +209,11 @@ typedef struct {
 
     CList link_cb_lst;
 
+    /* one idle source that drains the whole @link_cb_lst queue, so that a
+     * burst of link events (e.g. hundreds of VFs appearing at once) is
+     * processed in one dispatch instead of one idle round-trip per link. */
+    GSource *link_cb_idle_source;
+
     NMCheckpointManager *checkpoint_mgr;
 
     NMSettings *settings;
@@ -709,6 +717,17 @@ _device_route_metric_data_by_ifindex_equal(gconstpointer pa, gconstpointer pb)
     return a->ifindex == b->ifindex;
 }
 
+static int
+_device_route_metric_data_cmp_by_range(gconstpointer pa, gconstpointer pb, gpointer user_data)
+{
+    const DeviceRouteMetricData *a = *((const DeviceRouteMetricData *const *) pa);
+    const DeviceRouteMetricData *b = *((const DeviceRouteMetricData *const *) pb);
+
+    NM_CMP_DIRECT(a->aspired_metric, b->aspired_metric);
+    NM_CMP_DIRECT(a->effective_metric, b->effective_metric);
+    return 0;
+}
+
 static guint32
 _device_route_metric_get(NMManager   *self,
                          int          ifindex,
@@ -815,53 +834,78 @@ initited:
     data =
         _device_route_metric_data_new(ifindex, nm_device_get_route_metric_default(device_type), 0);
 
-    /* unfortunately, there is no stright forward way to lookup all reserved metrics.
+    /* unfortunately, there is no straight forward way to lookup all reserved metrics.
      * Note, that we don't only have to know which metrics are currently reserved,
      * but also, which metrics are now seemingly un-used but caused another reserved
-     * metric to be bumped. Hence, the naive O(n^2) search :(
+     * metric to be bumped.
      *
-     * Well, technically, since we limit bumping the metric to 50, this entire
-     * loop runs at most 50 times, so it's still O(n). Let's just say, it's not
-     * very efficient. */
-again:
-    g_hash_table_iter_init(&h_iter, priv->device_route_metrics);
-    while (g_hash_table_iter_next(&h_iter, NULL, (gpointer *) &d2)) {
-        if (data->effective_metric < d2->aspired_metric
-            || data->effective_metric > d2->effective_metric) {
-            /* no overlap. Skip. */
-            continue;
-        }
-        if (!cleaned && !nm_platform_link_get(priv->platform, d2->ifindex)) {
-            /* the metric seems taken, but there is no such interface. This entry
-             * is stale, forget about it. */
-            g_hash_table_iter_remove(&h_iter);
-            continue;
+     * Sort the reserved ranges by their start and sweep over them once: as
+     * long as our candidate metric falls into a range, it gets bumped past
+     * that range's end; once a range starts above the candidate, no later
+     * range can contain it either and we are done. */
+    {
+        gs_free const DeviceRouteMetricData **entries = NULL;
+        guint                                 n_entries;
+        guint                                 i;
+
+        n_entries = 0;
+        entries   = g_new(const DeviceRouteMetricData *, g_hash_table_size(priv->device_route_metrics));
+        g_hash_table_iter_init(&h_iter, priv->device_route_metrics);
+        while (g_hash_table_iter_next(&h_iter, NULL, (gpointer *) &d2)) {
+            if (!cleaned && !nm_platform_link_get(priv->platform, d2->ifindex)) {
+                /* the entry is for an interface that no longer exists. It
+                 * is stale, forget about it. */
+                g_hash_table_iter_remove(&h_iter);
+                continue;
+            }
+            entries[n_entries++] = d2;
         }
 
-        if (d2->effective_metric == G_MAXUINT32) {
-            /* we cannot bump the metric any further. Done.
-             *
-             * Actually, this can currently not happen because the aspired_metric
-             * are small numbers and we limit the bumping to 50. Still, for
-             * completeness... */
-            data->effective_metric = G_MAXUINT32;
-            break;
+        if (n_entries > 1) {
+            g_qsort_with_data(entries,
+                              n_entries,
+                              sizeof(const DeviceRouteMetricData *),
+                              _device_route_metric_data_cmp_by_range,
+                              NULL);
         }
 
-        if (d2->effective_metric - data->aspired_metric >= 50) {
-            /* as one active interface reserves an entire range of metrics
-             * (from aspired_metric to effective_metric), that means if you
-             * alternatingly activate two interfaces, their metric will
-             * bump each other.
-             *
-             * Limit this, bump the metric at most 50 points. */
-            data->effective_metric = data->aspired_metric + 50;
-            break;
-        }
+        for (i = 0; i < n_entries; i++) {
+            d2 = entries[i];
+
+            if (d2->aspired_metric > data->effective_metric) {
+                /* this range (and all following ones) starts above our
+                 * candidate. Done. */
+                break;
+            }
+            if (data->effective_metric > d2->effective_metric) {
+                /* no overlap. Skip. */
+                continue;
+            }
+
+            if (d2->effective_metric == G_MAXUINT32) {
+                /* we cannot bump the metric any further. Done.
+                 *
+                 * Actually, this can currently not happen because the aspired_metric
+                 * are small numbers and we limit the bumping to 50. Still, for
+                 * completeness... */
+                data->effective_metric = G_MAXUINT32;
+                break;
+            }
+
+            if (d2->effective_metric - data->aspired_metric >= 50) {
+                /* as one active interface reserves an entire range of metrics
+                 * (from aspired_metric to effective_metric), that means if you
+                 * alternatingly activate two interfaces, their metric will
+                 * bump each other.
+                 *
+                 * Limit this, bump the metric at most 50 points. */
+                data->effective_metric = data->aspired_metric + 50;
+                break;
+            }
 
-        /* bump the metric, and search again. */
-        data->effective_metric = d2->effective_metric + 1;
-        goto again;
+            /* bump the metric past this range, and continue the sweep. */
+            data->effective_metric = d2->effective_metric + 1;
+        }
     }
 
     _LOGT(LOGD_DEVICE,
@@ -1177,9 +1221,37 @@ active_connection_find_by_connection(NMManager              *self,
 
 typedef struct {
     NMManager *self;
-    gboolean   for_auto_activation;
+
+    /* the set of NMSettingsConnections that have an active-connection in state
+     * activated, activating, or waiting to be activated. Computed once, so that
+     * the filter doesn't scan the active-connections list for every profile. */
+    GHashTable *sett_conns_active;
+
+    gboolean for_auto_activation;
 } GetActivatableConnectionsFilterData;
 
+static GHashTable *
+_get_activatable_connections_active_set(NMManager *self)
+{
+    NMManagerPrivate   *priv = NM_MANAGER_GET_PRIVATE(self);
+    GHashTable         *set  = NULL;
+    NMActiveConnection *ac;
+
+    c_list_for_each_entry (ac, &priv->active_connections_lst_head, active_connections_lst) {
+        NMSettingsConnection *ac_conn;
+
+        if (nm_active_connection_get_state(ac) > NM_ACTIVE_CONNECTION_STATE_ACTIVATED)
+            continue;
+        ac_conn = nm_active_connection_get_settings_connection(ac);
+        if (!ac_conn)
+            continue;
+        if (!set)
+            set = g_hash_table_new(nm_direct_hash, NULL);
+        g_hash_table_add(set, ac_conn);
+    }
+    return set;
+}
+
 static gboolean
 _get_activatable_connections_filter(NMSettings           *settings,
                                     NMSettingsConnection *sett_conn,
@@ -1202,12 +1274,7 @@ _get_activatable_connections_filter(NMSettings           *settings,
 
     /* the connection is activatable, if it has no active-connections that are in state
      * activated, activating, or waiting to be activated. */
-    return !active_connection_find(d->self,
-                                   sett_conn,
-                                   NULL,
-                                   NM_ACTIVE_CONNECTION_STATE_ACTIVATED,
-                                   FALSE,
-                                   NULL);
+    return !d->sett_conns_active || !g_hash_table_contains(d->sett_conns_active, sett_conn);
 }
 
 NMSettingsConnection **
@@ -1216,10 +1283,13 @@ nm_manager_get_activatable_connections(NMManager *manager,
                                        gboolean   sort,
                                        guint     *out_len)
 {
-    NMManagerPrivate                         *priv = NM_MANAGER_GET_PRIVATE(manager);
-    const GetActivatableConnectionsFilterData d    = {
-           .self                = manager,
-           .for_auto_activation = for_auto_activation,
+    NMManagerPrivate              *priv = NM_MANAGER_GET_PRIVATE(manager);
+    gs_unref_hashtable GHashTable *sett_conns_active =
+        _get_activatable_connections_active_set(manager);
+    const GetActivatableConnectionsFilterData d = {
+        .self                = manager,
+        .sett_conns_active   = sett_conns_active,
+        .for_auto_activation = for_auto_activation,
     };
 
     return nm_settings_get_connections_clone(
@@ -1716,6 +1786,98 @@ nm_manager_notify_delete_settings_connections(NMManager *self, NMSettingsConnect
 
 /*****************************************************************************/
 
+static void
+_perf_counter_dump_cb(const char *name, guint64 count, gpointer user_data)
+{
+    NMManager *self = user_data;
+
+    _LOGI(LOGD_CORE, "perf: %s: %" G_GUINT64_FORMAT, name, count);
+}
+
+static void
+_perf_trace_dump_cb(guint64     seq,
+                    gint64      timestamp_nsec,
+                    const char *event_name,
+                    guint64     arg,
+                    const char *detail,
+                    gpointer    user_data)
+{
+    NMManager *self = user_data;
+
+    _LOGI(LOGD_CORE,
+          "perf: trace: %" G_GUINT64_FORMAT ": [%" G_GINT64_FORMAT ".%06lld] %s arg=%" G_GUINT64_FORMAT
+          "%s%s",
+          seq,
+          timestamp_nsec / NM_UTILS_NSEC_PER_SEC,
+          (long long) ((timestamp_nsec % NM_UTILS_NSEC_PER_SEC) / 1000),
+          event_name,
+          arg,
+          detail ? " " : "",
+          detail ?: "");
+}
+
+static void
+_debug_state_dump(NMManager *self, const char *path)
+{
+    NMManagerPrivate            *priv  = NM_MANAGER_GET_PRIVATE(self);
+    gs_unref_ptrarray GPtrArray *links = NULL;
+    FILE                        *f;
+    NMDevice                    *device;
+    NMActiveConnection          *ac;
+    guint                        n_connections;
+    guint                        i;
+    char                         sbuf[NM_UTILS_TO_STRING_BUFFER_SIZE];
+
+    f = fopen(path, "we");
+    if (!f) {
+        _LOGW(LOGD_CORE, "state-dump: failure to write %s: %s", path, g_strerror(errno));
+        return;
+    }
+
+    fprintf(f,
+            "# NetworkManager state dump (format 1, version " NM_DIST_VERSION ", pid %lld)\n",
+            (long long) getpid());
+
+    fprintf(f, "\n[platform-links]\n");
+    links = nm_platform_link_get_all(priv->platform);
+    for (i = 0; links && i < links->len; i++) {
+        fprintf(f,
+                "%s\n",
+                nm_platform_link_to_string(NMP_OBJECT_CAST_LINK(links->pdata[i]),
+                                           sbuf,
+                                           sizeof(sbuf)));
+    }
+
+    fprintf(f, "\n[devices]\n");
+    c_list_for_each_entry (device, &priv->devices_lst_head, devices_lst) {
+        fprintf(f,
+                "%d: %s: type=%s, state=%s, managed=%d, path=%s\n",
+                nm_device_get_ifindex(device),
+                nm_device_get_iface(device),
+                nm_device_get_type_desc(device),
+                nm_device_state_to_string(nm_device_get_state(device)),
+                (int) nm_device_get_managed(device, FALSE),
+                nm_dbus_object_get_path(NM_DBUS_OBJECT(device)) ?: "(none)");
+    }
+
+    fprintf(f, "\n[active-connections]\n");
+    c_list_for_each_entry (ac, &priv->active_connections_lst_head, active_connections_lst) {
+        device = nm_active_connection_get_device(ac);
+        fprintf(f,
+                "%s: state=%d, device=%s\n",
+                nm_active_connection_get_settings_connection_id(ac) ?: "(unknown)",
+                (int) nm_active_connection_get_state(ac),
+                device ? nm_device_get_iface(device) : "(none)");
+    }
+
+    nm_settings_get_connections(priv->settings, &n_connections);
+    fprintf(f, "\n[settings]\nconnections=%u\n", n_connections);
+
+    fclose(f);
+
+    _LOGI(LOGD_CORE, "state-dump: wrote daemon state snapshot to %s", path);
+}
+
 static void
 _config_changed_cb(NMConfig           *config,
                    NMConfigData       *config_data,
@@ -1723,6 +1885,51 @@ _config_changed_cb(NMConfig           *config,
                    NMConfigData       *old_data,
                    NMManager          *self)
 {
+    if (NM_FLAGS_HAS(changes, NM_CONFIG_CHANGE_CAUSE_SIGUSR1)) {
+        nm_perf_counter_foreach(_perf_counter_dump_cb, self);
+        nm_perf_trace_dump(_perf_trace_dump_cb, self);
+        nm_logging_flight_recorder_dump(NMRUNDIR "/flight-recorder.log");
+        _debug_state_dump(self, NMRUNDIR "/state-dump.log");
+    }
+
+    {
+        gs_free char *df_new = NULL;
+        gs_free char *df_old = NULL;
+
+        df_new = nm_config_data_get_value(config_data,
+                                          NM_CONFIG_KEYFILE_GROUP_LOGGING,
+                                          NM_CONFIG_KEYFILE_KEY_LOGGING_DEVICE_FILTER,
+                                          NM_CONFIG_GET_VALUE_STRIP | NM_CONFIG_GET_VALUE_NO_EMPTY);
+        df_old = nm_config_data_get_value(old_data,
+                                          NM_CONFIG_KEYFILE_GROUP_LOGGING,
+                                          NM_CONFIG_KEYFILE_KEY_LOGGING_DEVICE_FILTER,
+                                          NM_CONFIG_GET_VALUE_STRIP | NM_CONFIG_GET_VALUE_NO_EMPTY);
+        if (!nm_streq0(df_new, df_old))
+            nm_logging_setup_device_filter(df_new);
+    }
+
+    {
+        gint64 fr_new;
+        gint64 fr_old;
+
+        fr_new = nm_config_data_get_value_int64(config_data,
+                                                NM_CONFIG_KEYFILE_GROUP_LOGGING,
+                                                NM_CONFIG_KEYFILE_KEY_LOGGING_FLIGHT_RECORDER_SIZE,
+                                                10,
+                                                0,
+                                                G_MAXINT32,
+                                                0);
+        fr_old = nm_config_data_get_value_int64(old_data,
+                                                NM_CONFIG_KEYFILE_GROUP_LOGGING,
+                                                NM_CONFIG_KEYFILE_KEY_LOGGING_FLIGHT_RECORDER_SIZE,
+                                                10,
+                                                0,
+                                                G_MAXINT32,
+                                                0);
+        if (fr_new != fr_old)
+            nm_logging_setup_flight_recorder(fr_new);
+    }
+
     g_object_freeze_notify(G_OBJECT(self));
 
     if (NM_FLAGS_HAS(changes, NM_CONFIG_CHANGE_GLOBAL_DNS_CONFIG))
@@ -4305,10 +4512,8 @@ add:
 }
 
 typedef struct {
-    CList      lst;
-    NMManager *self;
-    int        ifindex;
-    guint      idle_id;
+    CList lst;
+    int   ifindex;
 } PlatformLinkCbData;
 
 static gboolean
@@ -4351,48 +4556,54 @@ _check_remove_dev_on_link_deleted(NMManager *self, NMDevice *device)
 }
 
 static gboolean
-_platform_link_cb_idle(PlatformLinkCbData *data)
+_platform_link_cb_idle(gpointer user_data)
 {
-    int                   ifindex = data->ifindex;
-    NMManager            *self    = data->self;
-    NMManagerPrivate     *priv    = NM_MANAGER_GET_PRIVATE(self);
-    const NMPlatformLink *plink;
+    NMManager          *self = user_data;
+    NMManagerPrivate   *priv = NM_MANAGER_GET_PRIVATE(self);
+    PlatformLinkCbData *data;
 
-    c_list_unlink_stale(&data->lst);
-    g_slice_free(PlatformLinkCbData, data);
+    nm_clear_g_source_inst(&priv->link_cb_idle_source);
 
-    plink = nm_platform_link_get(priv->platform, ifindex);
-    if (plink) {
-        const NMPObject *plink_keep_alive = nmp_object_ref(NMP_OBJECT_UP_CAST(plink));
+    while ((data = c_list_first_entry(&priv->link_cb_lst, PlatformLinkCbData, lst))) {
+        int                   ifindex = data->ifindex;
+        const NMPlatformLink *plink;
 
-        platform_link_added(self, ifindex, plink, FALSE, NULL);
-        nmp_object_unref(plink_keep_alive);
-    } else {
-        NMDevice *device;
-        GError   *error = NULL;
+        c_list_unlink_stale(&data->lst);
+        g_slice_free(PlatformLinkCbData, data);
 
-        device = nm_manager_get_device_by_ifindex(self, ifindex);
-        if (device) {
-            if (nm_device_is_software(device)) {
-                nm_device_sys_iface_state_set(device, NM_DEVICE_SYS_IFACE_STATE_REMOVED);
-                if (!nm_device_unrealize(device, FALSE, &error)) {
-                    _LOG2W(LOGD_DEVICE, device, "failed to unrealize: %s", error->message);
-                    g_clear_error(&error);
-                    remove_device(self, device, FALSE);
-                } else {
-                    if (_check_remove_dev_on_link_deleted(self, device))
+        plink = nm_platform_link_get(priv->platform, ifindex);
+        if (plink) {
+            const NMPObject *plink_keep_alive = nmp_object_ref(NMP_OBJECT_UP_CAST(plink));
+
+            platform_link_added(self, ifindex, plink, FALSE, NULL);
+            nmp_object_unref(plink_keep_alive);
+        } else {
+            NMDevice *device;
+            GError   *error = NULL;
+
+            device = nm_manager_get_device_by_ifindex(self, ifindex);
+            if (device) {
+                if (nm_device_is_software(device)) {
+                    nm_device_sys_iface_state_set(device, NM_DEVICE_SYS_IFACE_STATE_REMOVED);
+                    if (!nm_device_unrealize(device, FALSE, &error)) {
+                        _LOG2W(LOGD_DEVICE, device, "failed to unrealize: %s", error->message);
+                        g_clear_error(&error);
                         remove_device(self, device, FALSE);
-                    else
-                        nm_device_update_from_platform_link(device, NULL);
+                    } else {
+                        if (_check_remove_dev_on_link_deleted(self, device))
+                            remove_device(self, device, FALSE);
+                        else
+                            nm_device_update_from_platform_link(device, NULL);
+                    }
+                } else {
+                    /* Hardware and external devices always get removed when their kernel link is gone */
+                    remove_device(self, device, FALSE);
                 }
-            } else {
-                /* Hardware and external devices always get removed when their kernel link is gone */
-                remove_device(self, device, FALSE);
             }
         }
     }
 
-    return G_SOURCE_REMOVE;
+    return G_SOURCE_CONTINUE;
 }
 
 static void
@@ -4415,16 +4626,43 @@ platform_link_cb(NMPlatform     *platform,
         priv = NM_MANAGER_GET_PRIVATE(self);
 
         data          = g_slice_new(PlatformLinkCbData);
-        data->self    = self;
         data->ifindex = ifindex;
         c_list_link_tail(&priv->link_cb_lst, &data->lst);
-        data->idle_id = g_idle_add((GSourceFunc) _platform_link_cb_idle, data);
+        if (!priv->link_cb_idle_source)
+            priv->link_cb_idle_source = nm_g_idle_add_source(_platform_link_cb_idle, self);
         break;
     default:
         break;
     }
 }
 
+static int
+_realize_order_link_prio(const char *const *patterns, const char *name)
+{
+    int i;
+
+    for (i = 0; patterns[i]; i++) {
+        if (fnmatch(patterns[i], name ?: "", 0) == 0)
+            return i;
+    }
+    return i;
+}
+
+static int
+_realize_order_link_cmp(gconstpointer pa, gconstpointer pb, gpointer user_data)
+{
+    const char *const    *patterns = user_data;
+    const NMPlatformLink *a        = NMP_OBJECT_CAST_LINK(*((const NMPObject *const *) pa));
+    const NMPlatformLink *b        = NMP_OBJECT_CAST_LINK(*((const NMPObject *const *) pb));
+
+    NM_CMP_DIRECT(_realize_order_link_prio(patterns, a->name),
+                  _realize_order_link_prio(patterns, b->name));
+
+    /* keep the platform (ifindex) order among links of equal priority. */
+    NM_CMP_DIRECT(a->ifindex, b->ifindex);
+    return 0;
+}
+
 static void
 platform_query_devices(NMManager *self)
 {
@@ -4439,6 +4677,24 @@ platform_query_devices(NMManager *self)
     if (!links)
         return;
 
+    order = nm_config_data_get_value(nm_config_get_data(priv->config),
+                                     NM_CONFIG_KEYFILE_GROUP_MAIN,
+                                     NM_CONFIG_KEYFILE_KEY_MAIN_DEVICE_REALIZE_ORDER,
+                                     NM_CONFIG_GET_VALUE_STRIP | NM_CONFIG_GET_VALUE_NO_EMPTY);
+    if (order) {
+        gs_free const char **patterns = NULL;
+
+        /* "main.device-realize-order" is a comma separated list of interface
+         * name patterns. Links matching an earlier pattern are realized
+         * first, so that on hosts with very many interfaces (e.g. SR-IOV
+         * VFs) the business-critical uplinks don't wait behind hundreds of
+         * irrelevant links before they can start activating. Unmatched
+         * links sort last, in their platform order. */
+        patterns = nm_strsplit_set(order, ", ");
+        if (patterns)
+            g_ptr_array_sort_with_data(links, _realize_order_link_cmp, patterns);
+    }
+
     for (i = 0; i < links->len; i++) {
         const NMPlatformLink          *elem = NMP_OBJECT_CAST_LINK(links->pdata[i]);
         const NMPlatformLink          *link;
@@ -4951,32 +5207,50 @@ find_master(NMManager             *self,
           nm_connection_get_id(connection),
           nm_connection_get_uuid(connection));
 
-    connections = nm_settings_get_connections_sorted_by_autoconnect_priority(priv->settings, NULL);
-    for (i = 0; connections[i]; i++) {
-        NMConnection *master_candidate = nm_settings_connection_get_connection(connections[i]);
+    /* A controller referenced by UUID can be resolved directly through the
+     * UUID index, without scanning all profiles. */
+    master_connection = nm_settings_get_connection_by_uuid(priv->settings, master);
+    if (master_connection) {
+        NMConnection *master_candidate = nm_settings_connection_get_connection(master_connection);
         NMDevice     *device_candidate;
 
-        if (nm_streq(nm_connection_get_uuid(master_candidate), master)) {
-            if (!is_compatible_with_slave(master_candidate, connection)) {
-                g_set_error(error,
-                            NM_MANAGER_ERROR,
-                            NM_MANAGER_ERROR_DEPENDENCY_FAILED,
-                            "The active connection on %s is not compatible",
-                            nm_device_get_iface(master_device));
-                return FALSE;
+        if (!is_compatible_with_slave(master_candidate, connection)) {
+            g_set_error(error,
+                        NM_MANAGER_ERROR,
+                        NM_MANAGER_ERROR_DEPENDENCY_FAILED,
+                        "The active connection on %s is not compatible",
+                        nm_device_get_iface(master_device));
+            return FALSE;
+        }
+
+        _LOGD(LOGD_CORE,
+              "Will consider using connection '%s' (%s) as a master for '%s' (%s) "
+              "because UUID matches",
+              nm_connection_get_id(master_candidate),
+              nm_connection_get_uuid(master_candidate),
+              nm_connection_get_id(connection),
+              nm_connection_get_uuid(connection));
+
+        c_list_for_each_entry (device_candidate, &priv->devices_lst_head, devices_lst) {
+            if (device_candidate == device)
+                continue;
+
+            if (nm_device_get_settings_connection(device_candidate) == master_connection) {
+                master_device = device_candidate;
+                break;
             }
+        }
 
-            _LOGD(LOGD_CORE,
-                  "Will consider using connection '%s' (%s) as a master for '%s' (%s) "
-                  "because UUID matches",
-                  nm_connection_get_id(master_candidate),
-                  nm_connection_get_uuid(master_candidate),
-                  nm_connection_get_id(connection),
-                  nm_connection_get_uuid(connection));
+        goto found;
+    }
+
+    connections = nm_settings_get_connections_sorted_by_autoconnect_priority(priv->settings, NULL);
+    for (i = 0; connections[i]; i++) {
+        NMConnection *master_candidate = nm_settings_connection_get_connection(connections[i]);
+        NMDevice     *device_candidate;
 
-            master_connection = connections[i];
-        } else if (nm_connection_get_interface_name(master_candidate)
-                   && nm_streq(nm_connection_get_interface_name(master_candidate), master)) {
+        if (nm_connection_get_interface_name(master_candidate)
+            && nm_streq(nm_connection_get_interface_name(master_candidate), master)) {
             if (!is_compatible_with_slave(master_candidate, connection))
                 continue;
 
@@ -5021,6 +5295,7 @@ find_master(NMManager             *self,
         }
     }
 
+found:
     if (!master_connection) {
         master_device = find_device_by_iface(self, master, NULL, connection, NULL);
         if (!master_device) {
@@ -6355,6 +6630,74 @@ nm_manager_activate_connection(NMManager             *self,
     return active;
 }
 
+/* Admission control for user-requested activations. A client that floods
+ * ActivateConnection/AddAndActivateConnection (e.g. an orchestrator re-issuing
+ * hundreds of calls after a failover) can otherwise queue an unbounded number
+ * of authorization chains and activating connections. Count what the
+ * requesting D-Bus client already has in flight -- pending authorization
+ * requests plus active connections that did not yet reach ACTIVATED state --
+ * and reject requests beyond the configured limit. The limit applies
+ * per-client, so one greedy client cannot crowd out others, and the rejected
+ * caller gets an immediate error as backpressure instead of a late timeout. */
+static gboolean
+_activation_admission_check(NMManager *self, NMAuthSubject *subject, GError **error)
+{
+    NMManagerPrivate   *priv = NM_MANAGER_GET_PRIVATE(self);
+    AsyncOpData        *async_op_data;
+    NMActiveConnection *ac;
+    const char         *sender;
+    gint64              limit;
+    guint               n = 0;
+
+    limit = nm_config_data_get_value_int64(nm_config_get_data(priv->config),
+                                           NM_CONFIG_KEYFILE_GROUP_MAIN,
+                                           NM_CONFIG_KEYFILE_KEY_MAIN_MAX_ACTIVATIONS_PER_CLIENT,
+                                           10,
+                                           0,
+                                           G_MAXINT32,
+                                           0);
+    if (limit <= 0)
+        return TRUE;
+
+    sender = nm_auth_subject_get_unix_process_dbus_sender(subject);
+    if (!sender)
+        return TRUE;
+
+    c_list_for_each_entry (async_op_data, &priv->async_op_lst_head, async_op_lst) {
+        NMAuthSubject *s;
+
+        if (!NM_IN_SET(async_op_data->async_op_type,
+                       ASYNC_OP_TYPE_AC_AUTH_ACTIVATE_USER,
+                       ASYNC_OP_TYPE_AC_AUTH_ADD_AND_ACTIVATE,
+                       ASYNC_OP_TYPE_AC_AUTH_ADD_AND_ACTIVATE2))
+            continue;
+        s = nm_active_connection_get_subject(async_op_data->ac_auth.active);
+        if (s && nm_streq0(nm_auth_subject_get_unix_process_dbus_sender(s), sender))
+            n++;
+    }
+
+    c_list_for_each_entry (ac, &priv->active_connections_lst_head, active_connections_lst) {
+        NMAuthSubject *s;
+
+        if (nm_active_connection_get_state(ac) >= NM_ACTIVE_CONNECTION_STATE_ACTIVATED)
+            continue;
+        s = nm_active_connection_get_subject(ac);
+        if (s && nm_streq0(nm_auth_subject_get_unix_process_dbus_sender(s), sender))
+            n++;
+    }
+
+    if (n >= limit) {
+        g_set_error(error,
+                    NM_MANAGER_ERROR,
+                    NM_MANAGER_ERROR_FAILED,
+                    "Client has %u activations in progress (limit %u), retry later",
+                    n,
+                    (guint) limit);
+        return FALSE;
+    }
+    return TRUE;
+}
+
 /**
  * validate_activation_request:
  * @self: the #NMManager
@@ -6419,6 +6762,9 @@ validate_activation_request(NMManager             *self,
                                              error))
         return NULL;
 
+    if (!_activation_admission_check(self, subject, error))
+        return NULL;
+
     is_vpn = _connection_is_vpn(connection);
 
     if (*out_device) {
@@ -9121,10 +9467,10 @@ dispose(GObject *object)
     nm_assert(c_list_is_empty(&priv->async_op_lst_head));
 
     g_signal_handlers_disconnect_by_func(priv->platform, G_CALLBACK(platform_link_cb), self);
+    nm_clear_g_source_inst(&priv->link_cb_idle_source);
     while ((iter = c_list_first(&priv->link_cb_lst))) {
         PlatformLinkCbData *data = c_list_entry(iter, PlatformLinkCbData, lst);
 
-        g_source_remove(data->idle_id);
         c_list_unlink_stale(&data->lst);
         g_slice_free(PlatformLinkCbData, data);
     }
@@ -85,6 +85,11 @@ typedef struct {
 
     CList    l3cfg_signal_pending_lst_head;
     GSource *signal_pending_idle_source;
+
+    /* The lowest subnet number that may be unused in "shared_ips". All subnet
+     * numbers below are known to be reserved. This makes repeated
+     * reservations amortized O(1) instead of re-probing from the start. */
+    guint32 shared_ips_first_free_hint;
 } NMNetnsPrivate;
 
 struct _NMNetns {
@@ -587,21 +592,26 @@ nm_netns_shared_ip_reserve(NMNetns *self)
     priv = NM_NETNS_GET_PRIVATE(self);
 
     if (!priv->shared_ips) {
-        addr             = addr_start;
-        priv->shared_ips = g_hash_table_new(nm_puint32_hash, nm_puint32_equal);
+        addr                             = addr_start;
+        priv->shared_ips                 = g_hash_table_new(nm_puint32_hash, nm_puint32_equal);
+        priv->shared_ips_first_free_hint = 1u;
         g_object_ref(self);
     } else {
         guint32 count;
 
         nm_assert(g_hash_table_size(priv->shared_ips) > 0);
 
-        count = 0u;
+        /* All subnet numbers below the hint are reserved. Start probing
+         * there, instead of re-scanning the full range every time. */
+        count = NM_MIN(priv->shared_ips_first_free_hint, 0xFFu);
         for (;;) {
             addr = addr_start + htonl(count << 8u);
 
             handle = g_hash_table_lookup(priv->shared_ips, &addr);
-            if (!handle)
+            if (!handle) {
+                priv->shared_ips_first_free_hint = count + 1u;
                 break;
+            }
 
             count++;
 
@@ -662,6 +672,9 @@ nm_netns_shared_ip_release(NMNetnsSharedIPHandle *handle)
     if (!g_hash_table_remove(priv->shared_ips, handle))
         nm_assert_not_reached();
 
+    priv->shared_ips_first_free_hint =
+        NM_MIN(priv->shared_ips_first_free_hint, (ntohl(handle->addr) - 0x0A2A0001u) >> 8u);
+
     if (g_hash_table_size(priv->shared_ips) == 0) {
         nm_clear_pointer(&priv->shared_ips, g_hash_table_unref);
         g_object_unref(self);
@@ -822,8 +822,9 @@ update_system_hostname(NMPolicy *self, const char *msg)
     const char            *dhcp_hostname, *p;
     gboolean               external_hostname = FALSE;
     NMDhcpConfig          *dhcp_config;
-    gs_unref_array GArray *infos = NULL;
+    gs_unref_array GArray *infos   = NULL;
     DeviceHostnameInfo    *info;
+    gboolean               waiting = FALSE;
     guint                  i;
     int                    addr_family;
 
@@ -899,7 +900,7 @@ update_system_hostname(NMPolicy *self, const char *msg)
         g_signal_handlers_disconnect_by_func(info->device, device_dns_lookup_done, self);
         g_signal_handlers_disconnect_by_func(info->device, device_carrier_changed, priv);
 
-        if (info->from_dhcp) {
+        if (info->from_dhcp && !waiting) {
             dhcp_config = nm_device_get_dhcp_config(info->device, addr_family);
             if (dhcp_config) {
                 dhcp_hostname =
@@ -927,6 +928,10 @@ update_system_hostname(NMPolicy *self, const char *msg)
                 gboolean    wait   = FALSE;
 
                 if (nm_device_has_carrier(info->device)) {
+                    /* This starts the lookup (or returns the cached result)
+                     * also while we wait for a higher-priority candidate, so
+                     * that the resolvers run in parallel and a fallback
+                     * result is ready if the preferred one fails. */
                     result =
                         nm_device_get_hostname_from_dns_lookup(info->device, addr_family, &wait);
                 } else {
@@ -935,21 +940,24 @@ update_system_hostname(NMPolicy *self, const char *msg)
                                      G_CALLBACK(device_carrier_changed),
                                      priv);
                 }
-                if (result) {
+                if (result && !waiting) {
                     _set_hostname(self, result, "from address lookup");
                     return;
                 }
-                if (wait) {
+                if (wait && !waiting) {
+                    waiting = TRUE;
                     g_signal_connect(info->device,
                                      NM_DEVICE_DNS_LOOKUP_DONE,
                                      G_CALLBACK(device_dns_lookup_done),
                                      self);
-                    return;
                 }
             }
         }
     }
 
+    if (waiting)
+        return;
+
     /* If an hostname was set outside NetworkManager keep it */
     if (external_hostname)
         return;
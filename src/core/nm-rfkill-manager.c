@@ -28,6 +28,8 @@ typedef struct {
     NMRfkillState rfkill_states[NM_RFKILL_TYPE_MAX];
 
     CList killswitch_lst_head;
+
+    guint recheck_id;
 } NMRfkillManagerPrivate;
 
 struct _NMRfkillManager {
@@ -53,8 +55,12 @@ typedef struct {
     char        *driver;
     guint64      seqnum;
     NMRfkillType rtype;
-    int          state;
-    bool         platform : 1;
+
+    /* Last known state of the switch, kept current from the udev events
+     * themselves so that rechecks don't need to re-read sysfs. */
+    NMRfkillState state;
+
+    bool platform : 1;
 } Killswitch;
 
 NMRfkillState
@@ -185,6 +191,28 @@ sysfs_state_to_nm_state(int sysfs_state)
     return NM_RFKILL_STATE_UNBLOCKED;
 }
 
+static void
+killswitch_update_state(Killswitch *ks, struct udev_device *device)
+{
+    int sysfs_state;
+
+    sysfs_state =
+        _nm_utils_ascii_str_to_int64(udev_device_get_property_value(device, "RFKILL_STATE"),
+                                     10,
+                                     G_MININT,
+                                     G_MAXINT,
+                                     -1);
+    ks->state = sysfs_state_to_nm_state(sysfs_state);
+
+    nm_log_dbg(LOGD_RFKILL,
+               "%s rfkill%s switch %s state now %d/%s",
+               nm_rfkill_type_to_string(ks->rtype),
+               ks->platform ? " platform" : "",
+               ks->name,
+               sysfs_state,
+               nm_rfkill_state_to_string(ks->state));
+}
+
 static void
 recheck_killswitches(NMRfkillManager *self)
 {
@@ -202,43 +230,18 @@ recheck_killswitches(NMRfkillManager *self)
         platform_checked[i] = FALSE;
     }
 
-    /* Poll the states of all killswitches */
+    /* Aggregate the cached states of all killswitches. The per-switch state
+     * is kept up to date from the udev events, no need to go back to
+     * sysfs here. */
     c_list_for_each_entry (ks, &priv->killswitch_lst_head, killswitch_lst) {
-        struct udev_device *device;
-        NMRfkillState       dev_state;
-        int                 sysfs_state;
-
-        device = udev_device_new_from_subsystem_sysname(nm_udev_client_get_udev(priv->udev_client),
-                                                        "rfkill",
-                                                        ks->name);
-        if (!device)
-            continue;
-        sysfs_state =
-            _nm_utils_ascii_str_to_int64(udev_device_get_property_value(device, "RFKILL_STATE"),
-                                         10,
-                                         G_MININT,
-                                         G_MAXINT,
-                                         -1);
-        dev_state = sysfs_state_to_nm_state(sysfs_state);
-
-        nm_log_dbg(LOGD_RFKILL,
-                   "%s rfkill%s switch %s state now %d/%s",
-                   nm_rfkill_type_to_string(ks->rtype),
-                   ks->platform ? " platform" : "",
-                   ks->name,
-                   sysfs_state,
-                   nm_rfkill_state_to_string(dev_state));
-
         if (ks->platform == FALSE) {
-            if (dev_state > poll_states[ks->rtype])
-                poll_states[ks->rtype] = dev_state;
+            if (ks->state > poll_states[ks->rtype])
+                poll_states[ks->rtype] = ks->state;
         } else {
             platform_checked[ks->rtype] = TRUE;
-            if (dev_state > platform_states[ks->rtype])
-                platform_states[ks->rtype] = dev_state;
+            if (ks->state > platform_states[ks->rtype])
+                platform_states[ks->rtype] = ks->state;
         }
-
-        udev_device_unref(device);
     }
 
     /* Log and emit change signal for final rfkill states */
@@ -267,6 +270,29 @@ recheck_killswitches(NMRfkillManager *self)
     }
 }
 
+static gboolean
+recheck_killswitches_cb(gpointer user_data)
+{
+    NMRfkillManager        *self = NM_RFKILL_MANAGER(user_data);
+    NMRfkillManagerPrivate *priv = NM_RFKILL_MANAGER_GET_PRIVATE(self);
+
+    priv->recheck_id = 0;
+    recheck_killswitches(self);
+    return G_SOURCE_REMOVE;
+}
+
+static void
+recheck_killswitches_schedule(NMRfkillManager *self)
+{
+    NMRfkillManagerPrivate *priv = NM_RFKILL_MANAGER_GET_PRIVATE(self);
+
+    /* udev emits bursts of rfkill events, for example while docking or
+     * undocking. Coalesce them into one state evaluation per main loop
+     * iteration. */
+    if (priv->recheck_id == 0)
+        priv->recheck_id = g_idle_add(recheck_killswitches_cb, self);
+}
+
 static Killswitch *
 killswitch_find_by_name(NMRfkillManager *self, const char *name)
 {
@@ -309,6 +335,8 @@ add_one_killswitch(NMRfkillManager *self, struct udev_device *device)
     ks = killswitch_new(device, rtype);
     c_list_link_front(&priv->killswitch_lst_head, &ks->killswitch_lst);
 
+    killswitch_update_state(ks, device);
+
     nm_log_info(LOGD_RFKILL,
                 "%s: found %s radio killswitch (at %s) (%sdriver %s)",
                 ks->name,
@@ -378,8 +406,15 @@ handle_uevent(NMUdevClient *client, struct udev_device *device, gpointer user_da
         rfkill_add(self, device);
     else if (nm_streq(action, "remove"))
         rfkill_remove(self, device);
+    else if (nm_streq(action, "change")) {
+        Killswitch *ks;
 
-    recheck_killswitches(self);
+        ks = killswitch_find_by_name(self, udev_device_get_sysname(device));
+        if (ks)
+            killswitch_update_state(ks, device);
+    }
+
+    recheck_killswitches_schedule(self);
 }
 
 /*****************************************************************************/
@@ -431,6 +466,8 @@ dispose(GObject *object)
     NMRfkillManagerPrivate *priv = NM_RFKILL_MANAGER_GET_PRIVATE(self);
     Killswitch             *ks;
 
+    nm_clear_g_source(&priv->recheck_id);
+
     while ((ks = c_list_first_entry(&priv->killswitch_lst_head, Killswitch, killswitch_lst)))
         killswitch_destroy(ks);
 
@@ -49,9 +49,18 @@ struct _NMSessionMonitor {
     struct {
         sd_login_monitor *monitor;
         GSource          *watch;
+
+        /* answers from sd_uid_get_sessions() are cached here until the
+         * next change notification. Constant session churn makes the
+         * consumers (connection visibility, agent sorting) re-ask for
+         * the same handful of uids over and over; with the cache each
+         * uid is resolved at most once per change generation. */
+        GHashTable *uid_cache;
     } sd;
 #endif
 
+    guint64 version;
+
 #if SESSION_TRACKING_CONSOLEKIT
     struct {
         GFileMonitor *monitor;
@@ -73,18 +82,42 @@ G_DEFINE_TYPE(NMSessionMonitor, nm_session_monitor, G_TYPE_OBJECT);
 /*****************************************************************************/
 
 #if SESSION_TRACKING_XLOGIND
+
+/* cache values, stored in the hash table via GUINT_TO_POINTER(). The
+ * "any"/"active" flavors of the lookup are tracked separately, each
+ * resolved lazily on first use. */
+#define ST_SD_CACHED_KNOWN_ANY     (1u << 0)
+#define ST_SD_CACHED_EXISTS_ANY    (1u << 1)
+#define ST_SD_CACHED_KNOWN_ACTIVE  (1u << 2)
+#define ST_SD_CACHED_EXISTS_ACTIVE (1u << 3)
+
 static gboolean
 st_sd_session_exists(NMSessionMonitor *monitor, uid_t uid, gboolean active)
 {
-    int status;
+    const guint flag_known  = active ? ST_SD_CACHED_KNOWN_ACTIVE : ST_SD_CACHED_KNOWN_ANY;
+    const guint flag_exists = active ? ST_SD_CACHED_EXISTS_ACTIVE : ST_SD_CACHED_EXISTS_ANY;
+    guint       cached;
+    int         status;
 
     if (!monitor->sd.monitor)
         return FALSE;
 
+    cached = GPOINTER_TO_UINT(g_hash_table_lookup(monitor->sd.uid_cache, GUINT_TO_POINTER(uid)));
+    if (cached & flag_known)
+        return !!(cached & flag_exists);
+
     status = sd_uid_get_sessions(uid, active, NULL);
 
-    if (status < 0)
+    if (status < 0) {
         _LOGE("failed to get " LOGIND_NAME " sessions for uid %d: %d", uid, status);
+        /* don't cache errors. */
+        return FALSE;
+    }
+
+    cached |= flag_known;
+    if (status > 0)
+        cached |= flag_exists;
+    g_hash_table_insert(monitor->sd.uid_cache, GUINT_TO_POINTER(uid), GUINT_TO_POINTER(cached));
 
     return status > 0;
 }
@@ -94,6 +127,9 @@ st_sd_changed(int fd, GIOCondition condition, gpointer user_data)
 {
     NMSessionMonitor *monitor = user_data;
 
+    monitor->version++;
+    g_hash_table_remove_all(monitor->sd.uid_cache);
+
     g_signal_emit(monitor, signals[CHANGED], 0);
 
     sd_login_monitor_flush(monitor->sd.monitor);
@@ -118,6 +154,8 @@ st_sd_init(NMSessionMonitor *monitor)
                                                 G_IO_IN,
                                                 st_sd_changed,
                                                 monitor);
+
+    monitor->sd.uid_cache = g_hash_table_new(nm_direct_hash, NULL);
 }
 
 static void
@@ -128,6 +166,7 @@ st_sd_finalize(NMSessionMonitor *monitor)
         monitor->sd.monitor = NULL;
     }
     nm_clear_g_source_inst(&monitor->sd.watch);
+    nm_clear_pointer(&monitor->sd.uid_cache, g_hash_table_unref);
 }
 #endif /* SESSION_TRACKING_XLOGIND */
 
@@ -238,6 +277,7 @@ ck_changed(GFileMonitor     *file_monitor,
            GFileMonitorEvent event_type,
            gpointer          user_data)
 {
+    NM_SESSION_MONITOR(user_data)->version++;
     g_signal_emit(user_data, signals[CHANGED], 0);
 }
 
@@ -304,6 +344,25 @@ nm_session_monitor_session_exists(NMSessionMonitor *self, uid_t uid, gboolean ac
     return FALSE;
 }
 
+/**
+ * nm_session_monitor_get_version:
+ * @self: the session monitor
+ *
+ * Returns a counter that increases whenever the session state changes.
+ * Callers that cache decisions derived from
+ * nm_session_monitor_session_exists() can compare versions to find out
+ * whether their cached result may still be used.
+ *
+ * Returns: the current change generation.
+ */
+guint64
+nm_session_monitor_get_version(NMSessionMonitor *self)
+{
+    g_return_val_if_fail(NM_IS_SESSION_MONITOR(self), 0);
+
+    return self->version;
+}
+
 /*****************************************************************************/
 
 static void
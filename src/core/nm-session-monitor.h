@@ -28,4 +28,6 @@ NMSessionMonitor *nm_session_monitor_get(void);
 
 gboolean nm_session_monitor_session_exists(NMSessionMonitor *self, uid_t uid, gboolean active);
 
+guint64 nm_session_monitor_get_version(NMSessionMonitor *self);
+
 #endif /* __NETWORKMANAGER_SESSION_MONITOR_H__ */
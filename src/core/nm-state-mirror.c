@@ -0,0 +1,171 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "src/core/nm-default-daemon.h"
+
+#include "nm-state-mirror.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "libnm-platform/nm-platform.h"
+#include "libnm-platform/nmp-object.h"
+#include "devices/nm-device.h"
+#include "nm-manager.h"
+
+/*****************************************************************************/
+
+#define _NMLOG_DOMAIN      LOGD_CORE
+#define _NMLOG(level, ...) __NMLOG_DEFAULT(level, _NMLOG_DOMAIN, "state-mirror", __VA_ARGS__)
+
+/*****************************************************************************/
+
+static struct {
+    NMManager          *manager;
+    NMStateMirrorState *map;
+    char               *path;
+    guint               idle_id;
+} gl;
+
+/*****************************************************************************/
+
+static void
+_mirror_fill_device(NMStateMirrorDevice *d, NMDevice *device)
+{
+    NMPlatform                  *platform = nm_device_get_platform(device);
+    const NMDedupMultiHeadEntry *head_entry;
+    NMDedupMultiIter             iter;
+    const NMPObject             *obj;
+    int                          ifindex = nm_device_get_ifindex(device);
+
+    *d = (NMStateMirrorDevice){
+        .ifindex      = ifindex,
+        .device_state = nm_device_get_state(device),
+    };
+    g_strlcpy(d->iface, nm_device_get_iface(device) ?: "", sizeof(d->iface));
+
+    head_entry = nm_platform_lookup_object(platform, NMP_OBJECT_TYPE_IP4_ADDRESS, ifindex);
+    nmp_cache_iter_for_each (&iter, head_entry, &obj) {
+        const NMPlatformIP4Address *a = NMP_OBJECT_CAST_IP4_ADDRESS(obj);
+
+        if (d->n_addrs_4 >= NM_STATE_MIRROR_MAX_ADDRS)
+            break;
+        d->addrs_4[d->n_addrs_4].address = a->address;
+        d->addrs_4[d->n_addrs_4].plen    = a->plen;
+        d->n_addrs_4++;
+    }
+
+    head_entry = nm_platform_lookup_object(platform, NMP_OBJECT_TYPE_IP6_ADDRESS, ifindex);
+    nmp_cache_iter_for_each (&iter, head_entry, &obj) {
+        const NMPlatformIP6Address *a = NMP_OBJECT_CAST_IP6_ADDRESS(obj);
+
+        if (d->n_addrs_6 >= NM_STATE_MIRROR_MAX_ADDRS)
+            break;
+        memcpy(d->addrs_6[d->n_addrs_6].address, &a->address, sizeof(a->address));
+        d->addrs_6[d->n_addrs_6].plen = a->plen;
+        d->n_addrs_6++;
+    }
+}
+
+static gboolean
+_mirror_update_cb(gpointer user_data)
+{
+    NMStateMirrorState *map = gl.map;
+    NMDevice           *device;
+    const CList        *tmp_list;
+    guint32             n = 0;
+
+    gl.idle_id = 0;
+
+    nm_assert(map);
+
+    /* seqlock write side: bump to odd, publish the data, bump to even.
+     * The atomics double as compiler barriers so the payload stores
+     * cannot be reordered across the counter updates. */
+    __atomic_fetch_add(&map->seq, 1, __ATOMIC_ACQ_REL);
+
+    nm_manager_for_each_device (gl.manager, device, tmp_list) {
+        if (n >= NM_STATE_MIRROR_MAX_DEVICES)
+            break;
+        if (nm_device_get_ifindex(device) <= 0)
+            continue;
+        _mirror_fill_device(&map->devices[n], device);
+        n++;
+    }
+    map->n_devices = n;
+
+    __atomic_fetch_add(&map->seq, 1, __ATOMIC_ACQ_REL);
+
+    return G_SOURCE_REMOVE;
+}
+
+void
+nm_state_mirror_schedule_update(void)
+{
+    if (!gl.map || gl.idle_id)
+        return;
+
+    /* coalesce bursts of property changes into one refresh per main
+     * loop iteration, after regular dispatching is done. */
+    gl.idle_id = g_idle_add_full(G_PRIORITY_LOW, _mirror_update_cb, NULL, NULL);
+}
+
+void
+nm_state_mirror_setup(NMManager *manager)
+{
+    const char       *path;
+    nm_auto_close int fd = -1;
+    gpointer          m;
+
+    nm_assert(NM_IS_MANAGER(manager));
+    nm_assert(!gl.map);
+
+    path = g_getenv("NM_STATE_MIRROR");
+    if (!path || !path[0])
+        return;
+
+    fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC | O_NOFOLLOW, 0644);
+    if (fd < 0) {
+        _LOGW("failed to open \"%s\": %s", path, nm_strerror_native(errno));
+        return;
+    }
+
+    if (ftruncate(fd, sizeof(NMStateMirrorState)) != 0) {
+        _LOGW("failed to resize \"%s\": %s", path, nm_strerror_native(errno));
+        return;
+    }
+
+    m = mmap(NULL, sizeof(NMStateMirrorState), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (m == MAP_FAILED) {
+        _LOGW("failed to mmap \"%s\": %s", path, nm_strerror_native(errno));
+        return;
+    }
+
+    gl.manager = manager;
+    gl.map     = m;
+    gl.path    = g_strdup(path);
+
+    memset(gl.map, 0, sizeof(NMStateMirrorState));
+    gl.map->version = NM_STATE_MIRROR_VERSION;
+
+    _LOGI("exporting device state to \"%s\"", path);
+
+    nm_state_mirror_schedule_update();
+}
+
+void
+nm_state_mirror_shutdown(void)
+{
+    if (!gl.map)
+        return;
+
+    nm_clear_g_source(&gl.idle_id);
+    munmap(gl.map, sizeof(NMStateMirrorState));
+    gl.map     = NULL;
+    gl.manager = NULL;
+
+    /* remove the file so that consumers don't keep reading the state of
+     * a dead daemon. */
+    unlink(gl.path);
+    nm_clear_g_free(&gl.path);
+}
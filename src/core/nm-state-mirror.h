@@ -0,0 +1,60 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+#ifndef __NM_STATE_MIRROR_H__
+#define __NM_STATE_MIRROR_H__
+
+/* An optional read-only shared-memory mirror of basic device state
+ * (device states, ifindexes, addresses) for local consumers that would
+ * otherwise poll the daemon over D-Bus.
+ *
+ * The mirror is disabled by default. It gets enabled by setting the
+ * "NM_STATE_MIRROR" environment variable to the path of the mirror file
+ * (for example "/run/NetworkManager/state-mirror"). The daemon mmaps the
+ * file read-write; consumers mmap it read-only and parse it according to
+ * the layout below.
+ *
+ * Updates are protected by a seqlock: "seq" is incremented before and
+ * after each update, so it is odd while a write is in progress. Readers
+ * must read "seq", copy the data, re-read "seq" and retry if the two
+ * values differ or are odd. There is no IPC and no wakeup; consumers
+ * poll at whatever rate they like without costing the daemon anything. */
+
+#define NM_STATE_MIRROR_VERSION 1u
+
+#define NM_STATE_MIRROR_MAX_DEVICES 64u
+#define NM_STATE_MIRROR_MAX_ADDRS   8u
+
+typedef struct {
+    gint32  ifindex;
+    guint32 device_state; /* NMDeviceState */
+    char    iface[16];    /* NUL-terminated interface name */
+    guint32 n_addrs_4;
+    guint32 n_addrs_6;
+    struct {
+        guint32 address; /* network byte order */
+        guint32 plen;
+    } addrs_4[NM_STATE_MIRROR_MAX_ADDRS];
+    struct {
+        guint8  address[16];
+        guint32 plen;
+        guint32 _reserved;
+    } addrs_6[NM_STATE_MIRROR_MAX_ADDRS];
+} NMStateMirrorDevice;
+
+typedef struct {
+    guint32 version; /* NM_STATE_MIRROR_VERSION */
+    guint32 _reserved;
+    guint32 seq; /* seqlock counter, odd while an update is in progress */
+    guint32 n_devices;
+    NMStateMirrorDevice devices[NM_STATE_MIRROR_MAX_DEVICES];
+} NMStateMirrorState;
+
+struct _NMManager;
+
+void nm_state_mirror_setup(struct _NMManager *manager);
+
+void nm_state_mirror_schedule_update(void);
+
+void nm_state_mirror_shutdown(void);
+
+#endif /* __NM_STATE_MIRROR_H__ */
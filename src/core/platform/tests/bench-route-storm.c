@@ -0,0 +1,115 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "src/core/nm-default-daemon.h"
+
+#include <linux/rtnetlink.h>
+
+#include "libnm-glib-aux/nm-time-utils.h"
+
+#include "test-common.h"
+
+#define DEVICE_IFINDEX NMTSTP_ENV1_IFINDEX
+
+/* A throughput benchmark for platform event processing, not a correctness
+ * test. It provokes an rtnetlink event storm from outside (a batch of route
+ * adds, then a flush, performed by iproute2 so that NMLinuxPlatform sees
+ * them as external changes) and measures how long the cache needs to absorb
+ * it. Run via "meson test --benchmark"; it needs the same root/namespace
+ * sandbox as the other linux platform tests. */
+
+#define STORM_N_ROUTES 2000u
+#define STORM_N_ROUNDS 5u
+
+static guint
+_count_ip4_routes(int ifindex)
+{
+    NMPLookup                   lookup;
+    const NMDedupMultiHeadEntry *head_entry;
+
+    head_entry = nm_platform_lookup(
+        NM_PLATFORM_GET,
+        nmp_lookup_init_object_by_ifindex(&lookup, NMP_OBJECT_TYPE_IP4_ROUTE, ifindex));
+    return head_entry ? head_entry->len : 0u;
+}
+
+static void
+_wait_for_route_count(int ifindex, guint target, gboolean at_least)
+{
+    NMTST_WAIT_ASSERT(60000, {
+        guint n;
+
+        nmtstp_wait_for_signal(NM_PLATFORM_GET, 10);
+        n = _count_ip4_routes(ifindex);
+        if (at_least ? (n >= target) : (n <= target))
+            break;
+    });
+}
+
+static void
+test_route_storm(void)
+{
+    int           ifindex = DEVICE_IFINDEX;
+    gs_free char *batch_file = NULL;
+    nm_auto_str_buf NMStrBuf batch = NM_STR_BUF_INIT(0, FALSE);
+    guint         n_base;
+    guint         round;
+    guint         i;
+    gint64        start_msec;
+    gint64        elapsed_msec;
+    guint64       n_events = 0;
+
+    nmtstp_run_command_check("ip link set %s up", DEVICE_NAME);
+    n_base = _count_ip4_routes(ifindex);
+
+    /* 198.18.0.0/15 (benchmarking, rfc2544). One /32 per route. */
+    for (i = 0; i < STORM_N_ROUTES; i++) {
+        nm_str_buf_append_printf(&batch,
+                                 "route add 198.18.%u.%u/32 dev %s\n",
+                                 (i / 250u) % 250u,
+                                 1u + (i % 250u),
+                                 DEVICE_NAME);
+    }
+
+    batch_file = g_strdup_printf("%s/nm-bench-route-storm.batch", g_get_tmp_dir());
+    if (!g_file_set_contents(batch_file, nm_str_buf_get_str(&batch), batch.len, NULL))
+        g_assert_not_reached();
+
+    start_msec = nm_utils_get_monotonic_timestamp_msec();
+
+    for (round = 0; round < STORM_N_ROUNDS; round++) {
+        nmtstp_run_command_check("ip -batch %s", batch_file);
+        _wait_for_route_count(ifindex, n_base + STORM_N_ROUTES, TRUE);
+        n_events += STORM_N_ROUTES;
+
+        nmtstp_run_command_check("ip route flush dev %s proto static", DEVICE_NAME);
+        _wait_for_route_count(ifindex, n_base, FALSE);
+        n_events += STORM_N_ROUTES;
+    }
+
+    elapsed_msec = nm_utils_get_monotonic_timestamp_msec() - start_msec;
+
+    (void) unlink(batch_file);
+
+    g_print("# bench: route-storm: %" G_GUINT64_FORMAT " events in %" G_GINT64_FORMAT
+            " msec = %.0f events/sec\n",
+            n_events,
+            elapsed_msec,
+            elapsed_msec > 0 ? (n_events * 1000.0) / elapsed_msec : 0);
+}
+
+/*****************************************************************************/
+
+NMTstpSetupFunc const _nmtstp_setup_platform_func = SETUP;
+
+void
+_nmtstp_init_tests(int *argc, char ***argv)
+{
+    nmtst_init_with_logging(argc, argv, NULL, "ALL");
+}
+
+void
+_nmtstp_setup_tests(void)
+{
+    if (nmtstp_is_root_test())
+        nmtstp_env1_add_test_func("/benchmark/route-storm", test_route_storm, 1, TRUE);
+}
@@ -108,8 +108,10 @@ typedef struct {
     guint ppp_timeout_handler;
 
     /* Monitoring */
-    int   monitor_fd;
-    guint monitor_id;
+    int     monitor_fd;
+    guint   monitor_id;
+    guint32 monitor_in_bytes;
+    guint32 monitor_out_bytes;
 } NMPPPManagerPrivate;
 
 struct _NMPPPManager {
@@ -183,7 +185,12 @@ monitor_cb(gpointer user_data)
             errsv = errno;
             if (errsv != ENODEV)
                 _LOGW("could not read ppp stats: %s", nm_strerror_native(errsv));
-        } else {
+        } else if (priv->monitor_in_bytes != (guint32) stats.p.ppp_ibytes
+                   || priv->monitor_out_bytes != (guint32) stats.p.ppp_obytes) {
+            /* only bother the listeners when the counters moved. On hosts with
+             * many idle PPP sessions the periodic polls otherwise add up. */
+            priv->monitor_in_bytes  = stats.p.ppp_ibytes;
+            priv->monitor_out_bytes = stats.p.ppp_obytes;
             g_signal_emit(self,
                           signals[STATS],
                           0,
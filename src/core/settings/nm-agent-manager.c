@@ -710,6 +710,16 @@ agent_compare_func(gconstpointer aa, gconstpointer bb, gpointer user_data)
     else if (!a_active && b_active)
         return 1;
 
+    /* Prefer agents that answered their recent requests. An agent that
+     * keeps timing out makes every request wait out the full timeout
+     * before the next agent gets asked, so move it to the end. */
+    a_active = !nm_secret_agent_is_unresponsive(a);
+    b_active = !nm_secret_agent_is_unresponsive(b);
+    if (a_active && !b_active)
+        return -1;
+    else if (!a_active && b_active)
+        return 1;
+
     /* Prefer agents launched later (this is essentially to ease agent debugging) */
     a_start = nm_utils_get_start_time_for_pid(a_pid, NULL, NULL);
     b_start = nm_utils_get_start_time_for_pid(b_pid, NULL, NULL);
@@ -886,6 +896,20 @@ out:
 
 /*****************************************************************************/
 
+static void
+_request_done_report(NMSecretAgent *agent, GError *error)
+{
+    gboolean timed_out;
+
+    /* unresponsiveness is about the agent not answering at all. Error
+     * replies (no secrets, user declined, ...) count as answers. */
+    timed_out = error
+                && (g_error_matches(error, G_IO_ERROR, G_IO_ERROR_TIMED_OUT)
+                    || g_error_matches(error, G_DBUS_ERROR, G_DBUS_ERROR_TIMEOUT)
+                    || g_error_matches(error, G_DBUS_ERROR, G_DBUS_ERROR_NO_REPLY));
+    nm_secret_agent_report_result(agent, !timed_out);
+}
+
 static void
 _con_get_request_done(NMSecretAgent       *agent,
                       NMSecretAgentCallId *call_id,
@@ -913,6 +937,8 @@ _con_get_request_done(NMSecretAgent       *agent,
             return;
         }
 
+        _request_done_report(agent, error);
+
         _LOGD(agent,
               "agent failed secrets request " LOG_REQ_FMT ": %s",
               LOG_REQ_ARG(req),
@@ -935,6 +961,8 @@ _con_get_request_done(NMSecretAgent       *agent,
         return;
     }
 
+    _request_done_report(agent, NULL);
+
     /* Ensure the setting we wanted secrets for got returned and has something in it */
     setting_secrets =
         g_variant_lookup_value(secrets, req->con.get.setting_name, NM_VARIANT_TYPE_SETTING);
@@ -1314,6 +1342,8 @@ _con_save_request_done(NMSecretAgent       *agent,
             return;
         }
 
+        _request_done_report(agent, error);
+
         _LOGD(agent,
               "agent failed save secrets request " LOG_REQ_FMT ": %s",
               LOG_REQ_ARG(req),
@@ -1324,6 +1354,8 @@ _con_save_request_done(NMSecretAgent       *agent,
         return;
     }
 
+    _request_done_report(agent, NULL);
+
     _LOGD(agent, "agent saved secrets for request " LOG_REQ_FMT, LOG_REQ_ARG(req));
 
     agent_dbus_owner = nm_secret_agent_get_dbus_owner(agent);
@@ -1395,11 +1427,14 @@ _con_del_request_done(NMSecretAgent       *agent,
             return;
         }
 
+        _request_done_report(agent, error);
+
         _LOGD(agent,
               "agent failed delete secrets request " LOG_REQ_FMT ": %s",
               LOG_REQ_ARG(req),
               error->message);
     } else {
+        _request_done_report(agent, NULL);
         _LOGD(agent, "agent deleted secrets for request " LOG_REQ_FMT, LOG_REQ_ARG(req));
     }
 
@@ -46,6 +46,8 @@ typedef struct _NMSecretAgentPrivate {
     GCancellable             *name_owner_cancellable;
     guint                     name_owner_changed_id;
     NMSecretAgentCapabilities capabilities;
+    gint64                    last_failure_msec;
+    guint                     consecutive_failures;
     bool                      shutdown_wait_obj_registered : 1;
 } NMSecretAgentPrivate;
 
@@ -293,6 +295,58 @@ nm_secret_agent_get_capabilities(NMSecretAgent *agent)
     return NM_SECRET_AGENT_GET_PRIVATE(agent)->capabilities;
 }
 
+/**
+ * nm_secret_agent_report_result:
+ * @agent: the #NMSecretAgent
+ * @success: whether the agent answered its request
+ *
+ * Records whether the most recent request to the agent got answered.
+ * Used to de-prioritize agents that keep timing out when ordering
+ * agents for future requests.
+ */
+void
+nm_secret_agent_report_result(NMSecretAgent *agent, gboolean success)
+{
+    NMSecretAgentPrivate *priv;
+
+    g_return_if_fail(NM_IS_SECRET_AGENT(agent));
+
+    priv = NM_SECRET_AGENT_GET_PRIVATE(agent);
+
+    if (success) {
+        priv->consecutive_failures = 0;
+        priv->last_failure_msec    = 0;
+    } else {
+        priv->consecutive_failures++;
+        priv->last_failure_msec = nm_utils_get_monotonic_timestamp_msec();
+    }
+}
+
+/**
+ * nm_secret_agent_is_unresponsive:
+ * @agent: the #NMSecretAgent
+ *
+ * Returns: %TRUE if the agent repeatedly failed to answer recent
+ *   requests. A single isolated failure is not held against the agent,
+ *   and the verdict expires so that a recovered agent regains its
+ *   regular rank.
+ */
+gboolean
+nm_secret_agent_is_unresponsive(NMSecretAgent *agent)
+{
+    NMSecretAgentPrivate *priv;
+
+    g_return_val_if_fail(NM_IS_SECRET_AGENT(agent), FALSE);
+
+    priv = NM_SECRET_AGENT_GET_PRIVATE(agent);
+
+    if (priv->consecutive_failures < 2)
+        return FALSE;
+
+    return priv->last_failure_msec
+           > nm_utils_get_monotonic_timestamp_msec() - (5 * 60 * 1000);
+}
+
 NMAuthSubject *
 nm_secret_agent_get_subject(NMSecretAgent *agent)
 {
@@ -408,7 +462,7 @@ nm_secret_agent_get_secrets(NMSecretAgent               *self,
 
     priv = NM_SECRET_AGENT_GET_PRIVATE(self);
 
-    dict = nm_connection_to_dbus(connection, NM_CONNECTION_SERIALIZE_ALL);
+    dict = _nm_connection_to_dbus_cached(connection);
 
     /* Mask off the private flags if present */
     flags &= ~(NM_SECRET_AGENT_GET_SECRETS_FLAG_ONLY_SYSTEM
@@ -543,7 +597,7 @@ nm_secret_agent_save_secrets(NMSecretAgent        *self,
     priv = NM_SECRET_AGENT_GET_PRIVATE(self);
 
     /* Caller should have ensured that only agent-owned secrets exist in 'connection' */
-    dict = nm_connection_to_dbus(connection, NM_CONNECTION_SERIALIZE_ALL);
+    dict = _nm_connection_to_dbus_cached(connection);
 
     call_id = _call_id_new(self, METHOD_SAVE_SECRETS, path, NULL, callback, callback_data);
 
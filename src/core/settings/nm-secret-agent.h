@@ -59,6 +59,10 @@ NMSecretAgentCapabilities nm_secret_agent_get_capabilities(NMSecretAgent *agent)
 
 NMAuthSubject *nm_secret_agent_get_subject(NMSecretAgent *agent);
 
+void nm_secret_agent_report_result(NMSecretAgent *agent, gboolean success);
+
+gboolean nm_secret_agent_is_unresponsive(NMSecretAgent *agent);
+
 void nm_secret_agent_add_permission(NMSecretAgent *agent, const char *permission, gboolean allowed);
 
 gboolean nm_secret_agent_has_permission(NMSecretAgent *agent, const char *permission);
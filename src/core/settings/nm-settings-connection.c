@@ -139,6 +139,17 @@ typedef struct _NMSettingsConnectionPrivate {
         GVariant                        *variant;
     } getsettings_cached;
 
+    /* resolved owner uids from the profile's ACL ("connection.permissions").
+     * Rechecking visibility happens for all profiles whenever the session
+     * monitor sees a change, and resolving the user names means NSS lookups.
+     * Cache the resolution; it is cleared whenever the profile changes. */
+    struct {
+        uid_t *uids;
+        guint  n_uids;
+        bool   valid : 1;
+        bool   has_acl : 1;
+    } acl_uids_cached;
+
     NMSettingsStorage *storage;
 
     char *filename;
@@ -150,7 +161,15 @@ typedef struct _NMSettingsConnectionPrivate {
      * triggering a re-read of the connection, which reads only system
      * secrets, and would wipe out any agent-owned or not-saved secrets the
      * agent also returned.
-     */
+     *
+     * This is also what makes rapid reconnects skip the agent round trip:
+     * once fetched, agent-owned secrets stay merged in the in-memory profile
+     * (persist-mode "no-persist"), and activation only asks agents again when
+     * nm_connection_need_secrets() finds something missing. A TTL would not
+     * buy anything on top -- only the agent knows when its secrets go stale,
+     * and a failed attempt already requests new ones. Note that secrets held
+     * as GVariant cannot live in the locked/erasable buffers from
+     * nm-secret-utils.h; those only cover flat buffers. */
     GVariant *agent_secrets;
 
     CList       seen_bssids_lst_head;
@@ -317,6 +336,15 @@ nm_settings_connection_still_valid(NMSettingsConnection *self)
 
 /*****************************************************************************/
 
+static void
+_acl_uids_cached_clear(NMSettingsConnectionPrivate *priv)
+{
+    priv->acl_uids_cached.valid   = FALSE;
+    priv->acl_uids_cached.has_acl = FALSE;
+    priv->acl_uids_cached.n_uids  = 0;
+    nm_clear_g_free(&priv->acl_uids_cached.uids);
+}
+
 static void
 _getsettings_cached_clear(NMSettingsConnectionPrivate *priv)
 {
@@ -414,6 +442,7 @@ _nm_settings_connection_set_connection(NMSettingsConnection            *self,
         nm_assert_connection_unchanging(priv->connection);
 
         _getsettings_cached_clear(priv);
+        _acl_uids_cached_clear(priv);
         _nm_settings_notify_sorted_by_autoconnect_priority_maybe_changed(priv->settings);
 
         /* note that we only return @connection_old if the new connection actually differs from
@@ -468,35 +497,63 @@ gboolean
 nm_settings_connection_check_visibility(NMSettingsConnection *self,
                                         NMSessionMonitor     *session_monitor)
 {
-    NMSettingConnection *s_con;
-    guint32              num, i;
+    NMSettingsConnectionPrivate *priv;
+    guint                        i;
 
     g_return_val_if_fail(NM_IS_SETTINGS_CONNECTION(self), FALSE);
 
     nm_assert(NM_IS_SESSION_MONITOR(session_monitor));
 
-    s_con = nm_connection_get_setting_connection(nm_settings_connection_get_connection(self));
-
-    /* Check every user in the ACL for a session */
-    num = nm_setting_connection_get_num_permissions(s_con);
-    if (num == 0)
-        return TRUE;
+    priv = NM_SETTINGS_CONNECTION_GET_PRIVATE(self);
 
-    for (i = 0; i < num; i++) {
-        const char *ptype;
-        const char *user;
-        uid_t       uid;
+    if (!priv->acl_uids_cached.valid) {
+        NMSettingConnection *s_con;
+        gs_free uid_t       *uids         = NULL;
+        gboolean             all_resolved = TRUE;
+        guint32              num;
+        guint                n = 0;
+
+        s_con = nm_connection_get_setting_connection(priv->connection);
+
+        num = nm_setting_connection_get_num_permissions(s_con);
+        if (num > 0) {
+            uids = g_new(uid_t, num);
+            for (i = 0; i < num; i++) {
+                const char *ptype;
+                const char *user;
+                uid_t       uid;
+
+                if (!nm_setting_connection_get_permission(s_con, i, &ptype, &user, NULL))
+                    continue;
+                if (!nm_streq(ptype, NM_SETTINGS_CONNECTION_PERMISSION_USER))
+                    continue;
+                if (!nm_utils_name_to_uid(user, &uid)) {
+                    /* don't cache while a name does not resolve. The user may
+                     * get created in the passwd database later. */
+                    all_resolved = FALSE;
+                    continue;
+                }
+                uids[n++] = uid;
+            }
+        }
 
-        if (!nm_setting_connection_get_permission(s_con, i, &ptype, &user, NULL))
-            continue;
-        if (!nm_streq(ptype, NM_SETTINGS_CONNECTION_PERMISSION_USER))
-            continue;
-        if (!nm_utils_name_to_uid(user, &uid))
-            continue;
-        if (!nm_session_monitor_session_exists(session_monitor, uid, FALSE))
-            continue;
+        nm_clear_g_free(&priv->acl_uids_cached.uids);
+        priv->acl_uids_cached.uids    = g_steal_pointer(&uids);
+        priv->acl_uids_cached.n_uids  = n;
+        priv->acl_uids_cached.has_acl = (num != 0);
+        priv->acl_uids_cached.valid   = all_resolved;
+    }
 
+    /* a profile without ACL is visible to everyone. */
+    if (!priv->acl_uids_cached.has_acl)
         return TRUE;
+
+    /* Check every user in the ACL for a session */
+    for (i = 0; i < priv->acl_uids_cached.n_uids; i++) {
+        if (nm_session_monitor_session_exists(session_monitor,
+                                              priv->acl_uids_cached.uids[i],
+                                              FALSE))
+            return TRUE;
     }
 
     return FALSE;
@@ -1381,14 +1438,37 @@ get_settings_auth_cb(NMSettingsConnection  *self,
                      GError                *error,
                      gpointer               data)
 {
-    const char                      *seen_bssids_strv[SEEN_BSSIDS_MAX + 1];
-    NMConnectionSerializationOptions options = {};
+    gs_unref_variant GVariant *settings = NULL;
 
     if (error) {
         g_dbus_method_invocation_return_gerror(context, error);
         return;
     }
 
+    settings = nm_settings_connection_to_dbus_settings(self);
+
+    g_dbus_method_invocation_return_value(context, g_variant_new("(@a{sa{sv}})", settings));
+}
+
+/**
+ * nm_settings_connection_to_dbus_settings:
+ * @self: the #NMSettingsConnection
+ *
+ * Serializes the settings the same way as the GetSettings() D-Bus method
+ * does, that is, without secrets and with the substituted timestamp and
+ * seen-bssids. The caller must already have verified that the subject is
+ * in the connection's ACL.
+ *
+ * Returns: (transfer full): the "a{sa{sv}}" settings variant.
+ */
+GVariant *
+nm_settings_connection_to_dbus_settings(NMSettingsConnection *self)
+{
+    const char                      *seen_bssids_strv[SEEN_BSSIDS_MAX + 1];
+    NMConnectionSerializationOptions options = {};
+
+    g_return_val_if_fail(NM_IS_SETTINGS_CONNECTION(self), NULL);
+
     /* Timestamp is not updated in connection's 'timestamp' property,
      * because it would force updating the connection and in turn
      * writing to /etc periodically, which we want to avoid. Rather real
@@ -1410,7 +1490,7 @@ get_settings_auth_cb(NMSettingsConnection  *self,
      * protected against leakage of secrets to unprivileged callers.
      */
 
-    g_dbus_method_invocation_return_value(context, _getsettings_cached_get(self, &options));
+    return g_variant_get_child_value(_getsettings_cached_get(self, &options), 0);
 }
 
 static void
@@ -1643,6 +1723,53 @@ get_update_modify_permission(NMConnection *old, NMConnection *new)
     return NM_AUTH_PERMISSION_SETTINGS_MODIFY_SYSTEM;
 }
 
+static GVariant *
+_update_merge_partial_settings(NMSettingsConnection *self, GVariant *new_settings)
+{
+    GVariantBuilder builder;
+    GVariantIter    iter;
+    const char     *name;
+    GVariant       *cur;
+    GVariant       *value;
+
+    /* settings present in @new_settings replace the profile's setting of the
+     * same name, absent settings keep their current content (including their
+     * secrets). The merged dictionary goes through the same strict
+     * parsing/normalization below as a full update. */
+
+    cur = _nm_connection_to_dbus_cached(nm_settings_connection_get_connection(self));
+
+    g_variant_builder_init(&builder, NM_VARIANT_TYPE_CONNECTION);
+
+    if (cur) {
+        g_variant_iter_init(&iter, cur);
+        while (g_variant_iter_next(&iter, "{&s@a{sv}}", &name, &value)) {
+            gs_unref_variant GVariant *value_take = value;
+            gs_unref_variant GVariant *v_new      = NULL;
+
+            v_new = g_variant_lookup_value(new_settings, name, G_VARIANT_TYPE("a{sv}"));
+            g_variant_builder_add(&builder, "{s@a{sv}}", name, v_new ?: value_take);
+        }
+    }
+
+    g_variant_iter_init(&iter, new_settings);
+    while (g_variant_iter_next(&iter, "{&s@a{sv}}", &name, &value)) {
+        gs_unref_variant GVariant *value_take = value;
+        gs_unref_variant GVariant *v_cur      = NULL;
+
+        if (cur) {
+            v_cur = g_variant_lookup_value(cur, name, G_VARIANT_TYPE("a{sv}"));
+            if (v_cur) {
+                /* already merged above. */
+                continue;
+            }
+        }
+        g_variant_builder_add(&builder, "{s@a{sv}}", name, value_take);
+    }
+
+    return g_variant_ref_sink(g_variant_builder_end(&builder));
+}
+
 static void
 settings_connection_update(NMSettingsConnection  *self,
                            gboolean               is_update2,
@@ -1652,10 +1779,11 @@ settings_connection_update(NMSettingsConnection  *self,
                            guint64                version_id,
                            NMSettingsUpdate2Flags flags)
 {
-    NMSettingsConnectionPrivate *priv    = NM_SETTINGS_CONNECTION_GET_PRIVATE(self);
-    NMAuthSubject               *subject = NULL;
-    NMConnection                *tmp     = NULL;
-    GError                      *error   = NULL;
+    NMSettingsConnectionPrivate *priv            = NM_SETTINGS_CONNECTION_GET_PRIVATE(self);
+    gs_unref_variant GVariant   *merged_settings = NULL;
+    NMAuthSubject               *subject         = NULL;
+    NMConnection                *tmp             = NULL;
+    GError                      *error           = NULL;
     UpdateInfo                  *info;
     const char                  *permission;
 
@@ -1669,6 +1797,12 @@ settings_connection_update(NMSettingsConnection  *self,
             goto error;
         }
 
+        if (NM_FLAGS_HAS(flags, NM_SETTINGS_UPDATE2_FLAG_PARTIAL)
+            && g_variant_n_children(new_settings) > 0) {
+            merged_settings = _update_merge_partial_settings(self, new_settings);
+            new_settings    = merged_settings;
+        }
+
         if (g_variant_n_children(new_settings) > 0) {
             tmp = _nm_simple_connection_new_from_dbus(new_settings,
                                                       NM_SETTING_PARSE_FLAGS_STRICT
@@ -1814,7 +1948,8 @@ impl_settings_connection_update2(NMDBusObject                      *obj,
                      ~((guint32) (_NM_SETTINGS_UPDATE2_FLAG_ALL_PERSIST_MODES
                                   | NM_SETTINGS_UPDATE2_FLAG_VOLATILE
                                   | NM_SETTINGS_UPDATE2_FLAG_BLOCK_AUTOCONNECT
-                                  | NM_SETTINGS_UPDATE2_FLAG_NO_REAPPLY)))) {
+                                  | NM_SETTINGS_UPDATE2_FLAG_NO_REAPPLY
+                                  | NM_SETTINGS_UPDATE2_FLAG_PARTIAL)))) {
         error = g_error_new_literal(NM_SETTINGS_ERROR,
                                     NM_SETTINGS_ERROR_INVALID_ARGUMENTS,
                                     "Unknown flags");
@@ -2792,6 +2927,7 @@ dispose(GObject *object)
     g_clear_object(&priv->connection);
 
     _getsettings_cached_clear(priv);
+    _acl_uids_cached_clear(priv);
 
     nm_clear_pointer(&priv->kf_db_timestamps, nm_key_file_db_unref);
     nm_clear_pointer(&priv->kf_db_seen_bssids, nm_key_file_db_unref);
@@ -3107,6 +3107,58 @@ impl_settings_list_connections(NMDBusObject                      *obj,
     g_dbus_method_invocation_return_value(invocation, g_variant_new("(^ao)", strv));
 }
 
+static void
+impl_settings_get_connections_settings(NMDBusObject                      *obj,
+                                       const NMDBusInterfaceInfoExtended *interface_info,
+                                       const NMDBusMethodInfoExtended    *method_info,
+                                       GDBusConnection                   *dbus_connection,
+                                       const char                        *sender,
+                                       GDBusMethodInvocation             *invocation,
+                                       GVariant                          *parameters)
+{
+    NMSettings                    *self    = NM_SETTINGS(obj);
+    gs_unref_object NMAuthSubject *subject = NULL;
+    gs_free const char           **paths   = NULL;
+    GVariantBuilder                builder;
+    gsize                          i;
+
+    subject = nm_dbus_manager_new_auth_subject_from_context(invocation);
+    if (!subject) {
+        g_dbus_method_invocation_take_error(
+            invocation,
+            g_error_new_literal(NM_SETTINGS_ERROR,
+                                NM_SETTINGS_ERROR_PERMISSION_DENIED,
+                                NM_UTILS_ERROR_MSG_REQ_UID_UKNOWN));
+        return;
+    }
+
+    g_variant_get(parameters, "(^a&o)", &paths);
+
+    /* Profiles that don't exist (anymore) or that the subject is not
+     * authorized to see are silently omitted from the result. The caller is
+     * responsible for requesting suitably sized batches, so that the reply
+     * stays below the D-Bus maximum message size. */
+    g_variant_builder_init(&builder, G_VARIANT_TYPE("a{oa{sa{sv}}}"));
+    for (i = 0; paths && paths[i]; i++) {
+        NMSettingsConnection      *sett_conn;
+        gs_unref_variant GVariant *settings = NULL;
+
+        sett_conn = nm_settings_get_connection_by_path(self, paths[i]);
+        if (!sett_conn)
+            continue;
+        if (!nm_auth_is_subject_in_acl(nm_settings_connection_get_connection(sett_conn),
+                                       subject,
+                                       NULL))
+            continue;
+
+        settings = nm_settings_connection_to_dbus_settings(sett_conn);
+        g_variant_builder_add(&builder, "{o@a{sa{sv}}}", paths[i], settings);
+    }
+
+    g_dbus_method_invocation_return_value(invocation,
+                                          g_variant_new("(a{oa{sa{sv}}})", &builder));
+}
+
 NMSettingsConnection *
 nm_settings_get_connection_by_uuid(NMSettings *self, const char *uuid)
 {
@@ -4341,6 +4393,14 @@ static const NMDBusInterfaceInfoExtended interface_info_settings = {
                     .out_args =
                         NM_DEFINE_GDBUS_ARG_INFOS(NM_DEFINE_GDBUS_ARG_INFO("connection", "o"), ), ),
                 .handle = impl_settings_get_connection_by_uuid, ),
+            NM_DEFINE_DBUS_METHOD_INFO_EXTENDED(
+                NM_DEFINE_GDBUS_METHOD_INFO_INIT(
+                    "GetConnectionsSettings",
+                    .in_args = NM_DEFINE_GDBUS_ARG_INFOS(
+                        NM_DEFINE_GDBUS_ARG_INFO("connections", "ao"), ),
+                    .out_args = NM_DEFINE_GDBUS_ARG_INFOS(
+                        NM_DEFINE_GDBUS_ARG_INFO("settings", "a{oa{sa{sv}}}"), ), ),
+                .handle = impl_settings_get_connections_settings, ),
             NM_DEFINE_DBUS_METHOD_INFO_EXTENDED(
                 NM_DEFINE_GDBUS_METHOD_INFO_INIT(
                     "AddConnection",
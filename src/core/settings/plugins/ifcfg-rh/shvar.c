@@ -55,6 +55,14 @@ struct _shvarLine {
     char *line;
     char *key_with_prefix;
 
+    /* Cached result of svUnescape() of @line, computed on first lookup and
+     * dropped whenever @line changes. The readers look up the same keys over
+     * and over, and unescaping scans (and possibly clones) the value each
+     * time. @value_cached either points into @line, to @value_cached_to_free,
+     * or to a static empty string (for values that fail to unescape). */
+    const char *value_cached;
+    char       *value_cached_to_free;
+
     /* svSetValue() will clear the dirty flag. */
     bool dirty : 1;
 };
@@ -784,6 +792,8 @@ ASSERT_shvarLine(const shvarLine *line)
         nm_assert(line->key == nm_str_skip_leading_spaces(line->key_with_prefix));
         nm_assert(_shell_is_name(line->key, -1));
     }
+    nm_assert(!line->value_cached || line->line);
+    nm_assert(!line->value_cached_to_free || line->value_cached == line->value_cached_to_free);
 #endif
 }
 
@@ -847,6 +857,13 @@ line_new_build(const char *key, const char *value)
     return line;
 }
 
+static void
+line_value_cache_clear(shvarLine *line)
+{
+    line->value_cached = NULL;
+    nm_clear_g_free(&line->value_cached_to_free);
+}
+
 static gboolean
 line_set(shvarLine *line, const char *value)
 {
@@ -875,6 +892,7 @@ line_set(shvarLine *line, const char *value)
         g_free(line->line);
     }
 
+    line_value_cache_clear(line);
     line->line = value_escaped ?: g_strdup(value);
     ASSERT_shvarLine(line);
     return TRUE;
@@ -887,6 +905,7 @@ line_free(shvarLine *line)
     c_list_unlink_stale(&line->lst);
     g_free(line->line);
     g_free(line->key_with_prefix);
+    g_free(line->value_cached_to_free);
     g_slice_free(shvarLine, line);
 }
 
@@ -1145,8 +1164,8 @@ svFindFirstNumberedKey(shvarFile *s, const char *key_prefix)
 static const char *
 _svGetValue(shvarFile *s, const char *key, char **to_free)
 {
-    const shvarLine *line;
-    const char      *v;
+    shvarLine  *line;
+    const char *v;
 
     nm_assert(s);
     nm_assert(_shell_is_name(key, -1));
@@ -1156,17 +1175,21 @@ _svGetValue(shvarFile *s, const char *key, char **to_free)
 
     line = g_hash_table_lookup(s->lst_idx, &key);
 
+    *to_free = NULL;
+
     if (line && line->line) {
-        v = svUnescape(line->line, to_free);
-        if (!v) {
-            /* a wrongly quoted value or non-UTF-8 is treated like the empty string.
-             * See also svWriteFile(), which handles unparsable values that way. */
-            nm_assert(!*to_free);
-            return "";
+        if (!line->value_cached) {
+            v = svUnescape(line->line, &line->value_cached_to_free);
+            if (!v) {
+                /* a wrongly quoted value or non-UTF-8 is treated like the empty string.
+                 * See also svWriteFile(), which handles unparsable values that way. */
+                nm_assert(!line->value_cached_to_free);
+                v = "";
+            }
+            line->value_cached = v;
         }
-        return v;
+        return line->value_cached;
     }
-    *to_free = NULL;
     return NULL;
 }
 
@@ -1374,6 +1397,7 @@ svUnsetAll(shvarFile *s, SvKeyType match_key_type)
         ASSERT_shvarLine(line);
         if (line->key && _svKeyMatchesType(line->key, match_key_type)) {
             if (nm_clear_g_free(&line->line)) {
+                line_value_cache_clear(line);
                 ASSERT_shvarLine(line);
                 changed = TRUE;
             }
@@ -1402,6 +1426,7 @@ svUnsetDirtyWellknown(shvarFile *s, NMTernary new_dirty_value)
             && (ti = nms_ifcfg_rh_utils_is_well_known_key(line->key))
             && !NM_FLAGS_HAS(ti->key_flags, NMS_IFCFG_KEY_TYPE_KEEP_WHEN_DIRTY)) {
             if (nm_clear_g_free(&line->line)) {
+                line_value_cache_clear(line);
                 ASSERT_shvarLine(line);
                 changed = TRUE;
             }
@@ -1451,6 +1476,7 @@ svSetValue(shvarFile *s, const char *key, const char *value)
             /* We only clear the value, but leave the line entry. This way, if we
              * happen to re-add the value, we write it to the same line again. */
             if (nm_clear_g_free(&line->line)) {
+                line_value_cache_clear(line);
                 changed = TRUE;
             }
         }
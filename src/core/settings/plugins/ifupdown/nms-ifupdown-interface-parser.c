@@ -82,6 +82,29 @@ add_data(if_parser *parser, const char *key, const char *data)
     c_list_link_tail(&last_block->data_lst_head, &ifd->data_lst);
 }
 
+static void
+_ifparser_file_state_record(if_parser *parser, const char *path)
+{
+    if_file_state *fs;
+    struct stat    st;
+    gboolean       exists;
+    gsize          l_path;
+
+    exists = (stat(path, &st) == 0);
+
+    l_path = strlen(path) + 1;
+    fs     = g_malloc0(sizeof(if_file_state) + l_path);
+    memcpy(fs->path, path, l_path);
+    fs->exists = exists;
+    if (exists) {
+        fs->mtim = st.st_mtim;
+        fs->dev  = st.st_dev;
+        fs->ino  = st.st_ino;
+        fs->size = st.st_size;
+    }
+    c_list_link_tail(&parser->file_lst_head, &fs->file_lst);
+}
+
 /* join values in src with spaces into dst;  dst needs to be large enough */
 static char *
 join_values_with_spaces(char *dst, char **src)
@@ -109,6 +132,10 @@ _recursive_ifparser(if_parser *parser, const char *eni_file, int quiet)
     int   skip_long_line = 0;
     int   offs           = 0;
 
+    /* remember the file state (also for files that don't exist yet), so
+     * that ifparser_file_states_unchanged() can detect modifications. */
+    _ifparser_file_state_record(parser, eni_file);
+
     /* Check if interfaces file exists and open it */
     if (!g_file_test(eni_file, G_FILE_TEST_EXISTS)) {
         if (!quiet)
@@ -265,6 +292,14 @@ _ifparser_source(if_parser *parser, const char *path, const char *en_dir, int qu
     if (!quiet)
         _LOGI("      interface-parser: source line includes interfaces file(s) %s", abs_path);
 
+    if (strpbrk(abs_path, "*?[")) {
+        gs_free char *glob_dir = g_path_get_dirname(abs_path);
+
+        /* a new file matching the glob modifies the directory, not any of
+         * the files recorded below; track the directory as well. */
+        _ifparser_file_state_record(parser, glob_dir);
+    }
+
     /* ifupdown uses WRDE_NOCMD for wordexp. */
     if (wordexp(abs_path, &we, WRDE_NOCMD)) {
         if (!quiet)
@@ -272,6 +307,7 @@ _ifparser_source(if_parser *parser, const char *path, const char *en_dir, int qu
     } else {
         for (i = 0; i < we.we_wordc; i++) {
             if (dir) {
+                _ifparser_file_state_record(parser, we.we_wordv[i]);
                 source_dir = g_dir_open(we.we_wordv[i], 0, &error);
                 if (!source_dir) {
                     if (!quiet) {
@@ -298,10 +334,55 @@ ifparser_parse(const char *eni_file, int quiet)
 
     parser = g_slice_new(if_parser);
     c_list_init(&parser->block_lst_head);
+    c_list_init(&parser->file_lst_head);
     _recursive_ifparser(parser, eni_file, quiet);
     return parser;
 }
 
+void
+ifparser_steal_file_states(if_parser *parser, CList *dst_lst_head)
+{
+    ifparser_clear_file_states(dst_lst_head);
+    c_list_splice(dst_lst_head, &parser->file_lst_head);
+    c_list_init(&parser->file_lst_head);
+}
+
+gboolean
+ifparser_file_states_unchanged(CList *file_states_lst_head)
+{
+    if_file_state *fs;
+
+    if (c_list_is_empty(file_states_lst_head))
+        return FALSE;
+
+    c_list_for_each_entry (fs, file_states_lst_head, file_lst) {
+        struct stat st;
+
+        if (stat(fs->path, &st) != 0) {
+            if (fs->exists)
+                return FALSE;
+            continue;
+        }
+        if (!fs->exists)
+            return FALSE;
+        if (st.st_dev != fs->dev || st.st_ino != fs->ino || st.st_size != fs->size
+            || st.st_mtim.tv_sec != fs->mtim.tv_sec || st.st_mtim.tv_nsec != fs->mtim.tv_nsec)
+            return FALSE;
+    }
+    return TRUE;
+}
+
+void
+ifparser_clear_file_states(CList *file_states_lst_head)
+{
+    if_file_state *fs;
+
+    while ((fs = c_list_first_entry(file_states_lst_head, if_file_state, file_lst))) {
+        c_list_unlink_stale(&fs->file_lst);
+        g_free(fs);
+    }
+}
+
 static void
 _destroy_data(if_data *ifd)
 {
@@ -327,6 +408,7 @@ ifparser_destroy(if_parser *parser)
 
     while ((ifb = c_list_first_entry(&parser->block_lst_head, if_block, block_lst)))
         _destroy_block(ifb);
+    ifparser_clear_file_states(&parser->file_lst_head);
     g_slice_free(if_parser, parser);
 }
 
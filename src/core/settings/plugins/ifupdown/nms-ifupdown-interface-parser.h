@@ -7,6 +7,9 @@
 #ifndef _INTERFACE_PARSER_H
 #define _INTERFACE_PARSER_H
 
+#include <sys/stat.h>
+#include <sys/types.h>
+
 #include "c-list/src/c-list.h"
 
 typedef struct {
@@ -22,12 +25,29 @@ typedef struct {
     const char  name[];
 } if_block;
 
+/* state of one file (or directory) that contributed to the parse result,
+ * recorded so that a reload can detect whether re-parsing is needed. */
+typedef struct {
+    CList           file_lst;
+    struct timespec mtim;
+    dev_t           dev;
+    ino_t           ino;
+    off_t           size;
+    bool            exists : 1;
+    char            path[];
+} if_file_state;
+
 typedef struct {
     CList block_lst_head;
+    CList file_lst_head;
 } if_parser;
 
 if_parser *ifparser_parse(const char *eni_file, int quiet);
 
+void     ifparser_steal_file_states(if_parser *parser, CList *dst_lst_head);
+gboolean ifparser_file_states_unchanged(CList *file_states_lst_head);
+void     ifparser_clear_file_states(CList *file_states_lst_head);
+
 void ifparser_destroy(if_parser *parser);
 NM_AUTO_DEFINE_FCN0(if_parser *, _nm_auto_ifparser, ifparser_destroy);
 #define nm_auto_ifparser nm_auto(_nm_auto_ifparser)
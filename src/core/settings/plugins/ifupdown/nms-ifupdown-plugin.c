@@ -35,6 +35,10 @@ typedef struct {
      */
     GHashTable *eni_ifaces;
 
+    /* state (mtime & Co.) of /e/n/i and all files it sources, from the last
+     * parse. Used to skip re-parsing on reload when nothing changed. */
+    CList eni_file_states_lst_head;
+
     bool ifupdown_managed : 1;
 
     bool initialized : 1;
@@ -129,6 +133,13 @@ reload_connections(NMSettingsPlugin                      *plugin,
          *
          * On future reloads, we really want to load /e/n/i again. */
         priv->already_reloaded = TRUE;
+    } else if (ifparser_file_states_unchanged(&priv->eni_file_states_lst_head)) {
+        /* /e/n/i and all files it sources are unchanged since the last parse.
+         * There is nothing to (re)load. Return without announcing anything,
+         * so that the previously loaded connections stay as they are. */
+        _LOGD("load: %s and sourced files unchanged, keeping previously loaded connections",
+              ENI_INTERFACES_FILE);
+        return;
     } else {
         eni_ifaces_old   = priv->eni_ifaces;
         priv->eni_ifaces = load_eni_ifaces(self);
@@ -233,6 +244,10 @@ load_eni_ifaces(NMSIfupdownPlugin *self)
 
     parser = ifparser_parse(ENI_INTERFACES_FILE, 0);
 
+    ifparser_steal_file_states(
+        parser,
+        &NMS_IFUPDOWN_PLUGIN_GET_PRIVATE(self)->eni_file_states_lst_head);
+
     c_list_for_each_entry (block, &parser->block_lst_head, block_lst) {
         if (NM_IN_STRSET(block->type, "auto", "allow-hotplug")) {
             if (!auto_ifaces)
@@ -364,7 +379,11 @@ load_eni_ifaces(NMSIfupdownPlugin *self)
 
 static void
 nms_ifupdown_plugin_init(NMSIfupdownPlugin *self)
-{}
+{
+    NMSIfupdownPluginPrivate *priv = NMS_IFUPDOWN_PLUGIN_GET_PRIVATE(self);
+
+    c_list_init(&priv->eni_file_states_lst_head);
+}
 
 static void
 dispose(GObject *object)
@@ -374,6 +393,8 @@ dispose(GObject *object)
 
     nm_clear_pointer(&priv->eni_ifaces, g_hash_table_destroy);
 
+    ifparser_clear_file_states(&priv->eni_file_states_lst_head);
+
     G_OBJECT_CLASS(nms_ifupdown_plugin_parent_class)->dispose(object);
 }
 
@@ -422,8 +422,10 @@ static void
 _load_dir(NMSKeyfilePlugin     *self,
           NMSKeyfileStorageType storage_type,
           const char           *dirname,
-          NMSettUtilStorages   *storages)
+          NMSettUtilStorages   *storages,
+          GHashTable           *unchanged_filenames)
 {
+    NMSKeyfilePluginPrivate       *priv = NMS_KEYFILE_PLUGIN_GET_PRIVATE(self);
     const char                    *filename;
     GDir                          *dir;
     gs_unref_hashtable GHashTable *dupl_filenames = NULL;
@@ -441,6 +443,25 @@ _load_dir(NMSKeyfilePlugin     *self,
         if (!g_hash_table_add(dupl_filenames, (char *) filename))
             continue;
 
+        if (unchanged_filenames && !_ignore_filename(storage_type, filename)) {
+            gs_free char      *full_filename = g_build_filename(dirname, filename, NULL);
+            NMSKeyfileStorage *storage_old;
+            struct stat        st;
+
+            /* During reload we can avoid re-parsing files that didn't change
+             * on disk since we loaded them. We recorded the file's mtime in
+             * the tracked storage; if it still matches (including nanoseconds),
+             * the profile we have in memory is already up to date. */
+            storage_old = nm_sett_util_storages_lookup_by_filename(&priv->storages, full_filename);
+            if (storage_old && !storage_old->is_meta_data
+                && storage_old->storage_type == storage_type && stat(full_filename, &st) == 0
+                && st.st_mtim.tv_sec == storage_old->u.conn_data.stat_mtime.tv_sec
+                && st.st_mtim.tv_nsec == storage_old->u.conn_data.stat_mtime.tv_nsec) {
+                g_hash_table_add(unchanged_filenames, g_steal_pointer(&full_filename));
+                continue;
+            }
+        }
+
         storage = _load_file(self, dirname, filename, storage_type, NULL);
         if (!storage)
             continue;
@@ -467,6 +488,7 @@ _storages_consolidate(NMSKeyfilePlugin                      *self,
                       NMSettUtilStorages                    *storages_new,
                       gboolean                               replace_all,
                       GHashTable                            *storages_replaced,
+                      GHashTable                            *unchanged_filenames,
                       NMSettingsPluginConnectionLoadCallback callback,
                       gpointer                               user_data)
 {
@@ -521,6 +543,14 @@ _storages_consolidate(NMSKeyfilePlugin                      *self,
                                 parent._storage_lst) {
         if (!storage_old->is_dirty)
             continue;
+        if (unchanged_filenames && !storage_old->is_meta_data
+            && g_hash_table_contains(unchanged_filenames,
+                                     nms_keyfile_storage_get_filename(storage_old))) {
+            /* the file was skipped during load because it is unchanged on disk.
+             * Keep the tracked storage as-is and don't raise an event for it. */
+            storage_old->is_dirty = FALSE;
+            continue;
+        }
         if (replace_all
             || (storages_replaced && g_hash_table_contains(storages_replaced, storage_old))) {
             nm_sett_util_storages_steal(&priv->storages, storage_old);
@@ -582,15 +612,30 @@ reload_connections(NMSettingsPlugin                      *plugin,
     NMSKeyfilePluginPrivate                            *priv = NMS_KEYFILE_PLUGIN_GET_PRIVATE(self);
     nm_auto_clear_sett_util_storages NMSettUtilStorages storages_new =
         NM_SETT_UTIL_STORAGES_INIT(storages_new, nms_keyfile_storage_destroy);
-    int i;
+    gs_unref_hashtable GHashTable *unchanged_filenames = NULL;
+    int                            i;
+
+    unchanged_filenames = g_hash_table_new_full(nm_str_hash, g_str_equal, g_free, NULL);
 
-    _load_dir(self, NMS_KEYFILE_STORAGE_TYPE_RUN, priv->dirname_run, &storages_new);
+    _load_dir(self,
+              NMS_KEYFILE_STORAGE_TYPE_RUN,
+              priv->dirname_run,
+              &storages_new,
+              unchanged_filenames);
     if (priv->dirname_etc)
-        _load_dir(self, NMS_KEYFILE_STORAGE_TYPE_ETC, priv->dirname_etc, &storages_new);
+        _load_dir(self,
+                  NMS_KEYFILE_STORAGE_TYPE_ETC,
+                  priv->dirname_etc,
+                  &storages_new,
+                  unchanged_filenames);
     for (i = 0; priv->dirname_libs[i]; i++)
-        _load_dir(self, NMS_KEYFILE_STORAGE_TYPE_LIB(i), priv->dirname_libs[i], &storages_new);
+        _load_dir(self,
+                  NMS_KEYFILE_STORAGE_TYPE_LIB(i),
+                  priv->dirname_libs[i],
+                  &storages_new,
+                  unchanged_filenames);
 
-    _storages_consolidate(self, &storages_new, TRUE, NULL, callback, user_data);
+    _storages_consolidate(self, &storages_new, TRUE, NULL, unchanged_filenames, callback, user_data);
 }
 
 static void
@@ -738,7 +783,7 @@ load_connections(NMSettingsPlugin                      *plugin,
     nm_clear_pointer(&loaded_uuids, g_hash_table_destroy);
     nm_clear_pointer(&dupl_filenames, g_hash_table_destroy);
 
-    _storages_consolidate(self, &storages_new, FALSE, storages_replaced, callback, user_data);
+    _storages_consolidate(self, &storages_new, FALSE, storages_replaced, NULL, callback, user_data);
 }
 
 gboolean
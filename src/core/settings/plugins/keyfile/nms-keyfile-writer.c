@@ -384,6 +384,12 @@ _internal_write_connection(NMConnection                   *connection,
         }
     }
 
+    /* Note for bulk imports: nm_utils_file_set_contents() only fsyncs when it
+     * replaces an existing non-empty file, so writing a new profile costs no
+     * sync at all. Provisioning pipelines that need to create thousands of
+     * profiles at once are better served by writing the keyfiles themselves
+     * and issuing a single LoadConnections() D-Bus call, rather than by a
+     * batched variant of this per-profile writer. */
     nm_utils_file_set_contents(path, kf_content_buf, kf_content_len, 0600, NULL, NULL, &local_err);
     if (local_err) {
         g_set_error(error,
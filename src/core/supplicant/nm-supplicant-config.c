@@ -1487,7 +1487,15 @@ nm_supplicant_config_add_setting_8021x(NMSupplicantConfig *self,
     /* If user wants to use system CA certs, either populate ca_path (if the path
      * is a directory) or ca_cert (the path is a file name) */
     if (nm_setting_802_1x_get_system_ca_certs(setting)) {
-        if (g_file_test(SYSTEM_CA_PATH, G_FILE_TEST_IS_DIR))
+        static int is_dir = -1;
+
+        /* SYSTEM_CA_PATH is a build-time constant; cache the stat result so
+         * that building the EAP configuration doesn't hit the filesystem on
+         * every activation. */
+        if (G_UNLIKELY(is_dir < 0))
+            is_dir = !!g_file_test(SYSTEM_CA_PATH, G_FILE_TEST_IS_DIR);
+
+        if (is_dir)
             ca_path_override = SYSTEM_CA_PATH;
         else
             ca_cert_override = SYSTEM_CA_PATH;
@@ -83,6 +83,25 @@ NM_GOBJECT_PROPERTIES_DEFINE(NMSupplicantInterface,
                              PROP_P2P_AVAILABLE,
                              PROP_AUTH_STATE, );
 
+/* The wpa_supplicant signals (besides the standard PropertiesChanged) that
+ * _signal_handle() consumes. We subscribe to exactly these members, so that
+ * everything else emitted on the interface's object path -- in particular
+ * the legacy fi.w1.wpa_supplicant1.Interface.PropertiesChanged duplicates
+ * of every property update -- is dropped by the D-Bus daemon's match rules
+ * and never wakes us up. */
+static const struct {
+    const char *interface_name;
+    const char *signal_name;
+} supplicant_signal_subscriptions[] = {
+    {NM_WPAS_DBUS_IFACE_INTERFACE, "BSSAdded"},
+    {NM_WPAS_DBUS_IFACE_INTERFACE, "BSSRemoved"},
+    {NM_WPAS_DBUS_IFACE_INTERFACE, "EAP"},
+    {NM_WPAS_DBUS_IFACE_INTERFACE_P2P_DEVICE, "DeviceFound"},
+    {NM_WPAS_DBUS_IFACE_INTERFACE_P2P_DEVICE, "DeviceLost"},
+    {NM_WPAS_DBUS_IFACE_INTERFACE_P2P_DEVICE, "GroupStarted"},
+    {NM_WPAS_DBUS_IFACE_INTERFACE_P2P_DEVICE, "GroupFinished"},
+};
+
 typedef struct _NMSupplicantInterfacePrivate {
     NMSupplicantManager *supplicant_manager;
 
@@ -128,7 +147,8 @@ typedef struct _NMSupplicantInterfacePrivate {
     NMSupplCapMask     iface_capabilities;
 
     guint properties_changed_id;
-    guint signal_id;
+    guint p2p_device_properties_changed_id;
+    guint signal_ids[G_N_ELEMENTS(supplicant_signal_subscriptions)];
     guint bss_properties_changed_id;
     guint peer_properties_changed_id;
     guint p2p_group_properties_changed_id;
@@ -1090,6 +1110,7 @@ set_state_down(NMSupplicantInterface *self,
     NMSupplicantBssInfo          *bss_info;
     NMSupplicantPeerInfo         *peer_info;
     NMSupplicantInterfaceState    old_state;
+    guint                         i;
 
     nm_assert(priv->state != NM_SUPPLICANT_INTERFACE_STATE_DOWN);
     nm_assert(!c_list_is_empty(&self->supp_lst));
@@ -1117,7 +1138,10 @@ set_state_down(NMSupplicantInterface *self,
     _emit_signal_state(self, priv->state, old_state, 0);
 
     nm_clear_g_dbus_connection_signal(priv->dbus_connection, &priv->properties_changed_id);
-    nm_clear_g_dbus_connection_signal(priv->dbus_connection, &priv->signal_id);
+    nm_clear_g_dbus_connection_signal(priv->dbus_connection,
+                                      &priv->p2p_device_properties_changed_id);
+    for (i = 0; i < G_N_ELEMENTS(priv->signal_ids); i++)
+        nm_clear_g_dbus_connection_signal(priv->dbus_connection, &priv->signal_ids[i]);
     nm_clear_g_dbus_connection_signal(priv->dbus_connection, &priv->bss_properties_changed_id);
     nm_clear_g_dbus_connection_signal(priv->dbus_connection, &priv->peer_properties_changed_id);
     nm_clear_g_dbus_connection_signal(priv->dbus_connection,
@@ -3405,16 +3429,27 @@ constructed(GObject *object)
 {
     NMSupplicantInterface        *self = NM_SUPPLICANT_INTERFACE(object);
     NMSupplicantInterfacePrivate *priv = NM_SUPPLICANT_INTERFACE_GET_PRIVATE(self);
+    guint                         i;
 
     G_OBJECT_CLASS(nm_supplicant_interface_parent_class)->constructed(object);
 
     _LOGD("new supplicant interface %s on %s", priv->object_path->str, priv->name_owner->str);
 
+    /* Match on arg0, so that PropertiesChanged for D-Bus interfaces that we
+     * don't consume (WPS, Mesh, ...) never gets dispatched to us. */
     priv->properties_changed_id =
         nm_dbus_connection_signal_subscribe_properties_changed(priv->dbus_connection,
                                                                priv->name_owner->str,
                                                                priv->object_path->str,
-                                                               NULL,
+                                                               NM_WPAS_DBUS_IFACE_INTERFACE,
+                                                               _properties_changed_cb,
+                                                               self,
+                                                               NULL);
+    priv->p2p_device_properties_changed_id =
+        nm_dbus_connection_signal_subscribe_properties_changed(priv->dbus_connection,
+                                                               priv->name_owner->str,
+                                                               priv->object_path->str,
+                                                               NM_WPAS_DBUS_IFACE_INTERFACE_P2P_DEVICE,
                                                                _properties_changed_cb,
                                                                self,
                                                                NULL);
@@ -3428,16 +3463,19 @@ constructed(GObject *object)
                                                                self,
                                                                NULL);
 
-    priv->signal_id = g_dbus_connection_signal_subscribe(priv->dbus_connection,
-                                                         priv->name_owner->str,
-                                                         NULL,
-                                                         NULL,
-                                                         priv->object_path->str,
-                                                         NULL,
-                                                         G_DBUS_SIGNAL_FLAGS_NONE,
-                                                         _signal_cb,
-                                                         self,
-                                                         NULL);
+    for (i = 0; i < G_N_ELEMENTS(supplicant_signal_subscriptions); i++) {
+        priv->signal_ids[i] =
+            g_dbus_connection_signal_subscribe(priv->dbus_connection,
+                                               priv->name_owner->str,
+                                               supplicant_signal_subscriptions[i].interface_name,
+                                               supplicant_signal_subscriptions[i].signal_name,
+                                               priv->object_path->str,
+                                               NULL,
+                                               G_DBUS_SIGNAL_FLAGS_NONE,
+                                               _signal_cb,
+                                               self,
+                                               NULL);
+    }
 
     /* Scan result aging parameters */
     nm_dbus_connection_call_set(priv->dbus_connection,
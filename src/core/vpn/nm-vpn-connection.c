@@ -2107,41 +2107,44 @@ _dbus_signal_ip_config_cb(NMVpnConnection *self, int addr_family, GVariant *dict
 
             while (g_variant_iter_next(var_iter, "@au", &v)) {
                 _nm_unused gs_unref_variant GVariant *v_ref_owner = v;
+                const guint32                        *words;
+                gsize                                 len;
 
-                switch (g_variant_n_children(v)) {
-                case 5:
-                    g_variant_get_child(v, 4, "u", &route.r4.pref_src);
-                    /* fall-through */
-                case 4:
-                    g_variant_get_child(v, 0, "u", &route.r4.network);
-                    g_variant_get_child(v, 1, "u", &plen);
-                    g_variant_get_child(v, 2, "u", &route.r4.gateway);
-                    /* 4th item is unused route metric */
-                    route.r4.table_any  = TRUE;
-                    route.r4.metric_any = TRUE;
-                    route.r4.rt_source  = NM_IP_CONFIG_SOURCE_VPN;
-
-                    if (plen > 32)
-                        break;
-                    route.r4.plen    = plen;
-                    route.r4.network = nm_ip4_addr_clear_host_address(route.r4.network, plen);
-
-                    if (priv->ip_data_4.gw_external.addr4
-                        && route.r4.network == priv->ip_data_4.gw_external.addr4
-                        && route.r4.plen == 32) {
-                        /* Ignore host routes to the VPN gateway since NM adds one itself
-                         * below.  Since NM knows more about the routing situation than
-                         * the VPN server, we want to use the NM created route instead of
-                         * whatever the server provides.
-                         */
-                        break;
-                    }
-
-                    nm_l3_config_data_add_route_4(l3cd, &route.r4);
-                    break;
-                default:
-                    break;
+                /* "au" is a fixed array, so we can access the serialized
+                 * words directly instead of fetching a child variant per
+                 * index. With large route tables this is the hot path. */
+                words = g_variant_get_fixed_array(v, &len, sizeof(guint32));
+
+                if (!NM_IN_SET(len, 4, 5))
+                    continue;
+
+                plen = words[1];
+                if (plen > 32)
+                    continue;
+
+                route.r4 = (NMPlatformIP4Route){
+                    .network    = nm_ip4_addr_clear_host_address(words[0], plen),
+                    .plen       = plen,
+                    .gateway    = words[2],
+                    /* words[3] is the unused route metric */
+                    .pref_src   = (len == 5) ? words[4] : 0u,
+                    .table_any  = TRUE,
+                    .metric_any = TRUE,
+                    .rt_source  = NM_IP_CONFIG_SOURCE_VPN,
+                };
+
+                if (priv->ip_data_4.gw_external.addr4
+                    && route.r4.network == priv->ip_data_4.gw_external.addr4
+                    && route.r4.plen == 32) {
+                    /* Ignore host routes to the VPN gateway since NM adds one itself
+                     * below.  Since NM knows more about the routing situation than
+                     * the VPN server, we want to use the NM created route instead of
+                     * whatever the server provides.
+                     */
+                    continue;
                 }
+
+                nm_l3_config_data_add_route_4(l3cd, &route.r4);
             }
         }
     } else {
@@ -22,14 +22,17 @@
 #define NM_CONFIG_KEYFILE_KEY_MAIN_ASSUME_IPV6LL_ONLY          "assume-ipv6ll-only"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_AUTH_POLKIT                 "auth-polkit"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_AUTOCONNECT_RETRIES_DEFAULT "autoconnect-retries-default"
+#define NM_CONFIG_KEYFILE_KEY_MAIN_BUSY_POLL_USEC              "busy-poll-usec"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_CONFIGURE_AND_QUIT          "configure-and-quit"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_DEBUG                       "debug"
+#define NM_CONFIG_KEYFILE_KEY_MAIN_DEVICE_REALIZE_ORDER        "device-realize-order"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_DHCP                        "dhcp"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_DNS                         "dns"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_FIREWALL_BACKEND            "firewall-backend"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_HOSTNAME_MODE               "hostname-mode"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_IGNORE_CARRIER              "ignore-carrier"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_IWD_CONFIG_PATH             "iwd-config-path"
+#define NM_CONFIG_KEYFILE_KEY_MAIN_MAX_ACTIVATIONS_PER_CLIENT  "max-activations-per-client"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_MIGRATE_IFCFG_RH            "migrate-ifcfg-rh"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_MONITOR_CONNECTION_FILES    "monitor-connection-files"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_NO_AUTO_DEFAULT             "no-auto-default"
@@ -37,10 +40,12 @@
 #define NM_CONFIG_KEYFILE_KEY_MAIN_RC_MANAGER                  "rc-manager"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_SYSTEMD_RESOLVED            "systemd-resolved"
 
-#define NM_CONFIG_KEYFILE_KEY_LOGGING_AUDIT   "audit"
-#define NM_CONFIG_KEYFILE_KEY_LOGGING_BACKEND "backend"
-#define NM_CONFIG_KEYFILE_KEY_LOGGING_DOMAINS "domains"
-#define NM_CONFIG_KEYFILE_KEY_LOGGING_LEVEL   "level"
+#define NM_CONFIG_KEYFILE_KEY_LOGGING_AUDIT                "audit"
+#define NM_CONFIG_KEYFILE_KEY_LOGGING_BACKEND              "backend"
+#define NM_CONFIG_KEYFILE_KEY_LOGGING_DEVICE_FILTER        "device-filter"
+#define NM_CONFIG_KEYFILE_KEY_LOGGING_DOMAINS              "domains"
+#define NM_CONFIG_KEYFILE_KEY_LOGGING_FLIGHT_RECORDER_SIZE "flight-recorder-size"
+#define NM_CONFIG_KEYFILE_KEY_LOGGING_LEVEL                "level"
 
 #define NM_CONFIG_KEYFILE_KEY_CONNECTIVITY_ENABLED  "enabled"
 #define NM_CONFIG_KEYFILE_KEY_CONNECTIVITY_INTERVAL "interval"
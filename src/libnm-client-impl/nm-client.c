@@ -190,6 +190,7 @@ NM_GOBJECT_PROPERTIES_DEFINE(NMClient,
                              PROP_DBUS_NAME_OWNER,
                              PROP_VERSION,
                              PROP_INSTANCE_FLAGS,
+                             PROP_TRACKED_INTERFACES,
                              PROP_STATE,
                              PROP_STARTUP,
                              PROP_NM_RUNNING,
@@ -290,6 +291,12 @@ typedef struct {
     guint dbsid_nm_vpn_connection_state_changed;
     guint dbsid_nm_check_permissions;
 
+    /* which D-Bus interfaces to watch for PropertiesChanged. If set, one
+     * arg0-scoped signal subscription per interface is used instead of the
+     * catch-all subscription (dbsid_dbus_properties_properties_changed). */
+    char **tracked_interfaces;
+    guint *dbsid_props_changed_per_iface;
+
     NMClientInstanceFlags instance_flags : 5;
 
     NMTernary permissions_state : 3;
@@ -2453,84 +2460,144 @@ _obj_handle_dbus_prop_changes(NMClient            *self,
 
     notify_update_prop_flags = NML_DBUS_NOTIFY_UPDATE_PROP_FLAGS_NOTIFY;
 
+    /* For all plain types, the update is skipped altogether (including the
+     * notification) when the received value is equal to the cached one. The
+     * daemon only sends changed values, but a full resync (after a name-owner
+     * change) re-delivers every property, and suppressing the no-op updates
+     * avoids both the notify dispatch and the re-allocation of the strings,
+     * strvs and byte arrays. */
     switch (dbus_type_s[0]) {
     case 'b':
         nm_assert(dbus_type_s[1] == '\0');
-        if (value)
-            *((bool *) p_property) = g_variant_get_boolean(value);
-        else if (param_spec->value_type == G_TYPE_BOOLEAN)
-            *((bool *) p_property) = ((GParamSpecBoolean *) param_spec)->default_value;
-        else {
-            nm_assert_not_reached();
-            *((bool *) p_property) = FALSE;
+        {
+            bool v;
+
+            if (value)
+                v = g_variant_get_boolean(value);
+            else if (param_spec->value_type == G_TYPE_BOOLEAN)
+                v = ((GParamSpecBoolean *) param_spec)->default_value;
+            else {
+                nm_assert_not_reached();
+                v = FALSE;
+            }
+            if (*((bool *) p_property) == v)
+                return;
+            *((bool *) p_property) = v;
         }
         break;
     case 'y':
         nm_assert(dbus_type_s[1] == '\0');
-        if (value)
-            *((guint8 *) p_property) = g_variant_get_byte(value);
-        else {
-            nm_assert(nm_utils_g_param_spec_is_default(param_spec));
-            *((guint8 *) p_property) = 0;
+        {
+            guint8 v;
+
+            if (value)
+                v = g_variant_get_byte(value);
+            else {
+                nm_assert(nm_utils_g_param_spec_is_default(param_spec));
+                v = 0;
+            }
+            if (*((guint8 *) p_property) == v)
+                return;
+            *((guint8 *) p_property) = v;
         }
         break;
     case 'q':
         nm_assert(dbus_type_s[1] == '\0');
-        if (value)
-            *((guint16 *) p_property) = g_variant_get_uint16(value);
-        else {
-            nm_assert(nm_utils_g_param_spec_is_default(param_spec));
-            *((guint16 *) p_property) = 0;
+        {
+            guint16 v;
+
+            if (value)
+                v = g_variant_get_uint16(value);
+            else {
+                nm_assert(nm_utils_g_param_spec_is_default(param_spec));
+                v = 0;
+            }
+            if (*((guint16 *) p_property) == v)
+                return;
+            *((guint16 *) p_property) = v;
         }
         break;
     case 'i':
         nm_assert(dbus_type_s[1] == '\0');
-        if (value)
-            *((gint32 *) p_property) = g_variant_get_int32(value);
-        else if (param_spec->value_type == G_TYPE_INT)
-            *((gint32 *) p_property) = ((GParamSpecInt *) param_spec)->default_value;
-        else {
-            nm_assert(nm_utils_g_param_spec_is_default(param_spec));
-            *((gint32 *) p_property) = 0;
+        {
+            gint32 v;
+
+            if (value)
+                v = g_variant_get_int32(value);
+            else if (param_spec->value_type == G_TYPE_INT)
+                v = ((GParamSpecInt *) param_spec)->default_value;
+            else {
+                nm_assert(nm_utils_g_param_spec_is_default(param_spec));
+                v = 0;
+            }
+            if (*((gint32 *) p_property) == v)
+                return;
+            *((gint32 *) p_property) = v;
         }
         break;
     case 'u':
         nm_assert(dbus_type_s[1] == '\0');
-        if (value)
-            *((guint32 *) p_property) = g_variant_get_uint32(value);
-        else {
-            nm_assert(nm_utils_g_param_spec_is_default(param_spec));
-            *((guint32 *) p_property) = 0;
+        {
+            guint32 v;
+
+            if (value)
+                v = g_variant_get_uint32(value);
+            else {
+                nm_assert(nm_utils_g_param_spec_is_default(param_spec));
+                v = 0;
+            }
+            if (*((guint32 *) p_property) == v)
+                return;
+            *((guint32 *) p_property) = v;
         }
         break;
     case 'x':
         nm_assert(dbus_type_s[1] == '\0');
-        if (value)
-            *((gint64 *) p_property) = g_variant_get_int64(value);
-        else if (param_spec->value_type == G_TYPE_INT64)
-            *((gint64 *) p_property) = ((GParamSpecInt64 *) param_spec)->default_value;
-        else {
-            nm_assert(nm_utils_g_param_spec_is_default(param_spec));
-            *((gint64 *) p_property) = 0;
+        {
+            gint64 v;
+
+            if (value)
+                v = g_variant_get_int64(value);
+            else if (param_spec->value_type == G_TYPE_INT64)
+                v = ((GParamSpecInt64 *) param_spec)->default_value;
+            else {
+                nm_assert(nm_utils_g_param_spec_is_default(param_spec));
+                v = 0;
+            }
+            if (*((gint64 *) p_property) == v)
+                return;
+            *((gint64 *) p_property) = v;
         }
         break;
     case 't':
         nm_assert(dbus_type_s[1] == '\0');
-        if (value)
-            *((guint64 *) p_property) = g_variant_get_uint64(value);
-        else {
-            nm_assert(nm_utils_g_param_spec_is_default(param_spec));
-            *((guint64 *) p_property) = 0;
+        {
+            guint64 v;
+
+            if (value)
+                v = g_variant_get_uint64(value);
+            else {
+                nm_assert(nm_utils_g_param_spec_is_default(param_spec));
+                v = 0;
+            }
+            if (*((guint64 *) p_property) == v)
+                return;
+            *((guint64 *) p_property) = v;
         }
         break;
     case 's':
         nm_assert(dbus_type_s[1] == '\0');
-        nm_clear_g_free((char **) p_property);
-        if (value)
-            *((char **) p_property) = g_variant_dup_string(value, NULL);
-        else {
-            nm_assert(nm_utils_g_param_spec_is_default(param_spec));
-            *((char **) p_property) = NULL;
+        {
+            const char *v = NULL;
+
+            if (value)
+                v = g_variant_get_string(value, NULL);
+            else
+                nm_assert(nm_utils_g_param_spec_is_default(param_spec));
+            if (nm_streq0(*((char **) p_property), v))
+                return;
+            g_free(*((char **) p_property));
+            *((char **) p_property) = g_strdup(v);
         }
         break;
     case 'o':
@@ -2547,32 +2614,39 @@ _obj_handle_dbus_prop_changes(NMClient            *self,
         case 'y':
             nm_assert(dbus_type_s[2] == '\0');
             {
-                gconstpointer v;
-                gsize         l;
-                GBytes       *b = NULL;
+                gconstpointer v = NULL;
+                gsize         l = 0;
 
-                if (value) {
+                if (value)
                     v = g_variant_get_fixed_array(value, &l, 1);
 
-                    if (l > 0) {
-                        /* empty arrays are coerced to NULL. */
-                        b = g_bytes_new(v, l);
-                    }
-                }
+                /* empty arrays are coerced to NULL, hence nm_g_bytes_equal_mem()
+                 * treating a NULL GBytes like an empty array fits exactly. */
+                if (nm_g_bytes_equal_mem(*((GBytes **) p_property), v, l))
+                    return;
 
                 nm_clear_pointer((GBytes **) p_property, g_bytes_unref);
-                *((GBytes **) p_property) = b;
+                if (l > 0)
+                    *((GBytes **) p_property) = g_bytes_new(v, l);
             }
             break;
         case 's':
             nm_assert(dbus_type_s[2] == '\0');
             nm_assert(param_spec->value_type == G_TYPE_STRV);
-
-            g_strfreev(*((char ***) p_property));
-            if (value)
-                *((char ***) p_property) = g_variant_dup_strv(value, NULL);
-            else
-                *((char ***) p_property) = NULL;
+            {
+                gs_free const char **v   = NULL;
+                const char *const   *old = *((const char *const **) p_property);
+
+                if (value)
+                    v = g_variant_get_strv(value, NULL);
+                if ((!old == !v) && (!old || nm_strv_equal(old, v)))
+                    return;
+                g_strfreev(*((char ***) p_property));
+                if (value)
+                    *((char ***) p_property) = g_variant_dup_strv(value, NULL);
+                else
+                    *((char ***) p_property) = NULL;
+            }
             break;
         case 'o':
             nm_assert(dbus_type_s[2] == '\0');
@@ -3413,11 +3487,34 @@ _dbus_settings_updated_cb(GDBusConnection *connection,
         return;
     }
 
+    if (NM_FLAGS_HAS((NMClientInstanceFlags) priv->instance_flags,
+                     NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_SETTINGS)) {
+        NML_NMCLIENT_LOG_T(self,
+                           "%s: [%s] Updated signal received (ignored)",
+                           log_context,
+                           object_path);
+        return;
+    }
+
     NML_NMCLIENT_LOG_T(self, "%s: [%s] Updated signal received", log_context, object_path);
 
     _nm_client_get_settings_call(self, dbobj);
 }
 
+static void
+_dbus_settings_fetch_all_start(NMClient *self)
+{
+    NMClientPrivate *priv = NM_CLIENT_GET_PRIVATE(self);
+    GHashTableIter   iter;
+    NMLDBusObject   *dbobj;
+
+    g_hash_table_iter_init(&iter, priv->dbus_objects);
+    while (g_hash_table_iter_next(&iter, (gpointer *) &dbobj, NULL)) {
+        if (NM_IS_REMOTE_CONNECTION(dbobj->nmobj))
+            _nm_client_get_settings_call(self, dbobj);
+    }
+}
+
 /*****************************************************************************/
 
 static void
@@ -3984,6 +4081,23 @@ _request_wait_finish(NMClient     *client,
 
 /*****************************************************************************/
 
+/**
+ * nm_client_get_tracked_interfaces:
+ * @self: the #NMClient instance.
+ *
+ * Returns: (transfer none) (nullable): the #NMClient:tracked-interfaces
+ *   property, or %NULL if all interfaces are tracked.
+ *
+ * Since: 1.48
+ */
+const char *const *
+nm_client_get_tracked_interfaces(NMClient *self)
+{
+    g_return_val_if_fail(NM_IS_CLIENT(self), NULL);
+
+    return (const char *const *) NM_CLIENT_GET_PRIVATE(self)->tracked_interfaces;
+}
+
 /**
  * nm_client_get_instance_flags:
  * @self: the #NMClient instance.
@@ -6144,6 +6258,126 @@ nm_client_reload_connections_finish(NMClient *client, GAsyncResult *result, GErr
     return TRUE;
 }
 
+static void
+_load_connections_settings_cb(GObject *source, GAsyncResult *result, gpointer user_data)
+{
+    gs_unref_variant GVariant *ret        = NULL;
+    gs_unref_object GTask     *task       = user_data;
+    gs_unref_variant GVariant *v_settings = NULL;
+    NMClient                  *self;
+    GVariantIter               iter;
+    const char                *path;
+    GVariant                  *settings;
+    guint                      n_committed = 0;
+    GError                    *error       = NULL;
+
+    ret = g_dbus_connection_call_finish(G_DBUS_CONNECTION(source), result, &error);
+    if (!ret) {
+        if (!nm_utils_error_is_cancelled(error))
+            g_dbus_error_strip_remote_error(error);
+        g_task_return_error(task, error);
+        return;
+    }
+
+    self = g_task_get_source_object(task);
+
+    v_settings = g_variant_get_child_value(ret, 0);
+    g_variant_iter_init(&iter, v_settings);
+    while (g_variant_iter_next(&iter, "{&o@a{sa{sv}}}", &path, &settings)) {
+        gs_unref_variant GVariant *settings_take = settings;
+        NMLDBusObject             *dbobj;
+
+        dbobj = _dbobjs_dbobj_get_s(self, path);
+        if (!dbobj || !NM_IS_REMOTE_CONNECTION(dbobj->nmobj)) {
+            NML_NMCLIENT_LOG_T(self,
+                               "GetConnectionsSettings() returned settings for unknown object %s",
+                               path);
+            continue;
+        }
+
+        NML_NMCLIENT_LOG_T(self, "[%s]: GetConnectionsSettings() completed", path);
+        _nm_remote_settings_get_settings_commit(NM_REMOTE_CONNECTION(dbobj->nmobj), settings);
+        n_committed++;
+    }
+
+    if (n_committed > 0)
+        _dbus_handle_changes_commit(self, TRUE);
+
+    g_task_return_boolean(task, TRUE);
+}
+
+/**
+ * nm_client_load_connections_settings:
+ * @client: the #NMClient
+ * @paths: (array zero-terminated=1): the D-Bus object paths of the connection
+ *   profiles whose settings to fetch
+ * @cancellable: a #GCancellable, or %NULL
+ * @callback: (scope async): callback to be called when the operation completes
+ * @user_data: (closure): caller-specific data passed to @callback
+ *
+ * Fetches the settings of the given connection profiles with one
+ * "GetConnectionsSettings" D-Bus call and updates the corresponding
+ * #NMRemoteConnection instances. This is mainly useful together with
+ * %NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_SETTINGS, to hydrate only
+ * the profiles of interest instead of issuing one "GetSettings" call
+ * per profile.
+ *
+ * Profiles that the daemon omits from the reply (because they no longer
+ * exist or are not visible to the caller) keep their previous content.
+ * The caller is responsible for splitting large path lists into batches
+ * so that the reply stays below the D-Bus maximum message size.
+ *
+ * Since: 1.48
+ **/
+void
+nm_client_load_connections_settings(NMClient           *client,
+                                    const char *const  *paths,
+                                    GCancellable       *cancellable,
+                                    GAsyncReadyCallback callback,
+                                    gpointer            user_data)
+{
+    g_return_if_fail(NM_IS_CLIENT(client));
+    g_return_if_fail(paths);
+    g_return_if_fail(!cancellable || G_IS_CANCELLABLE(cancellable));
+
+    _nm_client_dbus_call(client,
+                         client,
+                         nm_client_load_connections_settings,
+                         cancellable,
+                         callback,
+                         user_data,
+                         NM_DBUS_PATH_SETTINGS,
+                         NM_DBUS_INTERFACE_SETTINGS,
+                         "GetConnectionsSettings",
+                         g_variant_new("(^ao)", (char **) paths),
+                         G_VARIANT_TYPE("(a{oa{sa{sv}}})"),
+                         G_DBUS_CALL_FLAGS_NONE,
+                         NM_DBUS_DEFAULT_TIMEOUT_MSEC,
+                         _load_connections_settings_cb);
+}
+
+/**
+ * nm_client_load_connections_settings_finish:
+ * @client: the #NMClient
+ * @result: the result passed to the #GAsyncReadyCallback
+ * @error: return location for #GError
+ *
+ * Gets the result of an nm_client_load_connections_settings() call.
+ *
+ * Returns: %TRUE on success, %FALSE on failure
+ *
+ * Since: 1.48
+ **/
+gboolean
+nm_client_load_connections_settings_finish(NMClient *client, GAsyncResult *result, GError **error)
+{
+    g_return_val_if_fail(NM_IS_CLIENT(client), FALSE);
+    g_return_val_if_fail(nm_g_task_is_valid(result, client, nm_client_load_connections_settings),
+                         FALSE);
+
+    return g_task_propagate_boolean(G_TASK(result), error);
+}
+
 /*****************************************************************************/
 
 /**
@@ -6962,14 +7196,37 @@ _init_fetch_all(NMClient *self)
                                                            self,
                                                            NULL);
 
-    priv->dbsid_dbus_properties_properties_changed =
-        nm_dbus_connection_signal_subscribe_properties_changed(priv->dbus_connection,
-                                                               priv->name_owner,
-                                                               NULL,
-                                                               NULL,
-                                                               _dbus_properties_changed_cb,
-                                                               self,
-                                                               NULL);
+    if (priv->tracked_interfaces) {
+        gsize i;
+        gsize n;
+
+        /* only receive PropertiesChanged for the interfaces the user asked for.
+         * PropertiesChanged carries the interface name as first argument, so the
+         * bus daemon filters with arg0 match rules and we don't get woken up
+         * for anything else. */
+        n                                   = NM_PTRARRAY_LEN(priv->tracked_interfaces);
+        priv->dbsid_props_changed_per_iface = g_new(guint, n);
+        for (i = 0; i < n; i++) {
+            priv->dbsid_props_changed_per_iface[i] =
+                nm_dbus_connection_signal_subscribe_properties_changed(
+                    priv->dbus_connection,
+                    priv->name_owner,
+                    NULL,
+                    priv->tracked_interfaces[i],
+                    _dbus_properties_changed_cb,
+                    self,
+                    NULL);
+        }
+    } else {
+        priv->dbsid_dbus_properties_properties_changed =
+            nm_dbus_connection_signal_subscribe_properties_changed(priv->dbus_connection,
+                                                                   priv->name_owner,
+                                                                   NULL,
+                                                                   NULL,
+                                                                   _dbus_properties_changed_cb,
+                                                                   self,
+                                                                   NULL);
+    }
 
     priv->dbsid_nm_settings_connection_updated =
         g_dbus_connection_signal_subscribe(priv->dbus_connection,
@@ -7019,6 +7276,14 @@ _init_fetch_all(NMClient *self)
                                            self,
                                            NULL);
 
+    /* After a name-owner change the whole object tree is fetched anew, even
+     * if the daemon state did not change across the bus hiccup. That cannot
+     * be avoided with per-object generation counters: such counters would
+     * themselves have to be fetched to be compared (exactly this call), a
+     * new name owner means a restarted daemon whose object paths may be
+     * reused for different objects, and while the subscriptions above were
+     * down we may have missed arbitrary change signals. One
+     * GetManagedObjects() round trip is the price of a verifiable state. */
     g_dbus_connection_call(priv->dbus_connection,
                            priv->name_owner,
                            "/org/freedesktop",
@@ -7052,6 +7317,17 @@ _init_release_all(NMClient *self)
     nm_clear_g_dbus_connection_signal(priv->dbus_connection, &priv->dbsid_nm_object_manager);
     nm_clear_g_dbus_connection_signal(priv->dbus_connection,
                                       &priv->dbsid_dbus_properties_properties_changed);
+    if (priv->dbsid_props_changed_per_iface) {
+        gsize i;
+        gsize n;
+
+        n = NM_PTRARRAY_LEN(priv->tracked_interfaces);
+        for (i = 0; i < n; i++) {
+            nm_clear_g_dbus_connection_signal(priv->dbus_connection,
+                                              &priv->dbsid_props_changed_per_iface[i]);
+        }
+        nm_clear_g_free(&priv->dbsid_props_changed_per_iface);
+    }
     nm_clear_g_dbus_connection_signal(priv->dbus_connection,
                                       &priv->dbsid_nm_settings_connection_updated);
     nm_clear_g_dbus_connection_signal(priv->dbus_connection,
@@ -7521,6 +7797,9 @@ get_property(GObject *object, guint prop_id, GValue *value, GParamSpec *pspec)
     case PROP_INSTANCE_FLAGS:
         g_value_set_uint(value, priv->instance_flags);
         break;
+    case PROP_TRACKED_INTERFACES:
+        g_value_set_boxed(value, priv->tracked_interfaces);
+        break;
     case PROP_DBUS_CONNECTION:
         g_value_set_object(value, priv->dbus_connection);
         break;
@@ -7695,6 +7974,30 @@ set_property(GObject *object, guint prop_id, const GValue *value, GParamSpec *ps
                 if (priv->dbsid_nm_check_permissions != 0)
                     _dbus_check_permissions_start(self);
             }
+
+            if ((priv->instance_flags ^ flags) & NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_SETTINGS) {
+                if (NM_FLAGS_HAS(flags, NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_SETTINGS))
+                    priv->instance_flags |= NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_SETTINGS;
+                else {
+                    priv->instance_flags &= ~NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_SETTINGS;
+                    if (priv->dbsid_nm_settings_connection_updated != 0) {
+                        /* while the flag was set, Updated signals were ignored and
+                         * newly appearing profiles were not fetched at all. Now
+                         * (re)fetch the settings of all profiles. */
+                        _dbus_settings_fetch_all_start(self);
+                    }
+                }
+            }
+        }
+        break;
+
+    case PROP_TRACKED_INTERFACES:
+        /* construct-only */
+        nm_assert(!priv->tracked_interfaces);
+        priv->tracked_interfaces = g_value_dup_boxed(value);
+        if (priv->tracked_interfaces && !priv->tracked_interfaces[0]) {
+            /* an empty list means no filter, like NULL. */
+            nm_clear_pointer(&priv->tracked_interfaces, g_strfreev);
         }
         break;
 
@@ -8071,6 +8374,8 @@ dispose(GObject *object)
 
     nm_clear_g_free(&priv->permissions);
 
+    nm_clear_pointer(&priv->tracked_interfaces, g_strfreev);
+
     g_clear_object(&priv->dbus_connection);
 
     g_clear_object(&priv->context_busy_watcher);
@@ -8281,6 +8586,29 @@ nm_client_class_init(NMClientClass *client_class)
         0,
         G_PARAM_READABLE | G_PARAM_WRITABLE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS);
 
+    /**
+     * NMClient:tracked-interfaces:
+     *
+     * If set to a non-empty list of D-Bus interface names, the client only
+     * subscribes to PropertiesChanged signals of these interfaces. The bus
+     * daemon then filters the signals with arg0 match rules, so the process
+     * does not get woken up by property changes it is not interested in.
+     *
+     * All objects still get created from the initial GetManagedObjects()
+     * snapshot and object add/remove is still tracked, but properties of
+     * interfaces not in the list go stale after initialization. Only set
+     * this if you know which properties you will read.
+     *
+     * Since: 1.48
+     */
+    obj_properties[PROP_TRACKED_INTERFACES] =
+        g_param_spec_boxed(NM_CLIENT_TRACKED_INTERFACES,
+                           "",
+                           "",
+                           G_TYPE_STRV,
+                           G_PARAM_READABLE | G_PARAM_WRITABLE | G_PARAM_CONSTRUCT_ONLY
+                               | G_PARAM_STATIC_STRINGS);
+
     /**
      * NMClient:dbus-name-owner:
      *
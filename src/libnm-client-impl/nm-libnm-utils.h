@@ -238,7 +238,8 @@ typedef enum {
 #define NM_CLIENT_INSTANCE_FLAGS_ALL                                             \
     ((NMClientInstanceFlags) (NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_PERMISSIONS \
                               | NM_CLIENT_INSTANCE_FLAGS_INITIALIZED_GOOD        \
-                              | NM_CLIENT_INSTANCE_FLAGS_INITIALIZED_BAD))
+                              | NM_CLIENT_INSTANCE_FLAGS_INITIALIZED_BAD         \
+                              | NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_SETTINGS))
 
 #define NM_CLIENT_INSTANCE_FLAGS_ALL_WRITABLE                                                       \
     ((NMClientInstanceFlags) (NM_CLIENT_INSTANCE_FLAGS_ALL                                          \
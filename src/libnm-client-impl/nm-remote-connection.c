@@ -718,6 +718,16 @@ register_client(NMObject *nmobj, NMClient *client, NMLDBusObject *dbobj)
 {
     NM_OBJECT_CLASS(nm_remote_connection_parent_class)->register_client(nmobj, client, dbobj);
     _nm_connection_set_path_rstr(NM_CONNECTION(nmobj), dbobj->dbus_path);
+
+    if (NM_FLAGS_HAS(nm_client_get_instance_flags(client),
+                     NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_SETTINGS)) {
+        /* the user opted out of fetching the settings. Don't hold up readiness,
+         * the profile merely stays without settings (and not visible) until the
+         * flag gets cleared. */
+        NM_REMOTE_CONNECTION_GET_PRIVATE(nmobj)->is_initialized = TRUE;
+        return;
+    }
+
     _nm_client_get_settings_call(client, dbobj);
 }
 
@@ -29,6 +29,15 @@ G_BEGIN_DECLS
  * @NM_CLIENT_INSTANCE_FLAGS_INITIALIZED_BAD: like @NM_CLIENT_INSTANCE_FLAGS_INITIALIZED_GOOD
  *   indicates that the instance completed initialization with failure. In that
  *   case the instance is unusable. Since: 1.42.
+ * @NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_SETTINGS: by default, NMClient
+ *   fetches the settings of each connection profile via "GetSettings" and
+ *   refetches them when the profile's "Updated" signal gets received. With
+ *   many profiles this dominates the initialization time and the memory
+ *   footprint of the client. By setting this flag, the settings are not
+ *   fetched; the profiles are still created but they have no settings and
+ *   are not visible (nm_remote_connection_get_visible()). You can toggle
+ *   this flag; when it gets cleared, the settings of all profiles are
+ *   fetched. Since: 1.48.
  *
  * Since: 1.24
  */
@@ -37,6 +46,7 @@ typedef enum /*< flags >*/ {
     NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_PERMISSIONS = 0x1,
     NM_CLIENT_INSTANCE_FLAGS_INITIALIZED_GOOD          = 0x2,
     NM_CLIENT_INSTANCE_FLAGS_INITIALIZED_BAD           = 0x4,
+    NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_SETTINGS    = 0x8,
 } NMClientInstanceFlags;
 
 #define NM_TYPE_CLIENT            (nm_client_get_type())
@@ -55,6 +65,8 @@ typedef enum /*< flags >*/ {
 #define NM_CLIENT_DBUS_NAME_OWNER "dbus-name-owner"
 #define NM_CLIENT_INSTANCE_FLAGS  "instance-flags"
 
+#define NM_CLIENT_TRACKED_INTERFACES "tracked-interfaces"
+
 _NM_DEPRECATED_SYNC_WRITABLE_PROPERTY
 #define NM_CLIENT_NETWORKING_ENABLED "networking-enabled"
 
@@ -175,6 +187,9 @@ NMClient *nm_client_new_finish(GAsyncResult *result, GError **error);
 NM_AVAILABLE_IN_1_24
 NMClientInstanceFlags nm_client_get_instance_flags(NMClient *self);
 
+NM_AVAILABLE_IN_1_48
+const char *const *nm_client_get_tracked_interfaces(NMClient *self);
+
 NM_AVAILABLE_IN_1_22
 GDBusConnection *nm_client_get_dbus_connection(NMClient *client);
 
@@ -414,6 +429,17 @@ void nm_client_reload_connections_async(NMClient           *client,
 gboolean
 nm_client_reload_connections_finish(NMClient *client, GAsyncResult *result, GError **error);
 
+NM_AVAILABLE_IN_1_48
+void     nm_client_load_connections_settings(NMClient           *client,
+                                             const char *const  *paths,
+                                             GCancellable       *cancellable,
+                                             GAsyncReadyCallback callback,
+                                             gpointer            user_data);
+NM_AVAILABLE_IN_1_48
+gboolean nm_client_load_connections_settings_finish(NMClient     *client,
+                                                    GAsyncResult *result,
+                                                    GError      **error);
+
 NM_AVAILABLE_IN_1_6
 const char *nm_client_get_dns_mode(NMClient *client);
 NM_AVAILABLE_IN_1_6
@@ -61,6 +61,8 @@ _nm_connection_private_clear(NMConnectionPrivate *priv)
     if (priv->self) {
         _nm_connection_clear_settings(priv->self, priv);
         nm_clear_pointer(&priv->path, nm_ref_string_unref);
+        g_clear_error(&priv->verify_error);
+        nm_clear_pointer(&priv->dbus_cached, g_variant_unref);
         priv->self = NULL;
     }
 }
@@ -115,21 +117,37 @@ _nm_connection_get_private_from_qdata(NMConnection *connection)
 
 /*****************************************************************************/
 
+static void
+_cache_invalidate(NMConnection *self)
+{
+    NMConnectionPrivate *priv = NM_CONNECTION_GET_PRIVATE(self);
+
+    priv->verify_cached = FALSE;
+    g_clear_error(&priv->verify_error);
+    nm_clear_pointer(&priv->dbus_cached, g_variant_unref);
+}
+
 static void
 _signal_emit_changed(NMConnection *self)
 {
+    _cache_invalidate(self);
     g_signal_emit(self, signals[CHANGED], 0);
 }
 
 static void
 _signal_emit_secrets_updated(NMConnection *self, const char *setting_name)
 {
+    /* Secrets are covered by verify too (e.g. their format/length), but
+     * secret updates block the per-setting notify handler. Invalidate
+     * explicitly. */
+    _cache_invalidate(self);
     g_signal_emit(self, signals[SECRETS_UPDATED], 0, setting_name);
 }
 
 static void
 _signal_emit_secrets_cleared(NMConnection *self)
 {
+    _cache_invalidate(self);
     g_signal_emit(self, signals[SECRETS_CLEARED], 0);
 }
 
@@ -144,12 +162,28 @@ _setting_notify_changed_cb(NMSetting *setting, GParamSpec *pspec, NMConnection *
 static void
 _setting_notify_connect(NMConnection *connection, NMSetting *setting)
 {
+    /* This is the point where a setting becomes part of the connection.
+     * Some callers (like _nm_connection_replace_settings()) verify the
+     * connection before they emit the (deferred) changed signal, so the
+     * caches must be invalidated here already.
+     *
+     * It is also the reason why a setting instance belongs to exactly one
+     * connection and cannot be interned into a content-addressed table and
+     * shared between profiles that happen to carry identical settings: the
+     * handler connected here is blocked/disconnected by (func, connection)
+     * match, nm_connection_update_secrets() and nm_connection_clear_secrets()
+     * modify settings in place, and the immutability of "unchanging"
+     * connections is only asserted, not enforced. Deduplication of templated
+     * profiles would have to happen below the NMSetting layer (for example
+     * for the property values themselves), not by sharing the GObjects. */
+    _cache_invalidate(connection);
     g_signal_connect(setting, "notify", G_CALLBACK(_setting_notify_changed_cb), connection);
 }
 
 static void
 _setting_notify_disconnect(NMConnection *connection, NMSetting *setting)
 {
+    _cache_invalidate(connection);
     g_signal_handlers_disconnect_by_func(setting,
                                          G_CALLBACK(_setting_notify_changed_cb),
                                          connection);
@@ -1816,8 +1850,8 @@ nm_connection_verify(NMConnection *connection, GError **error)
     return result == NM_SETTING_VERIFY_SUCCESS || result == NM_SETTING_VERIFY_NORMALIZABLE;
 }
 
-NMSettingVerifyResult
-_nm_connection_verify(NMConnection *connection, GError **error)
+static NMSettingVerifyResult
+_connection_verify(NMConnection *connection, GError **error)
 {
     NMConnectionPrivate  *priv;
     NMSettingIPConfig    *s_ip4;
@@ -1970,6 +2004,51 @@ _nm_connection_verify(NMConnection *connection, GError **error)
     return NM_SETTING_VERIFY_SUCCESS;
 }
 
+NMSettingVerifyResult
+_nm_connection_verify(NMConnection *connection, GError **error)
+{
+    NMConnectionPrivate  *priv;
+    gs_free_error GError *local = NULL;
+    NMSettingVerifyResult result;
+
+    g_return_val_if_fail(NM_IS_CONNECTION(connection), NM_SETTING_VERIFY_ERROR);
+    g_return_val_if_fail(!error || !*error, NM_SETTING_VERIFY_ERROR);
+
+    priv = NM_CONNECTION_GET_PRIVATE(connection);
+
+    if (G_LIKELY(priv->verify_cached)) {
+        /* The connection did not change since the last verification.
+         * Repeating it would yield the same result. */
+#if NM_MORE_ASSERTS > 10
+        {
+            gs_free_error GError *check_error = NULL;
+
+            nm_assert(_connection_verify(connection, &check_error) == priv->verify_result);
+            nm_assert((!check_error) == (!priv->verify_error));
+            nm_assert(!check_error
+                      || (check_error->domain == priv->verify_error->domain
+                          && check_error->code == priv->verify_error->code));
+        }
+#endif
+        if (error && priv->verify_error)
+            *error = g_error_copy(priv->verify_error);
+        return priv->verify_result;
+    }
+
+    /* Always collect the error, even if the caller does not care about it.
+     * A later, cached call might. */
+    result = _connection_verify(connection, &local);
+
+    nm_assert(!priv->verify_error);
+    priv->verify_result = result;
+    priv->verify_error  = local ? g_error_copy(local) : NULL;
+    priv->verify_cached = TRUE;
+
+    if (local)
+        g_propagate_error(error, g_steal_pointer(&local));
+    return result;
+}
+
 /**
  * nm_connection_verify_secrets:
  * @connection: the #NMConnection to verify in
@@ -2758,6 +2837,53 @@ nm_connection_to_dbus_full(NMConnection                           *connection,
     return g_variant_builder_end(&builder);
 }
 
+/**
+ * _nm_connection_to_dbus_cached:
+ * @connection: the #NMConnection
+ *
+ * Like nm_connection_to_dbus() with %NM_CONNECTION_SERIALIZE_ALL and default
+ * serialization options, but the result is cached on @connection until the
+ * connection changes. Unlike nm_connection_to_dbus(), the returned variant is
+ * not floating.
+ *
+ * Note that _nm_setting_to_dbus() may look at sibling settings of @connection,
+ * which is why the cache is at the connection level (and not per-setting).
+ *
+ * Returns: (transfer none): the serialized connection, owned by @connection
+ *   and valid until the connection gets modified or destroyed. %NULL if the
+ *   connection has no settings. Take a reference to keep it longer.
+ **/
+GVariant *
+_nm_connection_to_dbus_cached(NMConnection *connection)
+{
+    NMConnectionPrivate *priv;
+
+    g_return_val_if_fail(NM_IS_CONNECTION(connection), NULL);
+
+    priv = NM_CONNECTION_GET_PRIVATE(connection);
+
+    if (G_UNLIKELY(!priv->dbus_cached)) {
+        GVariant *dict;
+
+        dict = nm_connection_to_dbus_full(connection, NM_CONNECTION_SERIALIZE_ALL, NULL);
+        if (!dict)
+            return NULL;
+        priv->dbus_cached = g_variant_ref_sink(dict);
+    }
+#if NM_MORE_ASSERTS > 10
+    else {
+        gs_unref_variant GVariant *check = NULL;
+
+        check = nm_connection_to_dbus_full(connection, NM_CONNECTION_SERIALIZE_ALL, NULL);
+        nm_assert(check);
+        g_variant_ref_sink(check);
+        nm_assert(g_variant_equal(check, priv->dbus_cached));
+    }
+#endif
+
+    return priv->dbus_cached;
+}
+
 /**
  * nm_connection_is_type:
  * @connection: the #NMConnection
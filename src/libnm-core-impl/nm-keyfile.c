@@ -50,6 +50,13 @@ typedef struct {
     GError              *error;
     const char          *group;
     NMSetting           *setting;
+
+    /* the sorted list of keys that are present in @group. Set while reading
+     * a setting group, so that read_one_setting_value() can check for key
+     * existence with a binary search instead of a GKeyFile lookup (with
+     * the alias group fallback) for every known property. */
+    const char *const *group_keys;
+    gsize              group_keys_len;
 } KeyfileReaderInfo;
 
 typedef struct {
@@ -1157,6 +1164,20 @@ ip_dns_parser(KeyfileReaderInfo *info, NMSetting *setting, const char *key)
     g_object_set(setting, key, list, NULL);
 }
 
+/* The addr-gen-mode vocabulary is fixed, so resolve it via a static table
+ * instead of nm_utils_enum_from_str(). The latter reflects through the
+ * GEnumClass, and g_type_class_ref() serializes all readers on the global
+ * GType lock, which is measurable when many profiles are loaded at once. */
+static NM_UTILS_STRING_TABLE_LOOKUP_DEFINE(
+    _ip6_addr_gen_mode_from_string,
+    int,
+    { nm_assert(name); },
+    { return -1; },
+    {"default", NM_SETTING_IP6_CONFIG_ADDR_GEN_MODE_DEFAULT},
+    {"default-or-eui64", NM_SETTING_IP6_CONFIG_ADDR_GEN_MODE_DEFAULT_OR_EUI64},
+    {"eui64", NM_SETTING_IP6_CONFIG_ADDR_GEN_MODE_EUI64},
+    {"stable-privacy", NM_SETTING_IP6_CONFIG_ADDR_GEN_MODE_STABLE_PRIVACY}, );
+
 static void
 ip6_addr_gen_mode_parser(KeyfileReaderInfo *info, NMSetting *setting, const char *key)
 {
@@ -1166,10 +1187,20 @@ ip6_addr_gen_mode_parser(KeyfileReaderInfo *info, NMSetting *setting, const char
 
     s = nm_keyfile_plugin_kf_get_string(info->keyfile, setting_name, key, NULL);
     if (s) {
-        if (!nm_utils_enum_from_str(nm_setting_ip6_config_addr_gen_mode_get_type(),
-                                    s,
-                                    (int *) &addr_gen_mode,
-                                    NULL)) {
+        gint64 i64;
+        int    v;
+
+        g_strstrip(s);
+
+        /* Numeric values keep working like with the enum parser; any integer
+         * is accepted here and invalid ones are rejected by verification. */
+        i64 = _nm_utils_ascii_str_to_int64(s, 0, G_MININT, G_MAXINT, G_MININT64);
+        if (i64 != G_MININT64 || errno == 0)
+            v = (int) i64;
+        else
+            v = _ip6_addr_gen_mode_from_string(s);
+
+        if (v == -1) {
             if (!read_handle_warn(info,
                                   key,
                                   key,
@@ -1178,8 +1209,9 @@ ip6_addr_gen_mode_parser(KeyfileReaderInfo *info, NMSetting *setting, const char
                                   s,
                                   "eui64,stable-privacy"))
                 return;
-            addr_gen_mode = NM_SETTING_IP6_CONFIG_ADDR_GEN_MODE_DEFAULT_OR_EUI64;
+            v = NM_SETTING_IP6_CONFIG_ADDR_GEN_MODE_DEFAULT_OR_EUI64;
         }
+        addr_gen_mode = v;
     } else {
         gs_free char *s2 = NULL;
 
@@ -3360,17 +3392,8 @@ read_one_setting_value(KeyfileReaderInfo        *info,
      * encoded by the setting property, this won't be true.
      */
     if ((!pip || !pip->parser_no_check_key)
-        && !nm_keyfile_plugin_kf_has_key(keyfile, setting_info->setting_name, key, &err)) {
-        /* Key doesn't exist or an error occurred, thus nothing to do. */
-        if (err) {
-            if (!read_handle_warn(info,
-                                  key,
-                                  key,
-                                  NM_KEYFILE_WARN_SEVERITY_WARN,
-                                  _("error loading setting value: %s"),
-                                  err->message))
-                return;
-        }
+        && nm_strv_find_binary_search(info->group_keys, info->group_keys_len, key) < 0) {
+        /* Key doesn't exist, thus nothing to do. */
         return;
     }
 
@@ -3552,7 +3575,9 @@ static void
 _read_setting(KeyfileReaderInfo *info)
 {
     const NMSettInfoSetting   *sett_info;
-    gs_unref_object NMSetting *setting = NULL;
+    gs_unref_object NMSetting *setting    = NULL;
+    gs_strfreev char         **group_keys = NULL;
+    gsize                      group_keys_len;
     const char                *alias;
     GType                      type;
     guint16                    i;
@@ -3666,6 +3691,15 @@ _read_setting(KeyfileReaderInfo *info)
         }
     }
 
+    /* Fetch the group's keys once. The group is known to exist, so a failure
+     * here means it is empty, in which case there is nothing to read. */
+    group_keys = g_key_file_get_keys(info->keyfile, info->group, &group_keys_len, NULL);
+    if (!group_keys)
+        group_keys_len = 0;
+    nm_strv_sort(group_keys, group_keys_len);
+    info->group_keys     = (const char *const *) group_keys;
+    info->group_keys_len = group_keys_len;
+
     for (i = 0; i < sett_info->property_infos_len; i++) {
         read_one_setting_value(info, setting, &sett_info->property_infos[i]);
         if (info->error)
@@ -3673,7 +3707,9 @@ _read_setting(KeyfileReaderInfo *info)
     }
 
 out:
-    info->setting = NULL;
+    info->group_keys     = NULL;
+    info->group_keys_len = 0;
+    info->setting        = NULL;
     if (!info->error)
         nm_connection_add_setting(info->connection, g_steal_pointer(&setting));
 }
@@ -640,9 +640,7 @@ _cert_impl_get_key_format_from_bytes(GBytes *private_key)
 
     switch (_nm_setting_802_1x_cert_get_scheme(private_key, NULL)) {
     case NM_SETTING_802_1X_CK_SCHEME_BLOB:
-        if (nm_crypto_is_pkcs12_data(g_bytes_get_data(private_key, NULL),
-                                     g_bytes_get_size(private_key),
-                                     NULL))
+        if (nm_crypto_is_pkcs12_bytes(private_key))
             return NM_SETTING_802_1X_CK_FORMAT_PKCS12;
         return NM_SETTING_802_1X_CK_FORMAT_RAW_KEY;
     case NM_SETTING_802_1X_CK_SCHEME_PATH:
@@ -2585,11 +2583,7 @@ need_secrets_tls(NMSetting8021x *self,
                                       : nm_setting_802_1x_get_private_key_blob(self);
 
                 if (blob)
-                    format = nm_crypto_verify_private_key_data(g_bytes_get_data(blob, NULL),
-                                                               g_bytes_get_size(blob),
-                                                               password,
-                                                               NULL,
-                                                               NULL);
+                    format = nm_crypto_verify_private_key_bytes(blob, password, NULL);
             } else {
                 /* For PKCS#11 URLS, we assume the password is correct. */
                 has_password = TRUE;
@@ -2708,9 +2702,7 @@ verify_tls(NMSetting8021x *self, gboolean phase2, GError **error)
     }
 
     if (_nm_setting_802_1x_cert_get_scheme(private_key, NULL) == NM_SETTING_802_1X_CK_SCHEME_BLOB
-        && nm_crypto_is_pkcs12_data(g_bytes_get_data(private_key, NULL),
-                                    g_bytes_get_size(private_key),
-                                    NULL)) {
+        && nm_crypto_is_pkcs12_bytes(private_key)) {
         /* If the private key is PKCS#12, check that it matches the client cert */
         if (!g_bytes_equal(private_key, client_cert)) {
             g_set_error(error,
@@ -144,6 +144,9 @@ struct NMIPAddress {
     gint8  family;
     guint8 prefix;
 
+    /* @address is the canonical form of @address_bin. Both are kept in
+     * sync by the setters, so getters never need to parse the string. */
+    NMIPAddr    address_bin;
     char       *address;
     GHashTable *attributes;
 };
@@ -176,10 +179,11 @@ nm_ip_address_new(int family, const char *addr, guint prefix, GError **error)
 
     address  = g_slice_new(NMIPAddress);
     *address = (NMIPAddress){
-        .refcount = 1,
-        .family   = family,
-        .address  = canonicalize_ip_binary(family, &addr_bin, FALSE),
-        .prefix   = prefix,
+        .refcount    = 1,
+        .family      = family,
+        .address_bin = addr_bin,
+        .address     = canonicalize_ip_binary(family, &addr_bin, FALSE),
+        .prefix      = prefix,
     };
 
     return address;
@@ -216,6 +220,7 @@ nm_ip_address_new_binary(int family, gconstpointer addr, guint prefix, GError **
         .address  = nm_inet_ntop_dup(family, addr),
         .prefix   = prefix,
     };
+    nm_ip_addr_set(family, &address->address_bin, addr);
 
     return address;
 }
@@ -283,7 +288,7 @@ nm_ip_address_cmp_full(const NMIPAddress *a, const NMIPAddress *b, NMIPAddressCm
 
     NM_CMP_FIELD(a, b, family);
     NM_CMP_FIELD(a, b, prefix);
-    NM_CMP_FIELD_STR(a, b, address);
+    NM_CMP_RETURN(nm_ip_addr_cmp(a->family, &a->address_bin, &b->address_bin));
 
     if (NM_FLAGS_HAS(cmp_flags, NM_IP_ADDRESS_CMP_FLAGS_WITH_ATTRS)) {
         GHashTableIter iter;
@@ -427,6 +432,7 @@ nm_ip_address_set_address(NMIPAddress *address, const char *addr)
         nm_assert_not_reached();
     }
 
+    address->address_bin = addr_bin;
     g_free(address->address);
     address->address = canonicalize_ip_binary(address->family, &addr_bin, FALSE);
 }
@@ -446,7 +452,7 @@ nm_ip_address_get_address_binary(NMIPAddress *address, gpointer addr)
     g_return_if_fail(address != NULL);
     g_return_if_fail(addr != NULL);
 
-    inet_pton(address->family, address->address, addr);
+    nm_ip_addr_set(address->family, addr, &address->address_bin);
 }
 
 /**
@@ -464,6 +470,7 @@ nm_ip_address_set_address_binary(NMIPAddress *address, gconstpointer addr)
     g_return_if_fail(address != NULL);
     g_return_if_fail(addr != NULL);
 
+    nm_ip_addr_set(address->family, &address->address_bin, addr);
     g_free(address->address);
     address->address = nm_inet_ntop_dup(address->family, addr);
 }
@@ -591,6 +598,12 @@ struct NMIPRoute {
     gint8  family;
     guint8 prefix;
 
+    /* @dest and @next_hop are the canonical forms of @dest_bin and
+     * @next_hop_bin. @next_hop_bin is all-zero whenever @next_hop is
+     * %NULL. The setters keep them in sync, so getters never need to
+     * parse the strings. */
+    NMIPAddr    dest_bin;
+    NMIPAddr    next_hop_bin;
     char       *dest;
     char       *next_hop;
     GHashTable *attributes;
@@ -640,11 +653,14 @@ nm_ip_route_new(int         family,
     *route = (NMIPRoute){
         .refcount = 1,
         .family   = family,
+        .dest_bin = dest_bin,
         .dest     = canonicalize_ip_binary(family, &dest_bin, FALSE),
         .prefix   = prefix,
         .next_hop = canonicalize_ip_binary(family, next_hop ? &next_hop_bin : NULL, TRUE),
         .metric   = metric,
     };
+    if (route->next_hop)
+        route->next_hop_bin = next_hop_bin;
 
     return route;
 }
@@ -691,6 +707,9 @@ nm_ip_route_new_binary(int           family,
         .next_hop = canonicalize_ip_binary(family, next_hop, TRUE),
         .metric   = metric,
     };
+    nm_ip_addr_set(family, &route->dest_bin, dest);
+    if (route->next_hop)
+        nm_ip_addr_set(family, &route->next_hop_bin, next_hop);
 
     return route;
 }
@@ -762,8 +781,11 @@ nm_ip_route_equal_full(NMIPRoute *route, NMIPRoute *other, guint cmp_flags)
                          FALSE);
 
     if (route->prefix != other->prefix || route->metric != other->metric
-        || strcmp(route->dest, other->dest) != 0
-        || g_strcmp0(route->next_hop, other->next_hop) != 0)
+        || route->family != other->family
+        || !nm_ip_addr_equal(route->family, &route->dest_bin, &other->dest_bin)
+        || (!route->next_hop) != (!other->next_hop)
+        || (route->next_hop
+            && !nm_ip_addr_equal(route->family, &route->next_hop_bin, &other->next_hop_bin)))
         return FALSE;
     if (cmp_flags == NM_IP_ROUTE_EQUAL_CMP_FLAGS_WITH_ATTRS) {
         GHashTableIter iter;
@@ -902,6 +924,7 @@ nm_ip_route_set_dest(NMIPRoute *route, const char *dest)
         nm_assert_not_reached();
     }
 
+    route->dest_bin = dest_bin;
     g_free(route->dest);
     route->dest = canonicalize_ip_binary(route->family, &dest_bin, FALSE);
 }
@@ -921,7 +944,7 @@ nm_ip_route_get_dest_binary(NMIPRoute *route, gpointer dest)
     g_return_if_fail(route != NULL);
     g_return_if_fail(dest != NULL);
 
-    inet_pton(route->family, route->dest, dest);
+    nm_ip_addr_set(route->family, dest, &route->dest_bin);
 }
 
 /**
@@ -939,6 +962,7 @@ nm_ip_route_set_dest_binary(NMIPRoute *route, gconstpointer dest)
     g_return_if_fail(route != NULL);
     g_return_if_fail(dest != NULL);
 
+    nm_ip_addr_set(route->family, &route->dest_bin, dest);
     g_free(route->dest);
     route->dest = nm_inet_ntop_dup(route->family, dest);
 }
@@ -1019,6 +1043,10 @@ nm_ip_route_set_next_hop(NMIPRoute *route, const char *next_hop)
 
     g_free(route->next_hop);
     route->next_hop = canonicalize_ip_binary(route->family, next_hop ? &next_hop_bin : NULL, TRUE);
+    if (route->next_hop)
+        route->next_hop_bin = next_hop_bin;
+    else
+        route->next_hop_bin = nm_ip_addr_zero;
 }
 
 /**
@@ -1039,13 +1067,10 @@ nm_ip_route_get_next_hop_binary(NMIPRoute *route, gpointer next_hop)
     g_return_val_if_fail(route != NULL, FALSE);
     g_return_val_if_fail(next_hop != NULL, FALSE);
 
-    if (route->next_hop) {
-        inet_pton(route->family, route->next_hop, next_hop);
-        return TRUE;
-    } else {
-        memset(next_hop, 0, nm_utils_addr_family_to_size(route->family));
-        return FALSE;
-    }
+    /* @next_hop_bin is all-zero when there is no next hop, so the copy
+     * also covers the zeroing documented for that case. */
+    nm_ip_addr_set(route->family, next_hop, &route->next_hop_bin);
+    return route->next_hop != NULL;
 }
 
 /**
@@ -1065,6 +1090,10 @@ nm_ip_route_set_next_hop_binary(NMIPRoute *route, gconstpointer next_hop)
 
     g_free(route->next_hop);
     route->next_hop = canonicalize_ip_binary(route->family, next_hop, TRUE);
+    if (route->next_hop)
+        nm_ip_addr_set(route->family, &route->next_hop_bin, next_hop);
+    else
+        route->next_hop_bin = nm_ip_addr_zero;
 }
 
 /**
@@ -37,6 +37,18 @@ typedef struct {
 
     /* D-Bus path of the connection, if any */
     struct _NMRefString *path;
+
+    /* Cached result of the last _nm_connection_verify(). The cache is
+     * invalidated whenever the connection changes, relying on the same
+     * change notifications that back the NMConnection::changed signal. */
+    GError               *verify_error;
+    NMSettingVerifyResult verify_result;
+    bool                  verify_cached : 1;
+
+    /* Cached D-Bus serialization for _nm_connection_to_dbus_cached(), that
+     * is, for NM_CONNECTION_SERIALIZE_ALL with default options. Sunk, never
+     * floating. Invalidated together with the verify cache. */
+    GVariant *dbus_cached;
 } NMConnectionPrivate;
 
 extern GTypeClass *_nm_simple_connection_class_instance;
@@ -2109,6 +2109,9 @@ _property_set_from_dbus(const NMSettInfoSetting  *sett_info,
         return TRUE;
     }
 
+    /* The expected type comes precompiled from the static NMSettInfoSetting
+     * property tables (NM_G_VARIANT_TYPE()), so the check below involves no
+     * per-property type string parsing or validation. */
     if (property_info->property_type->from_dbus_is_full) {
         /* These hooks perform their own type checking, and can coerce/ignore
          * a value regardless of the D-Bus type. */
@@ -2897,6 +2900,11 @@ _nm_setting_compare(NMConnection         *con_a,
     nm_assert(!con_a || NM_IS_CONNECTION(con_a));
     nm_assert(!con_b || NM_IS_CONNECTION(con_b));
 
+    /* All compare functions are reflexive, so a setting always compares
+     * equal to itself, regardless of the flags. */
+    if (a == b)
+        return TRUE;
+
     /* First check that both have the same type */
     if (G_OBJECT_TYPE(a) != G_OBJECT_TYPE(b))
         return FALSE;
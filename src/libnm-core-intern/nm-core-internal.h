@@ -280,6 +280,8 @@ typedef enum {
 
 NMSettingVerifyResult _nm_connection_verify(NMConnection *connection, GError **error);
 
+GVariant *_nm_connection_to_dbus_cached(NMConnection *connection);
+
 gboolean _nm_connection_ensure_normalized(NMConnection  *connection,
                                           gboolean       allow_modify,
                                           const char    *expected_uuid,
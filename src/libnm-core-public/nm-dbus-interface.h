@@ -1189,6 +1189,12 @@ typedef enum /*< flags >*/ {
  *   properties take effect immediately. Specify this flag to prevent these
  *   properties to take effect, so that the change is restricted to modify
  *   the profile. Since: 1.20.
+ * @NM_SETTINGS_UPDATE2_FLAG_PARTIAL: the provided settings dictionary is
+ *   partial: settings that are present replace the corresponding setting of
+ *   the profile entirely, settings that are absent keep their current
+ *   content. This avoids transmitting the full profile for localized
+ *   changes. Note that a setting cannot be removed this way; removing a
+ *   setting requires a full update. Since: 1.48.
  *
  * Since: 1.12
  */
@@ -1201,6 +1207,7 @@ typedef enum /*< flags >*/ {
     NM_SETTINGS_UPDATE2_FLAG_VOLATILE           = 0x10,
     NM_SETTINGS_UPDATE2_FLAG_BLOCK_AUTOCONNECT  = 0x20,
     NM_SETTINGS_UPDATE2_FLAG_NO_REAPPLY         = 0x40,
+    NM_SETTINGS_UPDATE2_FLAG_PARTIAL            = 0x80,
 } NMSettingsUpdate2Flags;
 
 /**
@@ -889,6 +889,196 @@ nm_crypto_verify_private_key(const char *filename,
                                              error);
 }
 
+/*****************************************************************************/
+
+/* A small cache of verification results for in-memory certificates and
+ * keys. Recognizing a PKCS#12 blob or checking a private key password
+ * requires a full DER parse (and for encrypted keys a decryption attempt),
+ * which profile verification, need-secrets handling and supplicant config
+ * building repeat on the same unchanged blobs on every (re)connect.
+ *
+ * Entries are matched by blob content and password, so false sharing is
+ * impossible. The cache keeps a reference to the GBytes and a copy of the
+ * password; both already live unencrypted in the corresponding setting,
+ * so this does not weaken secret handling. */
+
+typedef enum {
+    VERIFY_CACHE_OP_IS_PKCS12,
+    VERIFY_CACHE_OP_PRIVATE_KEY,
+} VerifyCacheOp;
+
+typedef struct {
+    GBytes            *data;
+    char              *password;
+    guint64            age;
+    NMCryptoFileFormat format;
+    VerifyCacheOp      op;
+    bool               is_pkcs12;
+    bool               is_encrypted;
+} VerifyCacheEntry;
+
+#define VERIFY_CACHE_SIZE 8u
+
+static VerifyCacheEntry verify_cache[VERIFY_CACHE_SIZE];
+static guint64          verify_cache_age;
+
+G_LOCK_DEFINE_STATIC(verify_cache_lock);
+
+static const VerifyCacheEntry *
+_verify_cache_lookup(VerifyCacheOp op, GBytes *data, const char *password)
+{
+    guint i;
+
+    for (i = 0; i < VERIFY_CACHE_SIZE; i++) {
+        VerifyCacheEntry *entry = &verify_cache[i];
+
+        if (!entry->data || entry->op != op)
+            continue;
+        if (entry->data != data && !g_bytes_equal(entry->data, data))
+            continue;
+        if (!nm_streq0(entry->password, password))
+            continue;
+        entry->age = ++verify_cache_age;
+        return entry;
+    }
+    return NULL;
+}
+
+static void
+_verify_cache_insert(VerifyCacheOp      op,
+                     GBytes            *data,
+                     const char        *password,
+                     NMCryptoFileFormat format,
+                     gboolean           is_pkcs12,
+                     gboolean           is_encrypted)
+{
+    VerifyCacheEntry *entry = &verify_cache[0];
+    guint             i;
+
+    /* Replace the least recently used entry. Unused entries have age
+     * zero and are picked up first. */
+    for (i = 1; i < VERIFY_CACHE_SIZE; i++) {
+        if (verify_cache[i].age < entry->age)
+            entry = &verify_cache[i];
+    }
+
+    nm_clear_pointer(&entry->data, g_bytes_unref);
+    nm_clear_pointer(&entry->password, nm_free_secret);
+
+    *entry = (VerifyCacheEntry){
+        .data         = g_bytes_ref(data),
+        .password     = g_strdup(password),
+        .age          = ++verify_cache_age,
+        .format       = format,
+        .op           = op,
+        .is_pkcs12    = is_pkcs12,
+        .is_encrypted = is_encrypted,
+    };
+}
+
+/**
+ * nm_crypto_is_pkcs12_bytes:
+ * @data: the certificate or key data
+ *
+ * Like nm_crypto_is_pkcs12_data(), but takes a #GBytes and caches the
+ * result, keyed by the blob's content. Use this variant on hot paths
+ * that repeatedly check the same in-memory blob and don't care about
+ * the error reason.
+ *
+ * Returns: %TRUE if @data looks like PKCS#12.
+ */
+gboolean
+nm_crypto_is_pkcs12_bytes(GBytes *data)
+{
+    const VerifyCacheEntry *entry;
+    gboolean                is_pkcs12 = FALSE;
+    gboolean                found     = FALSE;
+
+    g_return_val_if_fail(data, FALSE);
+
+    G_LOCK(verify_cache_lock);
+    entry = _verify_cache_lookup(VERIFY_CACHE_OP_IS_PKCS12, data, NULL);
+    if (entry) {
+        is_pkcs12 = entry->is_pkcs12;
+        found     = TRUE;
+    }
+    G_UNLOCK(verify_cache_lock);
+
+    if (found)
+        return is_pkcs12;
+
+    is_pkcs12 =
+        nm_crypto_is_pkcs12_data(g_bytes_get_data(data, NULL), g_bytes_get_size(data), NULL);
+
+    G_LOCK(verify_cache_lock);
+    _verify_cache_insert(VERIFY_CACHE_OP_IS_PKCS12,
+                         data,
+                         NULL,
+                         NM_CRYPTO_FILE_FORMAT_UNKNOWN,
+                         is_pkcs12,
+                         FALSE);
+    G_UNLOCK(verify_cache_lock);
+
+    return is_pkcs12;
+}
+
+/**
+ * nm_crypto_verify_private_key_bytes:
+ * @data: the private key data
+ * @password: (nullable): the password to check, or %NULL to only detect
+ *   the format
+ * @out_is_encrypted: (out) (optional): whether the key is encrypted
+ *
+ * Like nm_crypto_verify_private_key_data(), but takes a #GBytes and
+ * caches the result, keyed by the blob's content and the password.
+ *
+ * Returns: the detected key format, or %NM_CRYPTO_FILE_FORMAT_UNKNOWN.
+ */
+NMCryptoFileFormat
+nm_crypto_verify_private_key_bytes(GBytes *data, const char *password, gboolean *out_is_encrypted)
+{
+    const VerifyCacheEntry *entry;
+    NMCryptoFileFormat      format       = NM_CRYPTO_FILE_FORMAT_UNKNOWN;
+    gboolean                is_encrypted = FALSE;
+    gboolean                found        = FALSE;
+
+    g_return_val_if_fail(data, NM_CRYPTO_FILE_FORMAT_UNKNOWN);
+    g_return_val_if_fail(out_is_encrypted == NULL || *out_is_encrypted == FALSE,
+                         NM_CRYPTO_FILE_FORMAT_UNKNOWN);
+
+    G_LOCK(verify_cache_lock);
+    entry = _verify_cache_lookup(VERIFY_CACHE_OP_PRIVATE_KEY, data, password);
+    if (entry) {
+        format       = entry->format;
+        is_encrypted = entry->is_encrypted;
+        found        = TRUE;
+    }
+    G_UNLOCK(verify_cache_lock);
+
+    if (!found) {
+        format = nm_crypto_verify_private_key_data(g_bytes_get_data(data, NULL),
+                                                   g_bytes_get_size(data),
+                                                   password,
+                                                   &is_encrypted,
+                                                   NULL);
+
+        G_LOCK(verify_cache_lock);
+        _verify_cache_insert(VERIFY_CACHE_OP_PRIVATE_KEY,
+                             data,
+                             password,
+                             format,
+                             FALSE,
+                             is_encrypted);
+        G_UNLOCK(verify_cache_lock);
+    }
+
+    if (out_is_encrypted)
+        *out_is_encrypted = is_encrypted;
+    return format;
+}
+
+/*****************************************************************************/
+
 gboolean
 nm_crypto_randomize(void *buffer, gsize buffer_len, GError **error)
 {
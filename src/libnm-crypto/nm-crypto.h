@@ -53,12 +53,17 @@ gboolean nm_crypto_is_pkcs12_file(const char *file, GError **error);
 
 gboolean nm_crypto_is_pkcs12_data(const guint8 *data, gsize len, GError **error);
 
+gboolean nm_crypto_is_pkcs12_bytes(GBytes *data);
+
 NMCryptoFileFormat nm_crypto_verify_private_key_data(const guint8 *data,
                                                      gsize         data_len,
                                                      const char   *password,
                                                      gboolean     *out_is_encrypted,
                                                      GError      **error);
 
+NMCryptoFileFormat
+nm_crypto_verify_private_key_bytes(GBytes *data, const char *password, gboolean *out_is_encrypted);
+
 NMCryptoFileFormat nm_crypto_verify_private_key(const char *file,
                                                 const char *password,
                                                 gboolean   *out_is_encrypted,
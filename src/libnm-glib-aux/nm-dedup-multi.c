@@ -76,6 +76,14 @@ _entry_lookup_obj(const NMDedupMultiIndex   *self,
     };
 
     ASSERT_idx_type(idx_type);
+
+    /* an idx-type without head entries has no entries at all. Short-circuit
+     * such guaranteed misses before hashing @obj and probing the table. */
+    if (c_list_is_empty(&idx_type->lst_idx_head)) {
+        nm_assert(!g_hash_table_lookup(self->idx_entries, &stack_entry));
+        return NULL;
+    }
+
     return g_hash_table_lookup(self->idx_entries, &stack_entry);
 }
 
@@ -93,13 +101,14 @@ _entry_lookup_head(const NMDedupMultiIndex   *self,
 
     ASSERT_idx_type(idx_type);
 
+    if (c_list_is_empty(&idx_type->lst_idx_head)) {
+        nm_assert(!g_hash_table_lookup(self->idx_entries, &stack_entry));
+        return NULL;
+    }
+
     if (!idx_type->klass->idx_obj_partition_equal) {
-        if (c_list_is_empty(&idx_type->lst_idx_head))
-            head_entry = NULL;
-        else {
-            nm_assert(c_list_length_is(&idx_type->lst_idx_head, 1));
-            head_entry = c_list_entry(idx_type->lst_idx_head.next, NMDedupMultiHeadEntry, lst_idx);
-        }
+        nm_assert(c_list_length_is(&idx_type->lst_idx_head, 1));
+        head_entry = c_list_entry(idx_type->lst_idx_head.next, NMDedupMultiHeadEntry, lst_idx);
         nm_assert(head_entry == g_hash_table_lookup(self->idx_entries, &stack_entry));
         return head_entry;
     }
@@ -551,6 +560,71 @@ _remove_head(NMDedupMultiIndex     *self,
     return n;
 }
 
+static gboolean
+_remove_idx_entry_all_pred(gpointer key, gpointer value, gpointer user_data)
+{
+    const NMDedupMultiIdxType *idx_type = user_data;
+    const NMDedupMultiEntry   *entry    = key;
+
+    if (entry->is_head)
+        return ((const NMDedupMultiHeadEntry *) key)->idx_type == idx_type;
+    return entry->head->idx_type == idx_type;
+}
+
+static guint
+_remove_idx_entry_all(NMDedupMultiIndex *self, NMDedupMultiIdxType *idx_type)
+{
+    guint  n;
+    guint  n_heads;
+    guint  n_removed;
+    CList *iter_idx, *iter_idx_safe;
+
+    nm_assert(self);
+    ASSERT_idx_type(idx_type);
+
+    /* drop all entries and head entries of @idx_type from the table in one
+     * scan. Removing them one by one would re-hash the object id of every
+     * entry, which dominates the cost of a bulk removal. The table has no
+     * destroy notifiers, the entries stay owned by us and get released
+     * while walking the lists below. */
+    n_removed = g_hash_table_foreach_remove(self->idx_entries, _remove_idx_entry_all_pred, idx_type);
+
+    n       = 0;
+    n_heads = 0;
+    c_list_for_each_safe (iter_idx, iter_idx_safe, &idx_type->lst_idx_head) {
+        NMDedupMultiHeadEntry *head_entry;
+        CList                 *iter_entry, *iter_entry_safe;
+
+        head_entry = c_list_entry(iter_idx, NMDedupMultiHeadEntry, lst_idx);
+
+        c_list_for_each_safe (iter_entry, iter_entry_safe, &head_entry->lst_entries_head) {
+            NMDedupMultiEntry     *entry;
+            const NMDedupMultiObj *obj;
+
+            entry = c_list_entry(iter_entry, NMDedupMultiEntry, lst_entries);
+            obj   = entry->obj;
+
+            if (--head_entry->len > 0)
+                idx_type->len--;
+
+            c_list_unlink_stale(&entry->lst_entries);
+            g_slice_free(NMDedupMultiEntry, entry);
+            nm_dedup_multi_obj_unref(obj);
+            n++;
+        }
+
+        nm_assert(head_entry->len == 0);
+        c_list_unlink_stale(&head_entry->lst_idx);
+        g_slice_free(NMDedupMultiHeadEntry, head_entry);
+        n_heads++;
+    }
+
+    nm_assert(c_list_is_empty(&idx_type->lst_idx_head));
+    nm_assert(n_removed == n + n_heads);
+
+    return n;
+}
+
 static guint
 _remove_idx_entry(NMDedupMultiIndex   *self,
                   NMDedupMultiIdxType *idx_type,
@@ -563,6 +637,14 @@ _remove_idx_entry(NMDedupMultiIndex   *self,
     nm_assert(self);
     ASSERT_idx_type(idx_type);
 
+    /* when dropping the entire idx-type and it makes up a sizable part of
+     * the table, a single table scan beats per-entry removal (which hashes
+     * every object id again). Otherwise, scanning unrelated entries of the
+     * shared index would be wasted work. */
+    if (remove_all && !mark_survivors_dirty && idx_type->len > 0
+        && idx_type->len >= g_hash_table_size(self->idx_entries) / 2u)
+        return _remove_idx_entry_all(self, idx_type);
+
     n = 0;
     c_list_for_each_safe (iter_idx, iter_idx_safe, &idx_type->lst_idx_head) {
         n += _remove_head(self,
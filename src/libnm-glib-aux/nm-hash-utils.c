@@ -7,6 +7,7 @@
 
 #include "nm-hash-utils.h"
 
+#include <endian.h>
 #include <stdint.h>
 
 #include "nm-shared-utils.h"
@@ -21,6 +22,12 @@ G_STATIC_ASSERT(sizeof(guint) * HASH_KEY_SIZE_GUINT >= HASH_KEY_SIZE);
 
 static const guint8 *volatile global_seed = NULL;
 
+/* the expanded siphash state for "global_seed" (and a zero static-seed). It is
+ * initialized (once) together with "global_seed" and published by the same
+ * atomic pointer. Keeping the expanded state around allows nm_hash_siphash42_init()
+ * to skip re-expanding the 16 byte key for every single hash operation. */
+static CSipHash global_seed_state;
+
 static const guint8 *
 _get_hash_key_init(void)
 {
@@ -69,6 +76,7 @@ again:
 
         memcpy(g_arr.v8, t_arr.v8, HASH_KEY_SIZE);
         g = g_arr.v8;
+        c_siphash_init(&global_seed_state, g);
         g_atomic_pointer_set(&global_seed, g);
         g_once_init_leave(&g_lock, 1);
     }
@@ -112,18 +120,34 @@ nm_hash_static(guint static_seed)
 void
 nm_hash_siphash42_init(CSipHash *h, guint static_seed)
 {
-    const guint8 *g;
     union {
-        guint64 _align_as_uint64;
-        guint   arr[HASH_KEY_SIZE_GUINT];
-    } seed;
+        guint64 u64;
+        guint   arr[sizeof(guint64) / sizeof(guint)];
+    } t = {
+        .u64 = 0,
+    };
+    guint64 d;
 
     nm_assert(h);
 
-    g = _get_hash_key();
-    memcpy(&seed, g, HASH_KEY_SIZE);
-    seed.arr[0] ^= static_seed;
-    c_siphash_init(h, (const guint8 *) &seed);
+    /* ensure that "global_seed_state" is initialized. */
+    (void) _get_hash_key();
+
+    /* this is equivalent to copying the 16 byte key, xoring @static_seed
+     * into the first guint of the key and calling c_siphash_init(). The key
+     * expansion of c_siphash_init() xors the first 8 bytes of the key
+     * (interpreted as little endian) into "v0" and "v2", hence xoring
+     * @static_seed into the key is the same as xoring the delta below into
+     * the pre-expanded state. Starting from the cached state avoids the
+     * copy and re-expansion of the key on every hash operation, which is
+     * the dominating per-call cost for the small fixed-size keys that
+     * nm_hash_update_vals() users hash. */
+    *h = global_seed_state;
+
+    t.arr[0] = static_seed;
+    d = le64toh(t.u64);
+    h->v0 ^= d;
+    h->v2 ^= d;
 }
 
 guint
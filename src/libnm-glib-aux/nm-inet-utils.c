@@ -8,6 +8,8 @@
 #include <arpa/inet.h>
 #include <dlfcn.h>
 
+#include "libnm-std-aux/unaligned.h"
+
 /*****************************************************************************/
 
 const NMIPAddr nm_ip_addr_zero = {};
@@ -243,25 +245,43 @@ nm_ip6_addr_same_prefix_cmp(const struct in6_addr *addr_a,
                             const struct in6_addr *addr_b,
                             guint32                plen)
 {
-    int    nbytes;
-    guint8 va, vb, m;
+    guint64 va, vb, m;
+
+    /* Compare the addresses as two 64 bit words in big endian order. That
+     * gives the same (lexicographic) order as a bytewise memcmp(), but the
+     * prefix can be honored with one shift-derived mask instead of a
+     * variable-length memcmp() plus per-bit fixup. This function sits in the
+     * innermost loop of sorting/deduplicating large IPv6 address and route
+     * sets, where the difference is measurable. */
 
     if (plen >= 128) {
         nm_assert(plen == 128);
-        NM_CMP_DIRECT_MEMCMP(addr_a, addr_b, sizeof(struct in6_addr));
+        va = unaligned_read_be64(&addr_a->s6_addr[0]);
+        vb = unaligned_read_be64(&addr_b->s6_addr[0]);
+        NM_CMP_DIRECT(va, vb);
+        va = unaligned_read_be64(&addr_a->s6_addr[8]);
+        vb = unaligned_read_be64(&addr_b->s6_addr[8]);
+        NM_CMP_DIRECT(va, vb);
+        return 0;
+    }
+
+    if (plen == 0)
+        return 0;
+
+    if (plen > 64) {
+        va = unaligned_read_be64(&addr_a->s6_addr[0]);
+        vb = unaligned_read_be64(&addr_b->s6_addr[0]);
+        NM_CMP_DIRECT(va, vb);
+        va = unaligned_read_be64(&addr_a->s6_addr[8]);
+        vb = unaligned_read_be64(&addr_b->s6_addr[8]);
+        plen -= 64;
     } else {
-        nbytes = plen / 8;
-        if (nbytes)
-            NM_CMP_DIRECT_MEMCMP(addr_a, addr_b, nbytes);
-
-        plen = plen % 8;
-        if (plen != 0) {
-            m  = ~((1 << (8 - plen)) - 1);
-            va = ((((const guint8 *) addr_a))[nbytes]) & m;
-            vb = ((((const guint8 *) addr_b))[nbytes]) & m;
-            NM_CMP_DIRECT(va, vb);
-        }
+        va = unaligned_read_be64(&addr_a->s6_addr[0]);
+        vb = unaligned_read_be64(&addr_b->s6_addr[0]);
     }
+
+    m = ~G_GUINT64_CONSTANT(0) << (64u - plen);
+    NM_CMP_DIRECT(va & m, vb & m);
     return 0;
 }
 
@@ -0,0 +1,44 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+
+#include "libnm-glib-aux/nm-default-glib-i18n-lib.h"
+
+#include "nm-perf-counter.h"
+
+/*****************************************************************************/
+
+G_LOCK_DEFINE_STATIC(gl_lock);
+static NMPerfCounter *gl_head;
+
+/*****************************************************************************/
+
+void
+_nm_perf_counter_register(NMPerfCounter *counter)
+{
+    nm_assert(counter);
+    nm_assert(counter->name);
+
+    G_LOCK(gl_lock);
+    if (!counter->_priv_registered) {
+        counter->_priv_next = gl_head;
+        gl_head             = counter;
+
+        /* set last. nm_perf_counter_add() checks this flag without the
+         * lock; only the registering (owner) thread increments, so it
+         * observes its own write in order. */
+        counter->_priv_registered = TRUE;
+    }
+    G_UNLOCK(gl_lock);
+}
+
+void
+nm_perf_counter_foreach(NMPerfCounterForeachFunc func, gpointer user_data)
+{
+    NMPerfCounter *counter;
+
+    g_return_if_fail(func);
+
+    G_LOCK(gl_lock);
+    for (counter = gl_head; counter; counter = counter->_priv_next)
+        func(counter->name, counter->count, user_data);
+    G_UNLOCK(gl_lock);
+}
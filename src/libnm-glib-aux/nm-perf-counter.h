@@ -0,0 +1,52 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+
+#ifndef __NM_PERF_COUNTER_H__
+#define __NM_PERF_COUNTER_H__
+
+/*****************************************************************************/
+
+/* A minimal facility for always-on performance counters.
+ *
+ * A counter is a statically allocated NMPerfCounter, defined with
+ * NM_PERF_COUNTER_DEFINE() in the translation unit that increments it.
+ * Incrementing is a plain (non-atomic) 64 bit add; a counter must only
+ * ever be incremented from one thread (in practice: the main thread).
+ * The first increment registers the counter in a global list, from which
+ * nm_perf_counter_foreach() can enumerate all counters that were touched
+ * so far, for dumping diagnostics.
+ *
+ * The values are for diagnostics only. Reading them from another thread
+ * via nm_perf_counter_foreach() is permissible but the reads are not
+ * synchronized with the increments. */
+
+typedef struct _NMPerfCounter {
+    const char *name;
+    guint64     count;
+
+    /* private to nm-perf-counter.c. */
+    struct _NMPerfCounter *_priv_next;
+    bool                   _priv_registered;
+} NMPerfCounter;
+
+#define NM_PERF_COUNTER_DEFINE(tag, counter_name) \
+    static NMPerfCounter tag = {                  \
+        .name = ("" counter_name ""),             \
+    }
+
+void _nm_perf_counter_register(NMPerfCounter *counter);
+
+static inline void
+nm_perf_counter_add(NMPerfCounter *counter, guint64 n)
+{
+    if (G_UNLIKELY(!counter->_priv_registered))
+        _nm_perf_counter_register(counter);
+    counter->count += n;
+}
+
+#define NM_PERF_COUNTER_INC(tag) nm_perf_counter_add(&(tag), 1)
+
+typedef void (*NMPerfCounterForeachFunc)(const char *name, guint64 count, gpointer user_data);
+
+void nm_perf_counter_foreach(NMPerfCounterForeachFunc func, gpointer user_data);
+
+#endif /* __NM_PERF_COUNTER_H__ */
@@ -0,0 +1,101 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+
+#include "libnm-glib-aux/nm-default-glib-i18n-lib.h"
+
+#include "nm-perf-trace.h"
+
+#include "nm-time-utils.h"
+
+/*****************************************************************************/
+
+typedef struct {
+    gint64  timestamp_nsec;
+    guint64 arg;
+    guint16 event_type;
+    char    detail[46];
+} TraceRecord;
+
+G_STATIC_ASSERT(sizeof(TraceRecord) == 64);
+
+/* the ring keeps the most recent ~16k events (1 MiB). Allocated on first
+ * enable, so a daemon that never enables tracing pays nothing. */
+#define TRACE_RING_LEN ((guint64) (16 * 1024))
+
+gboolean _nm_perf_trace_enabled = FALSE;
+
+static TraceRecord *gl_ring;
+static guint64      gl_seq;
+
+/*****************************************************************************/
+
+static const char *
+_event_to_string(NMPerfTraceEvent event_type)
+{
+    switch (event_type) {
+    case NM_PERF_TRACE_EVENT_RTNL_EVENT:
+        return "rtnl-event";
+    case NM_PERF_TRACE_EVENT_L3CFG_COMMIT:
+        return "l3cfg-commit";
+    case NM_PERF_TRACE_EVENT_DBUS_PROPS_CHANGED:
+        return "dbus-props-changed";
+    case NM_PERF_TRACE_EVENT_DBUS_SIGNAL:
+        return "dbus-signal";
+    }
+    return "unknown";
+}
+
+void
+nm_perf_trace_enable(void)
+{
+    if (_nm_perf_trace_enabled)
+        return;
+
+    gl_ring = g_new0(TraceRecord, TRACE_RING_LEN);
+
+    /* set last; the recording (main) thread checks the flag without a
+     * lock and must not observe it before the ring exists. */
+    _nm_perf_trace_enabled = TRUE;
+}
+
+void
+_nm_perf_trace_record(NMPerfTraceEvent event_type, guint64 arg, const char *detail)
+{
+    TraceRecord *rec;
+
+    nm_assert(_nm_perf_trace_enabled);
+    nm_assert(gl_ring);
+
+    rec  = &gl_ring[gl_seq++ % TRACE_RING_LEN];
+    *rec = (TraceRecord){
+        .timestamp_nsec = nm_utils_get_monotonic_timestamp_nsec(),
+        .arg            = arg,
+        .event_type     = event_type,
+    };
+    if (detail)
+        g_strlcpy(rec->detail, detail, sizeof(rec->detail));
+}
+
+void
+nm_perf_trace_dump(NMPerfTraceDumpFunc func, gpointer user_data)
+{
+    guint64 seq;
+
+    g_return_if_fail(func);
+
+    if (!_nm_perf_trace_enabled)
+        return;
+
+    /* oldest first. Records before (gl_seq - TRACE_RING_LEN) were
+     * overwritten. */
+    seq = gl_seq > TRACE_RING_LEN ? gl_seq - TRACE_RING_LEN : 0;
+    for (; seq < gl_seq; seq++) {
+        const TraceRecord *rec = &gl_ring[seq % TRACE_RING_LEN];
+
+        func(seq,
+             rec->timestamp_nsec,
+             _event_to_string(rec->event_type),
+             rec->arg,
+             rec->detail[0] ? rec->detail : NULL,
+             user_data);
+    }
+}
@@ -0,0 +1,53 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+
+#ifndef __NM_PERF_TRACE_H__
+#define __NM_PERF_TRACE_H__
+
+/*****************************************************************************/
+
+/* A companion to nm-perf-counter.h: where the counters say how often a hot
+ * path ran, the trace ring says in which order, so that a netlink event can
+ * be correlated with the commits and D-Bus emissions it triggered.
+ *
+ * Tracing records fixed-size events in a preallocated in-process ring
+ * buffer. It is disabled by default; nm_perf_trace() then costs a single
+ * predictable branch. When enabled (once, at startup), recording an event
+ * takes a timestamp and copies at most one cache line; the ring wraps and
+ * keeps the most recent events. Like the counters, recording must only
+ * happen from one thread (in practice: the main thread), and the dump is
+ * a diagnostic, not a stable interface. */
+
+typedef enum {
+    NM_PERF_TRACE_EVENT_RTNL_EVENT = 1,
+    NM_PERF_TRACE_EVENT_L3CFG_COMMIT,
+    NM_PERF_TRACE_EVENT_DBUS_PROPS_CHANGED,
+    NM_PERF_TRACE_EVENT_DBUS_SIGNAL,
+} NMPerfTraceEvent;
+
+extern gboolean _nm_perf_trace_enabled;
+
+void _nm_perf_trace_record(NMPerfTraceEvent event_type, guint64 arg, const char *detail);
+
+/* @arg is an event-specific number (netlink sequence number, ifindex, ...),
+ * @detail an optional short string (it gets truncated to fit the record).
+ * Callers may pass a @detail that is only cheap to compute when tracing is
+ * on, by building it after checking _nm_perf_trace_enabled themselves. */
+static inline void
+nm_perf_trace(NMPerfTraceEvent event_type, guint64 arg, const char *detail)
+{
+    if (G_UNLIKELY(_nm_perf_trace_enabled))
+        _nm_perf_trace_record(event_type, arg, detail);
+}
+
+void nm_perf_trace_enable(void);
+
+typedef void (*NMPerfTraceDumpFunc)(guint64     seq,
+                                    gint64      timestamp_nsec,
+                                    const char *event_name,
+                                    guint64     arg,
+                                    const char *detail,
+                                    gpointer    user_data);
+
+void nm_perf_trace_dump(NMPerfTraceDumpFunc func, gpointer user_data);
+
+#endif /* __NM_PERF_TRACE_H__ */
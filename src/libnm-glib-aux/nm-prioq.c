@@ -111,65 +111,68 @@ nm_prioq_destroy(NMPrioq *q)
 /*****************************************************************************/
 
 static int
-compare(NMPrioq *q, unsigned a, unsigned b)
+compare_items(NMPrioq *q, const PrioqItem *a, const PrioqItem *b)
 {
     _nm_assert_q(q);
     nm_assert(a != b);
-    nm_assert(a < q->_priv.n_items);
-    nm_assert(b < q->_priv.n_items);
 
-    if (q->_priv.compare_with_data) {
-        return q->_priv.compare_data_func(q->_priv.items[a].data,
-                                          q->_priv.items[b].data,
-                                          q->_priv.compare_data);
-    }
+    if (q->_priv.compare_with_data)
+        return q->_priv.compare_data_func(a->data, b->data, q->_priv.compare_data);
 
-    return q->_priv.compare_func(q->_priv.items[a].data, q->_priv.items[b].data);
+    return q->_priv.compare_func(a->data, b->data);
 }
 
 static void
-swap(NMPrioq *q, unsigned j, unsigned k)
+place_item(NMPrioq *q, unsigned idx, const PrioqItem *item)
 {
-    _nm_assert_q(q);
-    nm_assert(j < q->_priv.n_items);
-    nm_assert(k < q->_priv.n_items);
-    nm_assert(!q->_priv.items[j].idx || *(q->_priv.items[j].idx) == j);
-    nm_assert(!q->_priv.items[k].idx || *(q->_priv.items[k].idx) == k);
-
-    NM_SWAP(&q->_priv.items[j], &q->_priv.items[k]);
-
-    if (q->_priv.items[j].idx)
-        *q->_priv.items[j].idx = j;
+    nm_assert(idx < q->_priv.n_items);
 
-    if (q->_priv.items[k].idx)
-        *q->_priv.items[k].idx = k;
+    q->_priv.items[idx] = *item;
+    if (item->idx)
+        *item->idx = idx;
 }
 
+/* The shuffle functions sift with a hole: the moving item is kept aside and
+ * the displaced entries only move down/up one slot each, instead of doing a
+ * full swap (two entry writes plus two back-reference updates) per level. */
+
 static unsigned
 shuffle_up(NMPrioq *q, unsigned idx)
 {
+    PrioqItem item;
+
     _nm_assert_q(q);
     nm_assert(idx < q->_priv.n_items);
 
+    item = q->_priv.items[idx];
+
     while (idx > 0) {
         unsigned k;
 
         k = (idx - 1) / 2;
 
-        if (compare(q, k, idx) <= 0)
+        nm_assert(!q->_priv.items[k].idx || *(q->_priv.items[k].idx) == k);
+
+        if (compare_items(q, &q->_priv.items[k], &item) <= 0)
             break;
 
-        swap(q, idx, k);
+        place_item(q, idx, &q->_priv.items[k]);
         idx = k;
     }
 
+    place_item(q, idx, &item);
     return idx;
 }
 
 static unsigned
 shuffle_down(NMPrioq *q, unsigned idx)
 {
+    PrioqItem item;
+
     _nm_assert_q(q);
+    nm_assert(idx < q->_priv.n_items);
+
+    item = q->_priv.items[idx];
 
     for (;;) {
         unsigned j;
@@ -182,29 +185,25 @@ shuffle_down(NMPrioq *q, unsigned idx)
         if (j >= q->_priv.n_items)
             break;
 
-        if (compare(q, j, idx) < 0) {
-            /* So our left child is smaller than we are, let's
-             * remember this fact */
-            s = j;
-        } else
-            s = idx;
-
-        if ((k < q->_priv.n_items) && compare(q, k, s) < 0) {
-            /* So our right child is smaller than we are, let's
-             * remember this fact */
+        /* s points to the smaller of the two children (or the left one,
+         * if there is no right child). */
+        if (k < q->_priv.n_items
+            && compare_items(q, &q->_priv.items[k], &q->_priv.items[j]) < 0)
             s = k;
-        }
+        else
+            s = j;
 
-        /* s now points to the smallest of the three items */
+        nm_assert(!q->_priv.items[s].idx || *(q->_priv.items[s].idx) == s);
 
-        if (s == idx)
-            /* No swap necessary, we're done */
+        if (compare_items(q, &q->_priv.items[s], &item) >= 0)
+            /* Neither child is smaller than our item, we're done. */
             break;
 
-        swap(q, idx, s);
+        place_item(q, idx, &q->_priv.items[s]);
         idx = s;
     }
 
+    place_item(q, idx, &item);
     return idx;
 }
 
@@ -23,14 +23,22 @@ _ref_string_get(const NMRefString *rstr, const char **out_str, gsize *out_len)
     }
 }
 
+static guint
+_ref_string_compute_hash(const char *cstr, gsize len)
+{
+    return nm_hash_mem(1463435489u, cstr, len);
+}
+
 static guint
 _ref_string_hash(gconstpointer ptr)
 {
-    const char *cstr;
-    gsize       len;
+    const NMRefString *rstr = ptr;
 
-    _ref_string_get(ptr, &cstr, &len);
-    return nm_hash_mem(1463435489u, cstr, len);
+    /* The content hash is computed once (outside the lock) and cached, so
+     * that insertion and removal don't re-hash the string. */
+    if (rstr->len == G_MAXSIZE)
+        return rstr->_priv_lookup.l_hash;
+    return rstr->_priv_hash;
 }
 
 static gboolean
@@ -69,6 +77,8 @@ _nm_assert_nm_ref_string(NMRefString *rstr)
     nm_assert(rstr->str[rstr->len] == '\0');
 
     if (NM_MORE_ASSERTS > 10) {
+        nm_assert(rstr->_priv_hash == _ref_string_compute_hash(rstr->str, rstr->len));
+
         G_LOCK(gl_lock);
         r = g_atomic_int_get(&rstr->_ref_count);
         nm_assert(r > 0);
@@ -124,12 +134,15 @@ NMRefString *
 nm_ref_string_new_len(const char *cstr, gsize len)
 {
     NMRefString *rstr;
+    guint        hash;
 
     /* @len cannot be close to G_MAXSIZE. For one, that would mean our call
      * to malloc() below overflows. Also, we use G_MAXSIZE as special length
      * to indicate using _priv_lookup. */
     nm_assert(len < G_MAXSIZE - G_STRUCT_OFFSET(NMRefString, str) - 1u);
 
+    hash = _ref_string_compute_hash(cstr, len);
+
     G_LOCK(gl_lock);
 
     if (G_UNLIKELY(!gl_hash)) {
@@ -140,8 +153,9 @@ nm_ref_string_new_len(const char *cstr, gsize len)
             .len = G_MAXSIZE,
             ._priv_lookup =
                 {
-                    .l_len = len,
-                    .l_str = cstr,
+                    .l_len  = len,
+                    .l_str  = cstr,
+                    .l_hash = hash,
                 },
         };
 
@@ -160,6 +174,7 @@ nm_ref_string_new_len(const char *cstr, gsize len)
         nm_memcpy((char *) rstr->str, cstr, len);
         ((char *) rstr->str)[len] = '\0';
         *((gsize *) &rstr->len)   = len;
+        rstr->_priv_hash          = hash;
         rstr->_ref_count          = 1;
 
         if (!g_hash_table_add(gl_hash, rstr))
@@ -200,8 +215,9 @@ nmtst_ref_string_find_len(const char *cstr, gsize len)
             .len = G_MAXSIZE,
             ._priv_lookup =
                 {
-                    .l_len = len,
-                    .l_str = cstr,
+                    .l_len  = len,
+                    .l_str  = cstr,
+                    .l_hash = _ref_string_compute_hash(cstr, len),
                 },
         };
 
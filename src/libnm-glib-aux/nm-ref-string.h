@@ -9,15 +9,19 @@ typedef struct _NMRefString {
     const gsize len;
     union {
         struct {
+            /* The content hash, computed once when interning. Private to
+             * nm-ref-string.c. */
+            guint        _priv_hash;
             volatile int _ref_count;
             const char   str[];
         };
         struct {
             /* This union field is only used during lookup by external string.
-             * In that case, len will be set to G_MAXSIZE, and the actual len/str values
-             * are set in _priv_lookup. */
+             * In that case, len will be set to G_MAXSIZE, and the actual len/str/hash
+             * values are set in _priv_lookup. */
             gsize       l_len;
             const char *l_str;
+            guint       l_hash;
         } _priv_lookup;
     };
 } NMRefString;
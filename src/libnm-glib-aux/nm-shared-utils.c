@@ -476,6 +476,19 @@ nm_g_bytes_to_variant_ay(const GBytes *bytes)
     } else
         p = g_bytes_get_data((GBytes *) bytes, &l);
 
+    if (l > 4096u) {
+        /* For large data (e.g. certificate blobs) don't copy, but let the
+         * variant borrow the buffer while keeping a reference on @bytes.
+         * Any byte sequence is in normal form for "ay", so the data can be
+         * marked as trusted. */
+        return g_variant_new_from_data(G_VARIANT_TYPE("ay"),
+                                       p,
+                                       l,
+                                       TRUE,
+                                       (GDestroyNotify) g_bytes_unref,
+                                       g_bytes_ref((GBytes *) bytes));
+    }
+
     return nm_g_variant_new_ay(p, l);
 }
 
@@ -3300,6 +3313,8 @@ nm_utils_named_value_list_sort(NMUtilsNamedValue *arr,
                                GCompareDataFunc   compare_func,
                                gpointer           user_data)
 {
+    gsize i, j;
+
     if (len == 0)
         return;
 
@@ -3308,11 +3323,25 @@ nm_utils_named_value_list_sort(NMUtilsNamedValue *arr,
     if (len == 1)
         return;
 
-    g_qsort_with_data(arr,
-                      len,
-                      sizeof(NMUtilsNamedValue),
-                      compare_func ?: nm_strcmp_p_with_data,
-                      user_data);
+    if (!compare_func)
+        compare_func = nm_strcmp_p_with_data;
+
+    if (len > 12u) {
+        g_qsort_with_data(arr, len, sizeof(NMUtilsNamedValue), compare_func, user_data);
+        return;
+    }
+
+    /* Most dictionaries we convert (setting properties, DHCP/VPN options)
+     * have only a handful of entries. For those, insertion sort beats the
+     * general purpose qsort, which matters on the D-Bus serialization hot
+     * paths that sort on every conversion. */
+    for (i = 1; i < len; i++) {
+        NMUtilsNamedValue v = arr[i];
+
+        for (j = i; j > 0 && compare_func(&arr[j - 1], &v, user_data) > 0; j--)
+            arr[j] = arr[j - 1];
+        arr[j] = v;
+    }
 }
 
 /*****************************************************************************/
@@ -3413,8 +3442,8 @@ nm_utils_hash_to_array_full(GHashTable         *hash,
     values[i].name_ptr  = NULL;
     values[i].value_ptr = NULL;
 
-    if (compare_func && len > 1)
-        g_qsort_with_data(values, len, sizeof(NMUtilsNamedValue), compare_func, user_data);
+    if (compare_func)
+        nm_utils_named_value_list_sort(values, len, compare_func, user_data);
 
     NM_SET_OUT(out_len, len);
     return values;
@@ -5762,21 +5791,16 @@ nm_indirect_g_free(gpointer arg)
 
 /*****************************************************************************/
 
-static char *
-attribute_escape(const char *src, char c1, char c2)
+static void
+attribute_escape_append(GString *str, const char *src, char c1, char c2)
 {
-    char *ret, *dest;
-
-    dest = ret = g_malloc(strlen(src) * 2 + 1);
-
+    /* appends in-place, to avoid a short-lived heap allocation per
+     * attribute in the to-string paths. */
     while (*src) {
         if (*src == c1 || *src == c2 || *src == '\\')
-            *dest++ = '\\';
-        *dest++ = *src++;
+            g_string_append_c(str, '\\');
+        g_string_append_c(str, *src++);
     }
-    *dest++ = '\0';
-
-    return ret;
 }
 
 void
@@ -5790,7 +5814,6 @@ _nm_utils_format_variant_attributes_full(GString                             *st
     const NMVariantAttributeSpec *const *s;
     const char                          *name, *value;
     GVariant                            *variant;
-    char                                *escaped;
     char                                 buf[64];
     char                                 sep = 0;
     guint                                i;
@@ -5833,16 +5856,11 @@ _nm_utils_format_variant_attributes_full(GString                             *st
         if (sep)
             g_string_append_c(str, sep);
 
-        escaped = attribute_escape(name, attr_separator, key_value_separator);
-        g_string_append(str, escaped);
-        g_free(escaped);
+        attribute_escape_append(str, name, attr_separator, key_value_separator);
 
         if (!s || !*s || !(*s)->no_value) {
             g_string_append_c(str, key_value_separator);
-
-            escaped = attribute_escape(value, attr_separator, key_value_separator);
-            g_string_append(str, escaped);
-            g_free(escaped);
+            attribute_escape_append(str, value, attr_separator, key_value_separator);
         }
 
         sep = attr_separator;
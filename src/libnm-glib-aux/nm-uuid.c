@@ -306,6 +306,32 @@ nm_uuid_generate_random_str(char buf[static 37])
  *
  * Returns: the input @uuid. This function cannot fail.
  **/
+static GChecksum *
+_checksum_get_cached(GChecksumType checksum_type)
+{
+    static _nm_thread_local GChecksum *cached_md5;
+    static _nm_thread_local GChecksum *cached_sha1;
+    GChecksum                        **p_cached;
+    GChecksum                         *sum;
+
+    nm_assert(NM_IN_SET(checksum_type, G_CHECKSUM_MD5, G_CHECKSUM_SHA1));
+
+    /* Bulk imports derive a UUID per profile. Keep one context per digest
+     * type (and thread) around instead of allocating a fresh one each time.
+     * The contexts are small and intentionally kept for the thread's
+     * lifetime. */
+    p_cached = (checksum_type == G_CHECKSUM_MD5) ? &cached_md5 : &cached_sha1;
+
+    sum = *p_cached;
+    if (G_LIKELY(sum))
+        g_checksum_reset(sum);
+    else {
+        sum       = g_checksum_new(checksum_type);
+        *p_cached = sum;
+    }
+    return sum;
+}
+
 NMUuid *
 nm_uuid_generate_from_string(NMUuid       *uuid,
                              const char   *s,
@@ -313,7 +339,7 @@ nm_uuid_generate_from_string(NMUuid       *uuid,
                              NMUuidType    uuid_type,
                              const NMUuid *type_args)
 {
-    nm_auto_free_checksum GChecksum *sum = NULL;
+    GChecksum *sum;
     union {
         guint8 sha1[NM_UTILS_CHECKSUM_LENGTH_SHA1];
         guint8 md5[NM_UTILS_CHECKSUM_LENGTH_MD5];
@@ -351,7 +377,7 @@ nm_uuid_generate_from_string(NMUuid       *uuid,
         g_return_val_if_reached(NULL);
     }
 
-    sum = g_checksum_new(checksum_type);
+    sum = _checksum_get_cached(checksum_type);
     if (type_args)
         g_checksum_update(sum, (guchar *) type_args, sizeof(*type_args));
     g_checksum_update(sum, (guchar *) s, slen);
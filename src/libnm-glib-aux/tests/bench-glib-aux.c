@@ -0,0 +1,225 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+
+#include "libnm-glib-aux/nm-default-glib-i18n-prog.h"
+
+#include "libnm-glib-aux/nm-dedup-multi.h"
+#include "libnm-glib-aux/nm-prioq.h"
+#include "libnm-glib-aux/nm-str-buf.h"
+
+#include "libnm-glib-aux/nm-test-utils.h"
+
+/* Wall-clock benchmarks for the hot low-level primitives. These are not
+ * run as part of the regular test suite but via "meson test --benchmark".
+ * They print a rate in operations per second; they don't assert on
+ * timing, because absolute numbers depend entirely on the machine. */
+
+static void
+_bench_report(const char *name, guint64 n_ops, double elapsed_sec)
+{
+    g_print("# bench: %-20s %" G_GUINT64_FORMAT " ops in %.3f sec = %.0f ops/sec\n",
+            name,
+            n_ops,
+            elapsed_sec,
+            elapsed_sec > 0 ? ((double) n_ops) / elapsed_sec : 0);
+}
+
+/*****************************************************************************/
+
+#define BENCH_HASH_N (1000u * 1000u)
+
+static void
+bench_hash(void)
+{
+    guint64 dummy = 0;
+    guint   i;
+
+    /* warmup. */
+    for (i = 0; i < BENCH_HASH_N / 10u; i++)
+        dummy += nm_hash_vals(1234, i);
+
+    g_test_timer_start();
+    for (i = 0; i < BENCH_HASH_N; i++) {
+        NMHashState h;
+
+        nm_hash_init(&h, 1234);
+        nm_hash_update_vals(&h, i, (guint64) i, (guint16) i);
+        dummy += nm_hash_complete(&h);
+    }
+    _bench_report("hash-vals", BENCH_HASH_N, g_test_timer_elapsed());
+
+    g_test_timer_start();
+    for (i = 0; i < BENCH_HASH_N; i++) {
+        char sbuf[60];
+
+        dummy += nm_hash_str(nm_sprintf_buf(sbuf, "interface-name-%u", i % 64u));
+    }
+    _bench_report("hash-str", BENCH_HASH_N, g_test_timer_elapsed());
+
+    /* keep the accumulated value observable, so the loops cannot be
+     * optimized away entirely. */
+    g_assert_cmpint(dummy, !=, 1);
+}
+
+/*****************************************************************************/
+
+#define BENCH_STRBUF_N  (100u * 1000u)
+#define BENCH_STRBUF_SZ (2000u)
+
+static void
+bench_strbuf(void)
+{
+    guint64 dummy = 0;
+    guint   i;
+
+    g_test_timer_start();
+    for (i = 0; i < BENCH_STRBUF_N; i++) {
+        nm_auto_str_buf NMStrBuf strbuf = NM_STR_BUF_INIT(0, FALSE);
+
+        /* grow a buffer from empty to ~2000 characters, the way
+         * to-string functions do. */
+        while (strbuf.len < BENCH_STRBUF_SZ)
+            nm_str_buf_append_printf(&strbuf, " %u/%u", i, (guint) strbuf.len);
+        dummy += strbuf.len;
+    }
+    _bench_report("strbuf-growth", BENCH_STRBUF_N, g_test_timer_elapsed());
+
+    g_assert_cmpint(dummy, !=, 1);
+}
+
+/*****************************************************************************/
+
+#define BENCH_PRIOQ_N     (10u * 1000u)
+#define BENCH_PRIOQ_CHURN (1000u * 1000u)
+
+static int
+_bench_prioq_cmp(gconstpointer a, gconstpointer b)
+{
+    NM_CMP_DIRECT(*((const guint32 *) a), *((const guint32 *) b));
+    return 0;
+}
+
+static void
+bench_prioq(void)
+{
+    nm_auto_prioq NMPrioq q = NM_PRIOQ_ZERO;
+    guint32               data[BENCH_PRIOQ_N];
+    guint                 i;
+
+    nm_prioq_init(&q, _bench_prioq_cmp);
+
+    for (i = 0; i < G_N_ELEMENTS(data); i++) {
+        data[i] = nmtst_get_rand_uint32();
+        nm_prioq_put(&q, &data[i], NULL);
+    }
+
+    /* steady-state churn: pop the smallest element, give it a new
+     * priority, push it back. This is the timeout-wheel usage pattern. */
+    g_test_timer_start();
+    for (i = 0; i < BENCH_PRIOQ_CHURN; i++) {
+        guint32 *p = nm_prioq_pop(&q);
+
+        g_assert(p);
+        *p = nmtst_get_rand_uint32();
+        nm_prioq_put(&q, p, NULL);
+    }
+    _bench_report("prioq-churn", BENCH_PRIOQ_CHURN, g_test_timer_elapsed());
+
+    g_assert_cmpint(nm_prioq_size(&q), ==, BENCH_PRIOQ_N);
+}
+
+/*****************************************************************************/
+
+typedef struct {
+    NMDedupMultiObj parent;
+    guint64         val;
+} BenchDedupObj;
+
+static const NMDedupMultiObj *
+_bench_dedup_obj_clone(const NMDedupMultiObj *obj)
+{
+    BenchDedupObj *o;
+
+    o                     = g_slice_new(BenchDedupObj);
+    *o                    = *((const BenchDedupObj *) obj);
+    o->parent._ref_count  = 1;
+    o->parent._multi_idx  = NULL;
+    return (const NMDedupMultiObj *) o;
+}
+
+static void
+_bench_dedup_obj_destroy(NMDedupMultiObj *obj)
+{
+    g_slice_free(BenchDedupObj, (BenchDedupObj *) obj);
+}
+
+static void
+_bench_dedup_obj_full_hash_update(const NMDedupMultiObj *obj, NMHashState *h)
+{
+    nm_hash_update_val(h, ((const BenchDedupObj *) obj)->val);
+}
+
+static gboolean
+_bench_dedup_obj_full_equal(const NMDedupMultiObj *obj_a, const NMDedupMultiObj *obj_b)
+{
+    return ((const BenchDedupObj *) obj_a)->val == ((const BenchDedupObj *) obj_b)->val;
+}
+
+static const NMDedupMultiObjClass bench_dedup_obj_class = {
+    .obj_clone            = _bench_dedup_obj_clone,
+    .obj_destroy          = _bench_dedup_obj_destroy,
+    .obj_full_hash_update = _bench_dedup_obj_full_hash_update,
+    .obj_full_equal       = _bench_dedup_obj_full_equal,
+};
+
+#define BENCH_DEDUP_N        (100u * 1000u)
+#define BENCH_DEDUP_DISTINCT (1000u)
+
+static void
+bench_dedup(void)
+{
+    nm_auto_unref_dedup_multi_index NMDedupMultiIndex *multi_idx = nm_dedup_multi_index_new();
+    gs_free gconstpointer                             *interned  = NULL;
+    guint                                              i;
+
+    interned = g_new(gconstpointer, BENCH_DEDUP_N);
+
+    /* intern many objects of which most are duplicates. This is the
+     * platform-cache/l3cd pattern, where the same addresses and routes
+     * get instantiated over and over. */
+    g_test_timer_start();
+    for (i = 0; i < BENCH_DEDUP_N; i++) {
+        BenchDedupObj obj = {
+            .parent = {
+                .klass      = &bench_dedup_obj_class,
+                ._ref_count = NM_OBJ_REF_COUNT_STACKINIT,
+            },
+            .val = i % BENCH_DEDUP_DISTINCT,
+        };
+
+        interned[i] = nm_dedup_multi_index_obj_intern(multi_idx, &obj);
+        g_assert(interned[i]);
+    }
+    _bench_report("dedup-intern", BENCH_DEDUP_N, g_test_timer_elapsed());
+
+    g_test_timer_start();
+    for (i = 0; i < BENCH_DEDUP_N; i++)
+        nm_dedup_multi_obj_unref(interned[i]);
+    _bench_report("dedup-unref", BENCH_DEDUP_N, g_test_timer_elapsed());
+}
+
+/*****************************************************************************/
+
+NMTST_DEFINE();
+
+int
+main(int argc, char **argv)
+{
+    nmtst_init(&argc, &argv, TRUE);
+
+    g_test_add_func("/benchmark/hash", bench_hash);
+    g_test_add_func("/benchmark/strbuf", bench_strbuf);
+    g_test_add_func("/benchmark/prioq", bench_prioq);
+    g_test_add_func("/benchmark/dedup", bench_dedup);
+
+    return g_test_run();
+}
@@ -2848,6 +2848,35 @@ compare_ip6_addresses(void)
 
 /*****************************************************************************/
 
+static void
+test_named_value_list_sort(void)
+{
+    guint i_run;
+
+    /* exercise both the insertion-sort path (small arrays) and the qsort
+     * path (larger ones) with random input, including duplicate names. */
+    for (i_run = 0; i_run < 50; i_run++) {
+        NMUtilsNamedValue arr[30];
+        guint             len = nmtst_get_rand_uint32() % (G_N_ELEMENTS(arr) + 1);
+        char             *names[G_N_ELEMENTS(arr)];
+        guint             i;
+
+        for (i = 0; i < len; i++) {
+            names[i] = g_strdup_printf("key-%u", nmtst_get_rand_uint32() % 40u);
+            arr[i]   = (NMUtilsNamedValue) NM_UTILS_NAMED_VALUE_INIT(names[i], NULL);
+        }
+
+        nm_utils_named_value_list_sort(arr, len, NULL, NULL);
+
+        g_assert(nm_utils_named_value_list_is_sorted(arr, len, TRUE, NULL, NULL));
+
+        for (i = 0; i < len; i++)
+            g_free(names[i]);
+    }
+}
+
+/*****************************************************************************/
+
 NMTST_DEFINE();
 
 int
@@ -2897,6 +2926,7 @@ main(int argc, char **argv)
     g_test_add_func("/general/test_inet_utils", test_inet_utils);
     g_test_add_func("/general/test_inet_parse_ip4_legacy", test_inet_parse_ip4_legacy);
     g_test_add_func("/general/test_garray", test_garray);
+    g_test_add_func("/general/test_named_value_list_sort", test_named_value_list_sort);
     g_test_add_func("/general/test_nm_prioq", test_nm_prioq);
     g_test_add_func("/general/test_nm_random", test_nm_random);
     g_test_add_func("/general/test_uid_to_name", test_uid_to_name);
@@ -188,6 +188,69 @@ static const LogDesc domain_desc[] = {
 
 /*****************************************************************************/
 
+/* Device-scoped logging: when a filter is set (via the "logging.device-filter"
+ * configuration option), TRACE and DEBUG messages that carry an interface name
+ * are dropped unless the name matches the filter. Messages without an interface
+ * name and all messages at INFO level and above always pass.
+ *
+ * Matching messages are additionally rate-limited with a token bucket per
+ * (domain, interface), so that targeted trace logging of one busy device
+ * cannot make the logging itself the bottleneck.
+ *
+ * This state is only used from the main-thread (like gl_main) and needs no
+ * lock. Messages logged from other threads bypass the filter, which is
+ * acceptable because logging from other threads is rare and the filter is
+ * a debugging aid, not a guarantee. */
+
+#define DEVICE_FILTER_RATELIMIT_BURST   2000u
+#define DEVICE_FILTER_RATELIMIT_PER_SEC 200u
+
+typedef struct {
+    gint64 last_refill_msec;
+    guint  tokens;
+    guint  n_suppressed;
+} DeviceFilterBucket;
+
+static struct {
+    const char **ifnames;
+    GHashTable  *buckets;
+} gl_device_filter;
+
+/*****************************************************************************/
+
+/* Flight recorder: when enabled (via the "logging.flight-recorder-size"
+ * configuration option), the capture state in @_nm_logging_enabled_state is
+ * raised to all levels and domains (except the protected LOGD_VPN_PLUGIN
+ * below INFO), so that every message reaches _nm_log_impl(), where it is
+ * formatted and appended to a fixed-size in-memory ring. Only messages that
+ * also pass the configured level/domains -- kept in @emit_state -- are
+ * forwarded to the backend. The ring can be dumped on demand (SIGUSR1, or
+ * when a device activation fails), giving trace-grade context for the
+ * recent past with bounded memory.
+ *
+ * Like the device filter, the ring itself is main-thread-only. Messages
+ * from other threads are gated against @emit_state (under lock) but not
+ * recorded. @active and @emit_state are modified under the "log" lock. */
+static struct {
+    char      **lines;   /* ring of formatted messages; oldest overwritten first. */
+    guint       n_lines; /* allocated size of @lines; zero when disabled. */
+    guint       idx;     /* next slot to write. */
+    gboolean    active;
+    NMLogDomain emit_state[_LOGL_N_REAL];
+} gl_flight_rec;
+
+static NMLogDomain
+_flight_rec_capture_state(int level_idx)
+{
+    /* capture everything, but keep the LOGD_VPN_PLUGIN protection for the
+     * verbose levels: those messages may expose sensitive data and must not
+     * end up in the ring unless explicitly enabled. */
+    return level_idx < LOGL_INFO ? (LOGD_ALL & ~((NMLogDomain) LOGD_VPN_PLUGIN))
+                                 : (NMLogDomain) LOGD_ALL;
+}
+
+/*****************************************************************************/
+
 static char *_domains_to_string(gboolean          include_level_override,
                                 NMLogLevel        log_level,
                                 const NMLogDomain log_state[static _LOGL_N_REAL]);
@@ -274,7 +337,12 @@ nm_logging_setup(const char *level, const char *domains, char **bad_domains, GEr
     g_return_val_if_fail(!error || !*error, FALSE);
 
     cur_log_level = gl.imm.log_level;
-    memcpy(cur_log_state, _nm_logging_enabled_state, sizeof(cur_log_state));
+    if (gl_flight_rec.active) {
+        /* while the flight recorder captures everything, the user-visible
+         * configuration is the emission state. */
+        memcpy(cur_log_state, gl_flight_rec.emit_state, sizeof(cur_log_state));
+    } else
+        memcpy(cur_log_state, _nm_logging_enabled_state, sizeof(cur_log_state));
 
     new_log_level = cur_log_level;
 
@@ -394,8 +462,18 @@ nm_logging_setup(const char *level, const char *domains, char **bad_domains, GEr
     G_LOCK(log);
 
     gl.mut.log_level = new_log_level;
-    for (i = 0; i < G_N_ELEMENTS(new_log_state); i++)
-        _nm_logging_enabled_state[i] = new_log_state[i];
+    if (gl_flight_rec.active)
+        memcpy(gl_flight_rec.emit_state, new_log_state, sizeof(gl_flight_rec.emit_state));
+    for (i = 0; i < G_N_ELEMENTS(new_log_state); i++) {
+        NMLogDomain v = new_log_state[i];
+
+        if (gl_flight_rec.active)
+            v |= _flight_rec_capture_state(i);
+
+        /* atomic stores, so that _nm_logging_enabled_atomic() can read the
+         * words from other threads without taking the lock. */
+        __atomic_store_n(&_nm_logging_enabled_state[i], v, __ATOMIC_RELAXED);
+    }
 
     G_UNLOCK(log);
 
@@ -415,6 +493,236 @@ nm_logging_setup(const char *level, const char *domains, char **bad_domains, GEr
     return TRUE;
 }
 
+/**
+ * nm_logging_setup_device_filter:
+ * @filter: a comma separated list of interface names, or %NULL/empty
+ *   to disable device-scoped logging.
+ *
+ * Restricts TRACE and DEBUG messages that are associated with a device
+ * to the given interfaces, and rate-limits them per (domain, interface).
+ * See the comment at @gl_device_filter.
+ */
+void
+nm_logging_setup_device_filter(const char *filter)
+{
+    gs_free const char **ifnames_old = NULL;
+
+    NM_ASSERT_ON_MAIN_THREAD();
+
+    ifnames_old = g_steal_pointer(&gl_device_filter.ifnames);
+    nm_clear_pointer(&gl_device_filter.buckets, g_hash_table_unref);
+
+    if (!filter || !filter[0]) {
+        if (ifnames_old)
+            nm_log_dbg(LOGD_CORE, "logging: device filter removed");
+        return;
+    }
+
+    gl_device_filter.ifnames = nm_strsplit_set(filter, ", ");
+    if (!gl_device_filter.ifnames)
+        return;
+
+    gl_device_filter.buckets = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+
+    nm_log_dbg(LOGD_CORE, "logging: device filter set to \"%s\"", filter);
+}
+
+static gboolean
+_device_filter_accept(NMLogLevel level, NMLogDomain domain, const char *ifname)
+{
+    DeviceFilterBucket *bucket;
+    char                key[80];
+    gint64              now_msec;
+    gsize               i;
+
+    nm_assert(gl_device_filter.ifnames);
+
+    if (level >= LOGL_INFO)
+        return TRUE;
+
+    if (!ifname) {
+        /* the message cannot be attributed to a device. Let it pass. */
+        return TRUE;
+    }
+
+    for (i = 0; TRUE; i++) {
+        if (!gl_device_filter.ifnames[i])
+            return FALSE;
+        if (nm_streq(gl_device_filter.ifnames[i], ifname))
+            break;
+    }
+
+    g_snprintf(key, sizeof(key), "%" G_GINT64_MODIFIER "x-%s", (guint64) domain, ifname);
+
+    bucket = g_hash_table_lookup(gl_device_filter.buckets, key);
+    if (!bucket) {
+        bucket  = g_new(DeviceFilterBucket, 1);
+        *bucket = (DeviceFilterBucket){
+            .tokens           = DEVICE_FILTER_RATELIMIT_BURST,
+            .last_refill_msec = nm_utils_get_monotonic_timestamp_msec(),
+        };
+        g_hash_table_insert(gl_device_filter.buckets, g_strdup(key), bucket);
+    }
+
+    now_msec = nm_utils_get_monotonic_timestamp_msec();
+    if (now_msec > bucket->last_refill_msec) {
+        guint64 refill;
+
+        refill = (((guint64) (now_msec - bucket->last_refill_msec))
+                  * DEVICE_FILTER_RATELIMIT_PER_SEC)
+                 / 1000u;
+        if (refill > 0) {
+            /* only advance last_refill_msec when at least one full token
+             * accumulated, so that fractional refills are not lost. */
+            bucket->tokens           = (guint) NM_MIN(((guint64) bucket->tokens) + refill,
+                                            (guint64) DEVICE_FILTER_RATELIMIT_BURST);
+            bucket->last_refill_msec = now_msec;
+            if (bucket->n_suppressed > 0) {
+                guint n_suppressed;
+
+                n_suppressed         = bucket->n_suppressed;
+                bucket->n_suppressed = 0;
+                nm_log(level,
+                       domain,
+                       ifname,
+                       NULL,
+                       "logging: rate limit: %u messages for this device were suppressed",
+                       n_suppressed);
+            }
+        }
+    }
+
+    if (bucket->tokens == 0) {
+        bucket->n_suppressed++;
+        return FALSE;
+    }
+    bucket->tokens--;
+    return TRUE;
+}
+
+/**
+ * nm_logging_setup_flight_recorder:
+ * @n_lines: the number of messages to keep in the in-memory ring, or
+ *   zero to disable the flight recorder.
+ *
+ * While enabled, all messages (of all levels and domains, except the
+ * protected VPN_PLUGIN domain) are recorded in a fixed-size in-memory
+ * ring, while only the configured level/domains are emitted to the
+ * logging backend. See the comment at @gl_flight_rec.
+ */
+void
+nm_logging_setup_flight_recorder(guint n_lines)
+{
+    gboolean had_platform_debug;
+    guint    i;
+
+    NM_ASSERT_ON_MAIN_THREAD();
+
+    n_lines = NM_MIN(n_lines, 100000u);
+
+    if (n_lines == gl_flight_rec.n_lines)
+        return;
+
+    had_platform_debug = _nm_logging_enabled_lockfree(LOGL_DEBUG, LOGD_PLATFORM);
+
+    for (i = 0; i < gl_flight_rec.n_lines; i++)
+        g_free(gl_flight_rec.lines[i]);
+    nm_clear_g_free(&gl_flight_rec.lines);
+    gl_flight_rec.idx     = 0;
+    gl_flight_rec.n_lines = n_lines;
+
+    G_LOCK(log);
+
+    if (n_lines > 0) {
+        gl_flight_rec.lines = g_new0(char *, n_lines);
+        if (!gl_flight_rec.active) {
+            memcpy(gl_flight_rec.emit_state,
+                   _nm_logging_enabled_state,
+                   sizeof(gl_flight_rec.emit_state));
+            gl_flight_rec.active = TRUE;
+        }
+        for (i = 0; i < _LOGL_N_REAL; i++) {
+            __atomic_store_n(&_nm_logging_enabled_state[i],
+                             gl_flight_rec.emit_state[i] | _flight_rec_capture_state(i),
+                             __ATOMIC_RELAXED);
+        }
+    } else if (gl_flight_rec.active) {
+        for (i = 0; i < _LOGL_N_REAL; i++) {
+            __atomic_store_n(&_nm_logging_enabled_state[i],
+                             gl_flight_rec.emit_state[i],
+                             __ATOMIC_RELAXED);
+        }
+        gl_flight_rec.active = FALSE;
+    }
+
+    G_UNLOCK(log);
+
+    nm_clear_g_free(&gl_main.logging_domains_to_string);
+
+    if (had_platform_debug && !_nm_logging_enabled_lockfree(LOGL_DEBUG, LOGD_PLATFORM))
+        _nm_logging_clear_platform_logging_cache();
+
+    if (n_lines > 0)
+        nm_log_dbg(LOGD_CORE, "logging: flight recorder enabled (%u messages)", n_lines);
+    else
+        nm_log_dbg(LOGD_CORE, "logging: flight recorder disabled");
+}
+
+static void
+_flight_rec_append(NMLogLevel level, gint64 tv, const char *msg)
+{
+    char **slot = &gl_flight_rec.lines[gl_flight_rec.idx];
+
+    g_free(*slot);
+    *slot = g_strdup_printf("%-7s [%" G_GINT64_FORMAT ".%04d] %s",
+                            nm_log_level_desc[level].level_str,
+                            tv / NM_UTILS_USEC_PER_SEC,
+                            (int) ((tv % NM_UTILS_USEC_PER_SEC) / ((gint64) 100)),
+                            msg);
+    gl_flight_rec.idx = (gl_flight_rec.idx + 1u) % gl_flight_rec.n_lines;
+}
+
+/**
+ * nm_logging_flight_recorder_dump:
+ * @path: the file to (over)write with the recorded messages.
+ *
+ * Writes the content of the flight recorder ring, oldest message first.
+ * Does nothing if the flight recorder is not enabled.
+ */
+void
+nm_logging_flight_recorder_dump(const char *path)
+{
+    FILE *f;
+    guint i;
+    guint n = 0;
+
+    NM_ASSERT_ON_MAIN_THREAD();
+
+    if (!gl_flight_rec.active)
+        return;
+
+    f = fopen(path, "we");
+    if (!f) {
+        nm_log_warn(LOGD_CORE,
+                    "logging: flight recorder: failure to write %s: %s",
+                    path,
+                    g_strerror(errno));
+        return;
+    }
+
+    for (i = 0; i < gl_flight_rec.n_lines; i++) {
+        const char *line = gl_flight_rec.lines[(gl_flight_rec.idx + i) % gl_flight_rec.n_lines];
+
+        if (!line)
+            continue;
+        fprintf(f, "%s\n", line);
+        n++;
+    }
+    fclose(f);
+
+    nm_log_info(LOGD_CORE, "logging: flight recorder: dumped %u messages to %s", n, path);
+}
+
 const char *
 nm_logging_level_to_string(void)
 {
@@ -449,7 +757,10 @@ nm_logging_domains_to_string(void)
 
     if (G_UNLIKELY(!gl_main.logging_domains_to_string)) {
         gl_main.logging_domains_to_string =
-            _domains_to_string(TRUE, gl.imm.log_level, _nm_logging_enabled_state);
+            _domains_to_string(TRUE,
+                               gl.imm.log_level,
+                               gl_flight_rec.active ? gl_flight_rec.emit_state
+                                                    : _nm_logging_enabled_state);
     }
 
     return gl_main.logging_domains_to_string;
@@ -569,17 +880,6 @@ nm_logging_get_level(NMLogDomain domain)
     return sl;
 }
 
-gboolean
-_nm_logging_enabled_locking(NMLogLevel level, NMLogDomain domain)
-{
-    gboolean v;
-
-    G_LOCK(log);
-    v = _nm_logging_enabled_lockfree(level, domain);
-    G_UNLOCK(log);
-    return v;
-}
-
 gboolean
 _nm_log_enabled_impl(gboolean mt_require_locking, NMLogLevel level, NMLogDomain domain)
 {
@@ -681,15 +981,26 @@ _nm_log_impl(const char *file,
             G_UNLOCK(log);
             return;
         }
+        if (gl_flight_rec.active && !(gl_flight_rec.emit_state[level] & domain)) {
+            /* the ring is main-thread-only (like the device filter), so
+             * this message is neither recorded nor emitted. */
+            G_UNLOCK(log);
+            return;
+        }
         g_copy = gl.imm;
         memcpy(cur_log_state_copy, _nm_logging_enabled_state, sizeof(cur_log_state_copy));
         G_UNLOCK(log);
         g             = &g_copy;
         cur_log_state = cur_log_state_copy;
+        /* the device filter (if any) is not applied here. Its state is
+         * main-thread-only and logging from other threads is rare. */
     } else {
         NM_ASSERT_ON_MAIN_THREAD();
         if (!_nm_logging_enabled_lockfree(level, domain))
             return;
+        if (G_UNLIKELY(gl_device_filter.ifnames)
+            && !_device_filter_accept(level, domain, ifname))
+            return;
         g             = &gl.imm;
         cur_log_state = _nm_logging_enabled_state;
     }
@@ -728,6 +1039,15 @@ _nm_log_impl(const char *file,
 
     tv = g_get_real_time();
 
+    if (G_UNLIKELY(gl_flight_rec.active) && !mt_require_locking) {
+        _flight_rec_append(level, tv, msg);
+        if (!(gl_flight_rec.emit_state[level] & domain)) {
+            /* recorded only; the configured level does not emit it. */
+            errno = errsv;
+            return;
+        }
+    }
+
     if (g->debug_stderr)
         g_printerr(MESSAGE_FMT "\n", MESSAGE_ARG(g->prefix, tv, msg));
 
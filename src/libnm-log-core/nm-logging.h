@@ -120,13 +120,30 @@ _nm_logging_enabled_lockfree(NMLogLevel level, NMLogDomain domain)
            && !!(_nm_logging_enabled_state[level] & domain);
 }
 
-gboolean _nm_logging_enabled_locking(NMLogLevel level, NMLogDomain domain);
+static inline gboolean
+_nm_logging_enabled_atomic(NMLogLevel level, NMLogDomain domain)
+{
+    NMLogDomain state;
+
+    nm_assert(((guint) level) < G_N_ELEMENTS(_nm_logging_enabled_state));
+    if (((guint) level) >= G_N_ELEMENTS(_nm_logging_enabled_state))
+        return FALSE;
+
+    /* The state is only modified on the main-thread (under lock, with atomic
+     * stores). A relaxed atomic read gives us an untorn word without taking
+     * the lock, so that the disabled-logging fast-path from another thread
+     * costs only a single branch. The value may be momentarily stale, but
+     * that race exists anyway: logging might be disabled right after the
+     * check. */
+    state = __atomic_load_n(&_nm_logging_enabled_state[level], __ATOMIC_RELAXED);
+    return !!(state & domain);
+}
 
 static inline gboolean
 nm_logging_enabled_mt(gboolean mt_require_locking, NMLogLevel level, NMLogDomain domain)
 {
     if (mt_require_locking)
-        return _nm_logging_enabled_locking(level, domain);
+        return _nm_logging_enabled_atomic(level, domain);
 
     NM_ASSERT_ON_MAIN_THREAD();
     return _nm_logging_enabled_lockfree(level, domain);
@@ -145,6 +162,12 @@ const char *nm_logging_all_domains_to_string(void);
 gboolean
 nm_logging_setup(const char *level, const char *domains, char **bad_domains, GError **error);
 
+void nm_logging_setup_device_filter(const char *filter);
+
+void nm_logging_setup_flight_recorder(guint n_lines);
+
+void nm_logging_flight_recorder_dump(const char *path);
+
 void nm_logging_init_pre(const char *syslog_identifier, char *prefix_take);
 
 void nm_logging_init(const char *logging_backend, gboolean debug);
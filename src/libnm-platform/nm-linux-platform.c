@@ -35,6 +35,8 @@
 
 #include "libnm-glib-aux/nm-c-list.h"
 #include "libnm-glib-aux/nm-io-utils.h"
+#include "libnm-glib-aux/nm-perf-counter.h"
+#include "libnm-glib-aux/nm-perf-trace.h"
 #include "libnm-glib-aux/nm-secret-utils.h"
 #include "libnm-glib-aux/nm-time-utils.h"
 #include "libnm-log-core/nm-logging.h"
@@ -529,6 +531,13 @@ typedef struct {
     GSource *event_source_genl;
     GSource *event_source_rtnl;
 
+    /* The GMainContext on which this platform instance processes its netlink
+     * events. It is the thread-default context at construction time. This
+     * allows to drive a platform instance (e.g. for a busy container
+     * namespace) from a dedicated thread with its own context, so that its
+     * event processing does not compete with other namespaces. */
+    GMainContext *main_context;
+
     union {
         struct {
             NetlinkProtocolPrivData proto_data_genl;
@@ -694,7 +703,8 @@ static void cache_on_change(NMPlatform      *platform,
 static void cache_prune_all(NMPlatform *platform);
 static gboolean event_handler_read_netlink(NMPlatform        *platform,
                                            NMPNetlinkProtocol netlink_protocol,
-                                           gboolean           wait_for_acks);
+                                           gboolean           wait_for_acks,
+                                           guint              max_datagrams);
 
 /*****************************************************************************/
 
@@ -6990,16 +7000,29 @@ delayed_action_handle_REFRESH_ALL(NMPlatform *platform, DelayedActionType flags)
     do_request_all_no_delayed_actions(platform, flags);
 }
 
+/* the maximum number of netlink datagrams that the event handler processes in
+ * one dispatch before yielding back to the main loop. */
+#define DELAYED_ACTION_READ_MAX_DATAGRAMS 64u
+
 static void
 delayed_action_handle_READ_NETLINK(NMPlatform *platform, NMPNetlinkProtocol netlink_protocol)
 {
-    event_handler_read_netlink(platform, netlink_protocol, FALSE);
+    /* This is the regular event path (triggered by the socket becoming
+     * readable). Bound the amount of work done in one dispatch, so that a
+     * large burst of netlink events (e.g. during a route flap) cannot
+     * monopolize the main loop. If more datagrams are pending, the
+     * level-triggered event source fires again on the next main loop
+     * iteration, after other sources had a chance to run. */
+    event_handler_read_netlink(platform,
+                               netlink_protocol,
+                               FALSE,
+                               DELAYED_ACTION_READ_MAX_DATAGRAMS);
 }
 
 static void
 delayed_action_handle_WAIT_FOR_RESPONSE(NMPlatform *platform, NMPNetlinkProtocol netlink_protocol)
 {
-    event_handler_read_netlink(platform, netlink_protocol, TRUE);
+    event_handler_read_netlink(platform, netlink_protocol, TRUE, 0);
 }
 
 static gboolean
@@ -7377,6 +7400,10 @@ cache_on_change(NMPlatform      *platform,
                 ifindex = obj_new->link.ifindex;
 
             if (ifindex > 0) {
+                /* the ifindex may be reused by the kernel for a new device.
+                 * Drop the cached immutable ethtool attributes. */
+                nmp_utils_ethtool_cache_forget(ifindex);
+
                 delayed_action_schedule(
                     platform,
                     DELAYED_ACTION_TYPE_REFRESH_ALL_RTNL_IP4_ADDRESSES
@@ -7713,7 +7740,7 @@ do_request_link_no_delayed_actions(NMPlatform *platform, int ifindex, const char
         }
     }
 
-    event_handler_read_netlink(platform, NMP_NETLINK_ROUTE, FALSE);
+    event_handler_read_netlink(platform, NMP_NETLINK_ROUTE, FALSE, 0);
 
     nlmsg = _nl_msg_new_link(RTM_GETLINK, 0, ifindex, name);
     if (nlmsg) {
@@ -7813,6 +7840,7 @@ do_request_all_no_delayed_actions(NMPlatform *platform, DelayedActionType action
     NMLinuxPlatformPrivate *priv = NM_LINUX_PLATFORM_GET_PRIVATE(platform);
     DelayedActionType       action_type_prune;
     DelayedActionType       iflags;
+    gboolean                drained_x[_NMP_NETLINK_NUM] = {};
 
     nm_assert((NM_FLAGS_ANY(action_type, DELAYED_ACTION_TYPE_REFRESH_RTNL_ALL)
                && !NM_FLAGS_ANY(action_type, ~DELAYED_ACTION_TYPE_REFRESH_RTNL_ALL))
@@ -7877,7 +7905,15 @@ do_request_all_no_delayed_actions(NMPlatform *platform, DelayedActionType action
             }
         }
 
-        event_handler_read_netlink(platform, refresh_all_info->protocol, FALSE);
+        /* Drain pending events only once per protocol, so that when we refresh
+         * several object types in one pass the dump requests go out back-to-back
+         * and the kernel can pipeline the responses. On a full resync with many
+         * links/addresses/routes this avoids interleaving a socket read between
+         * every dump. */
+        if (!drained_x[refresh_all_info->protocol]) {
+            drained_x[refresh_all_info->protocol] = TRUE;
+            event_handler_read_netlink(platform, refresh_all_info->protocol, FALSE, 0);
+        }
 
         if (refresh_all_info->protocol == NMP_NETLINK_ROUTE) {
             nlmsg = _nl_msg_new_dump_rtnl(refresh_all_info->obj_type,
@@ -7993,6 +8029,8 @@ event_seq_check(NMPlatform             *platform,
     }
 }
 
+NM_PERF_COUNTER_DEFINE(_perf_rtnl_events, "platform.rtnl-events");
+
 static void
 _rtnl_handle_msg(NMPlatform *platform, const struct nl_msg_lite *msg)
 {
@@ -8007,8 +8045,18 @@ _rtnl_handle_msg(NMPlatform *platform, const struct nl_msg_lite *msg)
     NMPCache                 *cache   = nm_platform_get_cache(platform);
     ParseNlmsgIter            parse_nlmsg_iter;
 
+    NM_PERF_COUNTER_INC(_perf_rtnl_events);
+
     msghdr = msg->nm_nlh;
 
+    if (G_UNLIKELY(_nm_perf_trace_enabled)) {
+        char sbuf_trace[40];
+
+        nm_perf_trace(NM_PERF_TRACE_EVENT_RTNL_EVENT,
+                      msghdr->nlmsg_seq,
+                      nm_sprintf_buf(sbuf_trace, "type=%u", (unsigned) msghdr->nlmsg_type));
+    }
+
     if (NM_IN_SET(msghdr->nlmsg_type,
                   RTM_DELLINK,
                   RTM_DELADDR,
@@ -8234,7 +8282,7 @@ do_add_link_with_lookup(NMPlatform            *platform,
     NMPCache               *cache     = nm_platform_get_cache(platform);
     int                     try_count = 0;
 
-    event_handler_read_netlink(platform, NMP_NETLINK_ROUTE, FALSE);
+    event_handler_read_netlink(platform, NMP_NETLINK_ROUTE, FALSE, 0);
 
     do {
         seq_result = WAIT_FOR_NL_RESPONSE_RESULT_UNKNOWN;
@@ -8291,7 +8339,7 @@ do_add_addrroute(NMPlatform      *platform,
                         NMP_OBJECT_TYPE_IP4_ROUTE,
                         NMP_OBJECT_TYPE_IP6_ROUTE));
 
-    event_handler_read_netlink(platform, NMP_NETLINK_ROUTE, FALSE);
+    event_handler_read_netlink(platform, NMP_NETLINK_ROUTE, FALSE, 0);
 
     do {
         seq_result = WAIT_FOR_NL_RESPONSE_RESULT_UNKNOWN;
@@ -8350,7 +8398,7 @@ do_delete_object(NMPlatform *platform, const NMPObject *obj_id, struct nl_msg *n
     const char             *log_detail = "";
     int                     try_count  = 0;
 
-    event_handler_read_netlink(platform, NMP_NETLINK_ROUTE, FALSE);
+    event_handler_read_netlink(platform, NMP_NETLINK_ROUTE, FALSE, 0);
 
     do {
         seq_result = WAIT_FOR_NL_RESPONSE_RESULT_UNKNOWN;
@@ -9512,6 +9560,48 @@ link_get_dev_id(NMPlatform *platform, int ifindex)
         0);
 }
 
+static gboolean
+link_get_sysfs_props(NMPlatform *platform,
+                     int         ifindex,
+                     char      **out_physical_port_id,
+                     guint      *out_dev_id,
+                     gboolean   *out_supports_sriov)
+{
+    nm_auto_pop_netns NMPNetns *netns = NULL;
+    nm_auto_close int           dirfd = -1;
+    char                        ifname_verified[IFNAMSIZ];
+
+    NM_SET_OUT(out_physical_port_id, NULL);
+    NM_SET_OUT(out_dev_id, 0);
+    NM_SET_OUT(out_supports_sriov, FALSE);
+
+    if (!nm_platform_netns_push(platform, &netns))
+        return FALSE;
+
+    dirfd = nm_platform_sysctl_open_netdir(platform, ifindex, ifname_verified);
+    if (dirfd < 0)
+        return FALSE;
+
+    NM_SET_OUT(out_physical_port_id,
+               sysctl_get(platform,
+                          NMP_SYSCTL_PATHID_NETDIR_A(dirfd, ifname_verified, "phys_port_id")));
+    NM_SET_OUT(out_dev_id,
+               nm_platform_sysctl_get_int_checked(
+                   platform,
+                   NMP_SYSCTL_PATHID_NETDIR_A(dirfd, ifname_verified, "dev_id"),
+                   16,
+                   0,
+                   G_MAXUINT16,
+                   0));
+    NM_SET_OUT(out_supports_sriov,
+               nm_platform_sysctl_get_int32(
+                   platform,
+                   NMP_SYSCTL_PATHID_NETDIR_A(dirfd, ifname_verified, "device/sriov_numvfs"),
+                   -1)
+                   != -1);
+    return TRUE;
+}
+
 static gboolean
 link_tun_add(NMPlatform             *platform,
              const char             *name,
@@ -10223,6 +10313,76 @@ ip_route_add(NMPlatform *platform, NMPNlmFlags flags, NMPObject *obj_stack, char
                             out_extack_msg);
 }
 
+static int
+ip_route_add_batch(NMPlatform *platform, NMPNlmFlags flags, NMPObject *objs_stack, guint objs_len)
+{
+    char                             sbuf1[NM_UTILS_TO_STRING_BUFFER_SIZE];
+    char                             s_buf[256];
+    gs_free WaitForNlResponseResult *seq_results = NULL;
+    guint                            n_sent      = 0;
+    guint                            i;
+    int                              result = 0;
+
+    nm_assert(objs_len > 0);
+
+    event_handler_read_netlink(platform, NMP_NETLINK_ROUTE, FALSE, 0);
+
+    seq_results = g_new0(WaitForNlResponseResult, objs_len);
+
+    for (i = 0; i < objs_len; i++) {
+        nm_auto_nlmsg struct nl_msg *nlmsg = NULL;
+        int                          nle;
+
+        nlmsg = _nl_msg_new_route(RTM_NEWROUTE, flags & NMP_NLM_FLAG_FMASK, &objs_stack[i]);
+        if (!nlmsg)
+            g_return_val_if_reached(-NME_BUG);
+
+        nle = _netlink_send_nlmsg_rtnl(platform, nlmsg, &seq_results[i], NULL);
+        if (nle < 0) {
+            _LOGE("do-add-route-batch[%s]: failure sending netlink request \"%s\" (%d)",
+                  nmp_object_to_string(&objs_stack[i],
+                                       NMP_OBJECT_TO_STRING_ID,
+                                       sbuf1,
+                                       sizeof(sbuf1)),
+                  nm_strerror(nle),
+                  -nle);
+            result = -NME_PL_NETLINK;
+            break;
+        }
+        n_sent++;
+    }
+
+    /* Await the acknowledgments for all requests in one go. */
+    delayed_action_handle_all(platform);
+
+    for (i = 0; i < n_sent; i++) {
+        WaitForNlResponseResult seq_result = seq_results[i];
+        int                     r;
+
+        nm_assert(seq_result != WAIT_FOR_NL_RESPONSE_RESULT_UNKNOWN);
+
+        if (seq_result == WAIT_FOR_NL_RESPONSE_RESULT_FAILED_RESYNC) {
+            /* a resync swallowed the response. Retry this route individually,
+             * with the full retry logic of do_add_addrroute(). */
+            r = ip_route_add(platform, flags, &objs_stack[i], NULL);
+        } else {
+            _NMLOG(seq_result == WAIT_FOR_NL_RESPONSE_RESULT_RESPONSE_OK ? LOGL_DEBUG : LOGL_WARN,
+                   "do-add-route-batch[%s]: %s",
+                   nmp_object_to_string(&objs_stack[i],
+                                        NMP_OBJECT_TO_STRING_ID,
+                                        sbuf1,
+                                        sizeof(sbuf1)),
+                   wait_for_nl_response_to_string(seq_result, NULL, s_buf, sizeof(s_buf)));
+            r = wait_for_nl_response_to_nmerr(seq_result);
+        }
+
+        if (r < 0 && result == 0)
+            result = r;
+    }
+
+    return result;
+}
+
 static gboolean
 object_delete(NMPlatform *platform, const NMPObject *obj)
 {
@@ -10357,7 +10517,7 @@ routing_rule_add(NMPlatform *platform, NMPNlmFlags flags, const NMPlatformRoutin
 
     msg = _nl_msg_new_routing_rule(RTM_NEWRULE, flags, routing_rule);
 
-    event_handler_read_netlink(platform, NMP_NETLINK_ROUTE, FALSE);
+    event_handler_read_netlink(platform, NMP_NETLINK_ROUTE, FALSE, 0);
 
     do {
         seq_result = WAIT_FOR_NL_RESPONSE_RESULT_UNKNOWN;
@@ -10404,7 +10564,7 @@ qdisc_add(NMPlatform *platform, NMPNlmFlags flags, const NMPlatformQdisc *qdisc)
 
     msg = _nl_msg_new_qdisc(RTM_NEWQDISC, flags, qdisc);
 
-    event_handler_read_netlink(platform, NMP_NETLINK_ROUTE, FALSE);
+    event_handler_read_netlink(platform, NMP_NETLINK_ROUTE, FALSE, 0);
 
     do {
         seq_result = WAIT_FOR_NL_RESPONSE_RESULT_UNKNOWN;
@@ -10470,7 +10630,7 @@ tc_delete(NMPlatform *platform,
     if (nlmsg_append_struct(msg, &tcm) < 0)
         goto nla_put_failure;
 
-    event_handler_read_netlink(platform, NMP_NETLINK_ROUTE, FALSE);
+    event_handler_read_netlink(platform, NMP_NETLINK_ROUTE, FALSE, 0);
 
     do {
         seq_result = WAIT_FOR_NL_RESPONSE_RESULT_UNKNOWN;
@@ -10528,7 +10688,7 @@ tfilter_add(NMPlatform *platform, NMPNlmFlags flags, const NMPlatformTfilter *tf
 
     msg = _nl_msg_new_tfilter(RTM_NEWTFILTER, flags, tfilter);
 
-    event_handler_read_netlink(platform, NMP_NETLINK_ROUTE, FALSE);
+    event_handler_read_netlink(platform, NMP_NETLINK_ROUTE, FALSE, 0);
 
     do {
         seq_result = WAIT_FOR_NL_RESPONSE_RESULT_UNKNOWN;
@@ -10877,16 +11037,24 @@ stop:
 
 /*****************************************************************************/
 
+/* the sockets start out with an 8 MB receive buffer. On overflow, the buffer
+ * is doubled, bounded by this cap. */
+#define RCVBUF_MAX_SIZE (64 * 1024 * 1024)
+
+NM_PERF_COUNTER_DEFINE(_perf_netlink_resync, "platform.netlink-resync");
+
 static gboolean
 event_handler_read_netlink(NMPlatform        *platform,
                            NMPNetlinkProtocol netlink_protocol,
-                           gboolean           wait_for_acks)
+                           gboolean           wait_for_acks,
+                           guint              max_datagrams)
 {
     nm_auto_pop_netns NMPNetns *netns = NULL;
     NMLinuxPlatformPrivate     *priv  = NM_LINUX_PLATFORM_GET_PRIVATE(platform);
     int                         r;
     struct pollfd               pfd;
-    gboolean                    any = FALSE;
+    gboolean                    any         = FALSE;
+    guint                       n_datagrams = 0;
     int                         timeout_msec;
     struct {
         guint32 seq_number;
@@ -10896,6 +11064,12 @@ event_handler_read_netlink(NMPlatform        *platform,
 
     nmp_netlink_protocol_check(netlink_protocol);
 
+    /* @max_datagrams is zero for "no limit". A limit only makes sense on the
+     * event path, where we don't block waiting for ACKs and where the socket
+     * stays registered with the main loop, so that pending datagrams trigger
+     * another dispatch. */
+    nm_assert(max_datagrams == 0 || !wait_for_acks);
+
     if (!nm_platform_netns_push(platform, &netns)) {
         delayed_action_wait_for_nl_response_complete_all(platform,
                                                          netlink_protocol,
@@ -10936,6 +11110,21 @@ event_handler_read_netlink(NMPlatform        *platform,
                               }
                               _reason;
                           }));
+                    NM_PERF_COUNTER_INC(_perf_netlink_resync);
+                    if (nle == -ENOBUFS) {
+                        int b;
+
+                        /* the buffer was too small for the event burst. Grow
+                         * it so that the next burst of this size does not
+                         * cost another full resync. */
+                        b = nl_socket_grow_rcvbuf(priv->sk_x[netlink_protocol],
+                                                  RCVBUF_MAX_SIZE);
+                        if (b >= 0) {
+                            _LOGI("netlink[%s]: read: receive buffer now %d bytes",
+                                  nmp_netlink_protocol_info(netlink_protocol)->name,
+                                  b);
+                        }
+                    }
                     _netlink_recv_handle(platform, netlink_protocol, FALSE);
                     delayed_action_wait_for_nl_response_complete_all(
                         platform,
@@ -10952,6 +11141,13 @@ event_handler_read_netlink(NMPlatform        *platform,
                 }
             }
             any = TRUE;
+
+            n_datagrams++;
+            if (max_datagrams != 0 && n_datagrams >= max_datagrams) {
+                /* enough for this dispatch. Leave the remaining datagrams in
+                 * the socket buffer, the event source fires again right away. */
+                goto after_read;
+            }
         }
 
 after_read:
@@ -11506,6 +11702,8 @@ constructed(GObject *_object)
 
     nm_assert(!platform->_netns || platform->_netns == nmp_netns_get_current());
 
+    priv->main_context = g_main_context_ref_thread_default();
+
     if (nm_platform_get_use_udev(platform)) {
         priv->udev_client = nm_udev_client_new(NM_MAKE_STRV("net"), handle_udev_event, platform);
     }
@@ -11553,11 +11751,14 @@ constructed(GObject *_object)
           nl_socket_get_local_port(priv->sk_genl),
           fd);
 
-    priv->event_source_genl =
-        nm_g_unix_fd_add_source(fd,
+    priv->event_source_genl = nm_g_source_attach(
+        nm_g_unix_fd_source_new(fd,
                                 G_IO_IN | G_IO_NVAL | G_IO_PRI | G_IO_ERR | G_IO_HUP,
+                                G_PRIORITY_DEFAULT,
                                 _nl_event_handler_genl,
-                                platform);
+                                platform,
+                                NULL),
+        priv->main_context);
 
     /*************************************************************************/
 
@@ -11592,11 +11793,14 @@ constructed(GObject *_object)
           nl_socket_get_local_port(priv->sk_rtnl),
           fd);
 
-    priv->event_source_rtnl =
-        nm_g_unix_fd_add_source(fd,
+    priv->event_source_rtnl = nm_g_source_attach(
+        nm_g_unix_fd_source_new(fd,
                                 G_IO_IN | G_IO_NVAL | G_IO_PRI | G_IO_ERR | G_IO_HUP,
+                                G_PRIORITY_DEFAULT,
                                 _nl_event_handler_rtnl,
-                                platform);
+                                platform,
+                                NULL),
+        priv->main_context);
 
     /*************************************************************************/
 
@@ -11739,6 +11943,8 @@ finalize(GObject *object)
 
     priv->udev_client = nm_udev_client_destroy(priv->udev_client);
 
+    nm_clear_pointer(&priv->main_context, g_main_context_unref);
+
     G_OBJECT_CLASS(nm_linux_platform_parent_class)->finalize(object);
 
     g_free(priv->netlink_recv_buf.buf);
@@ -11784,6 +11990,7 @@ nm_linux_platform_class_init(NMLinuxPlatformClass *klass)
 
     platform_class->link_get_physical_port_id = link_get_physical_port_id;
     platform_class->link_get_dev_id           = link_get_dev_id;
+    platform_class->link_get_sysfs_props      = link_get_sysfs_props;
     platform_class->link_get_wake_on_lan      = link_get_wake_on_lan;
     platform_class->link_get_driver_info      = link_get_driver_info;
 
@@ -11831,7 +12038,8 @@ nm_linux_platform_class_init(NMLinuxPlatformClass *klass)
     platform_class->ip4_address_delete = ip4_address_delete;
     platform_class->ip6_address_delete = ip6_address_delete;
 
-    platform_class->ip_route_add = ip_route_add;
+    platform_class->ip_route_add       = ip_route_add;
+    platform_class->ip_route_add_batch = ip_route_add_batch;
     platform_class->ip_route_get = ip_route_get;
 
     platform_class->routing_rule_add = routing_rule_add;
@@ -51,8 +51,15 @@ struct nl_sock {
     int                s_proto;
     unsigned int       s_seq_next;
     unsigned int       s_seq_expect;
-    bool               s_msg_peek : 1;
-    bool               s_auto_ack : 1;
+
+    /* Receive buffer owned by the socket and reused by nl_recvmsgs() across
+     * calls, to avoid one allocation per receive. It grows on demand when
+     * a peeked message does not fit. */
+    unsigned char *s_recv_buf;
+    size_t         s_recv_buf_len;
+
+    bool s_msg_peek : 1;
+    bool s_auto_ack : 1;
 };
 
 /*****************************************************************************/
@@ -976,6 +983,7 @@ nl_socket_free(struct nl_sock *sk)
         return;
 
     nm_close(sk->s_fd);
+    g_free(sk->s_recv_buf);
     nm_g_slice_free(sk);
 }
 
@@ -1028,6 +1036,11 @@ nl_socket_set_msg_buf_size(struct nl_sock *sk, size_t bufsize)
 {
     sk->s_bufsize = bufsize;
 
+    /* drop the cached receive buffer, so that the next receive
+     * allocates it with the requested size. */
+    nm_clear_g_free(&sk->s_recv_buf);
+    sk->s_recv_buf_len = 0;
+
     return 0;
 }
 
@@ -1063,6 +1076,51 @@ nl_socket_set_buffer_size(struct nl_sock *sk, int rxbuf, int txbuf)
     return 0;
 }
 
+/**
+ * nl_socket_grow_rcvbuf:
+ * @sk: the netlink socket.
+ * @max_size: upper bound for the (effective) receive buffer size.
+ *
+ * Doubles the socket's receive buffer, up to @max_size. Tries
+ * SO_RCVBUFFORCE first (exceeding rmem_max, requires CAP_NET_ADMIN) and
+ * falls back to SO_RCVBUF.
+ *
+ * Returns: the new effective buffer size (which is the unchanged old size
+ *   if @max_size was already reached), or a negative nm-errno.
+ */
+int
+nl_socket_grow_rcvbuf(struct nl_sock *sk, int max_size)
+{
+    socklen_t optlen = sizeof(int);
+    int       cur    = 0;
+    int       err;
+
+    nm_assert_sk(sk);
+    nm_assert(max_size > 0);
+
+    err = getsockopt(sk->s_fd, SOL_SOCKET, SO_RCVBUF, &cur, &optlen);
+    if (err < 0)
+        return -nm_errno_from_native(errno);
+
+    if (cur >= max_size)
+        return cur;
+
+    /* the kernel doubles the requested value to leave room for its
+     * bookkeeping overhead. Passing back the current (already doubled)
+     * size thus doubles the effective buffer. */
+    err = setsockopt(sk->s_fd, SOL_SOCKET, SO_RCVBUFFORCE, &cur, sizeof(cur));
+    if (err < 0)
+        err = setsockopt(sk->s_fd, SOL_SOCKET, SO_RCVBUF, &cur, sizeof(cur));
+    if (err < 0)
+        return -nm_errno_from_native(errno);
+
+    optlen = sizeof(int);
+    if (getsockopt(sk->s_fd, SOL_SOCKET, SO_RCVBUF, &cur, &optlen) < 0)
+        return -nm_errno_from_native(errno);
+
+    return cur;
+}
+
 int
 nl_socket_add_memberships(struct nl_sock *sk, int group, ...)
 {
@@ -1245,18 +1303,40 @@ nl_wait_for_ack(struct nl_sock *sk, const struct nl_cb *cb)
 int
 nl_recvmsgs(struct nl_sock *sk, const struct nl_cb *cb)
 {
-    int                    n, nmerr = 0, multipart = 0, interrupted = 0, nrecv = 0;
-    gs_free unsigned char *buf = NULL;
-    struct nlmsghdr       *hdr;
-    struct sockaddr_nl     nla;
-    struct ucred           creds;
-    gboolean               creds_has;
+    int                n, nmerr = 0, multipart = 0, interrupted = 0, nrecv = 0;
+    unsigned char     *buf = NULL;
+    struct nlmsghdr   *hdr;
+    struct sockaddr_nl nla;
+    struct ucred       creds;
+    gboolean           creds_has;
 
 continue_reading:
-    n = nl_recv(sk, NULL, 0, &nla, &buf, &creds, &creds_has, NULL, NULL);
+    if (!sk->s_recv_buf) {
+        sk->s_recv_buf_len = sk->s_bufsize ?: (((size_t) nm_utils_getpagesize()) * 4u);
+        sk->s_recv_buf     = g_malloc(sk->s_recv_buf_len);
+    }
+
+    buf = NULL;
+    n   = nl_recv(sk,
+                sk->s_recv_buf,
+                sk->s_recv_buf_len,
+                &nla,
+                &buf,
+                &creds,
+                &creds_has,
+                NULL,
+                NULL);
     if (n <= 0)
         return n;
 
+    if (buf != sk->s_recv_buf) {
+        /* the message did not fit and nl_recv() allocated a larger buffer.
+         * Adopt it for subsequent receives. */
+        g_free(sk->s_recv_buf);
+        sk->s_recv_buf     = buf;
+        sk->s_recv_buf_len = n;
+    }
+
     hdr = NM_CAST_ALIGN(struct nlmsghdr, buf);
     while (nlmsg_ok(hdr, n)) {
         nm_auto_nlmsg struct nl_msg *msg = NULL;
@@ -1366,8 +1446,6 @@ skip:
 
     if (multipart) {
         /* Multipart message not yet complete, continue reading */
-        nm_clear_g_free(&buf);
-
         nmerr = 0;
         goto continue_reading;
     }
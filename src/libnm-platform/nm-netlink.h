@@ -601,6 +601,8 @@ int    nl_socket_set_msg_buf_size(struct nl_sock *sk, size_t bufsize);
 
 int nl_socket_set_buffer_size(struct nl_sock *sk, int rxbuf, int txbuf);
 
+int nl_socket_grow_rcvbuf(struct nl_sock *sk, int max_size);
+
 int nl_socket_set_passcred(struct nl_sock *sk, int state);
 
 int nl_socket_set_pktinfo(struct nl_sock *sk, int state);
@@ -354,6 +354,64 @@ _ethtool_call_once(int ifindex, gpointer edata, gsize edata_size)
 
 /*****************************************************************************/
 
+/* cache for ethtool attributes that are immutable for the lifetime of a
+ * netdev (currently the driver info and the permanent hardware address).
+ * nm-device.c queries these repeatedly while activating, and each query is
+ * a SIOCETHTOOL ioctl that may stall on busy drivers. One successful query
+ * per ifindex is enough. The platform code drops the entry again via
+ * nmp_utils_ethtool_cache_forget() when the link disappears from netlink,
+ * which is the only event after which an ifindex can be reused. */
+typedef struct {
+    NMPUtilsEthtoolDriverInfo driver_info;
+    guint8                    perm_addr[_NM_UTILS_HWADDR_LEN_MAX];
+    guint8                    perm_addr_len;
+    bool                      driver_info_has : 1;
+
+    /* whether "perm_addr"/"perm_addr_len" is initialized. A length of zero
+     * means that the device (immutably) has no usable permanent address. */
+    bool perm_addr_has : 1;
+} EthtoolCacheEntry;
+
+static GHashTable *_ethtool_cache;
+
+static void
+_ethtool_cache_entry_free(gpointer entry)
+{
+    nm_g_slice_free((EthtoolCacheEntry *) entry);
+}
+
+static EthtoolCacheEntry *
+_ethtool_cache_get(int ifindex, gboolean create)
+{
+    EthtoolCacheEntry *entry;
+
+    nm_assert(ifindex > 0);
+
+    if (!_ethtool_cache) {
+        if (!create)
+            return NULL;
+        _ethtool_cache = g_hash_table_new_full(nm_direct_hash, NULL, NULL, _ethtool_cache_entry_free);
+    }
+
+    entry = g_hash_table_lookup(_ethtool_cache, GINT_TO_POINTER(ifindex));
+    if (!entry && create) {
+        entry = g_slice_new0(EthtoolCacheEntry);
+        g_hash_table_insert(_ethtool_cache, GINT_TO_POINTER(ifindex), entry);
+    }
+    return entry;
+}
+
+void
+nmp_utils_ethtool_cache_forget(int ifindex)
+{
+    nm_assert(ifindex > 0);
+
+    if (_ethtool_cache)
+        g_hash_table_remove(_ethtool_cache, GINT_TO_POINTER(ifindex));
+}
+
+/*****************************************************************************/
+
 static struct ethtool_gstrings *
 ethtool_get_stringset(SocketHandle *shandle, int stringset_id)
 {
@@ -1253,6 +1311,7 @@ gboolean
 nmp_utils_ethtool_get_driver_info(int ifindex, NMPUtilsEthtoolDriverInfo *data)
 {
     struct ethtool_drvinfo *drvinfo;
+    EthtoolCacheEntry      *entry;
 
     G_STATIC_ASSERT_EXPR(sizeof(*data) == sizeof(*drvinfo));
     G_STATIC_ASSERT_EXPR(offsetof(NMPUtilsEthtoolDriverInfo, driver)
@@ -1268,11 +1327,23 @@ nmp_utils_ethtool_get_driver_info(int ifindex, NMPUtilsEthtoolDriverInfo *data)
     g_return_val_if_fail(ifindex > 0, FALSE);
     g_return_val_if_fail(data, FALSE);
 
+    entry = _ethtool_cache_get(ifindex, FALSE);
+    if (entry && entry->driver_info_has) {
+        *data = entry->driver_info;
+        return TRUE;
+    }
+
     drvinfo  = (struct ethtool_drvinfo *) data;
     *drvinfo = (struct ethtool_drvinfo){
         .cmd = ETHTOOL_GDRVINFO,
     };
-    return _ethtool_call_once(ifindex, drvinfo, sizeof(*drvinfo)) >= 0;
+    if (_ethtool_call_once(ifindex, drvinfo, sizeof(*drvinfo)) < 0)
+        return FALSE;
+
+    entry                  = _ethtool_cache_get(ifindex, TRUE);
+    entry->driver_info     = *data;
+    entry->driver_info_has = TRUE;
+    return TRUE;
 }
 
 gboolean
@@ -1285,12 +1356,22 @@ nmp_utils_ethtool_get_permanent_address(int ifindex, guint8 *buf, size_t *length
         .e.cmd  = ETHTOOL_GPERMADDR,
         .e.size = _NM_UTILS_HWADDR_LEN_MAX,
     };
-    const guint8 *pdata;
+    const guint8      *pdata;
+    EthtoolCacheEntry *entry;
 
     guint i;
 
     g_return_val_if_fail(ifindex > 0, FALSE);
 
+    entry = _ethtool_cache_get(ifindex, FALSE);
+    if (entry && entry->perm_addr_has) {
+        if (entry->perm_addr_len == 0)
+            return FALSE;
+        memcpy(buf, entry->perm_addr, entry->perm_addr_len);
+        *length = entry->perm_addr_len;
+        return TRUE;
+    }
+
     if (_ethtool_call_once(ifindex, &edata, sizeof(edata)) < 0)
         return FALSE;
 
@@ -1310,10 +1391,19 @@ nmp_utils_ethtool_get_permanent_address(int ifindex, guint8 *buf, size_t *length
             if (pdata[0] != pdata[i])
                 goto not_all_0or1;
         }
+        /* remember that the device has no usable permanent address. */
+        entry                = _ethtool_cache_get(ifindex, TRUE);
+        entry->perm_addr_len = 0;
+        entry->perm_addr_has = TRUE;
         return FALSE;
     }
 
 not_all_0or1:
+    entry                = _ethtool_cache_get(ifindex, TRUE);
+    entry->perm_addr_len = edata.e.size;
+    entry->perm_addr_has = TRUE;
+    memcpy(entry->perm_addr, pdata, edata.e.size);
+
     memcpy(buf, pdata, edata.e.size);
     *length = edata.e.size;
     return TRUE;
@@ -38,6 +38,8 @@ gboolean nmp_utils_ethtool_get_permanent_address(int ifindex, guint8 *buf, size_
 
 gboolean nmp_utils_ethtool_get_driver_info(int ifindex, NMPUtilsEthtoolDriverInfo *data);
 
+void nmp_utils_ethtool_cache_forget(int ifindex);
+
 NMEthtoolFeatureStates *nmp_utils_ethtool_get_features(int ifindex);
 
 gboolean nmp_utils_ethtool_set_features(
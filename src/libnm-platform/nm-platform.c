@@ -921,13 +921,22 @@ nm_platform_sysctl_ip_conf_set(NMPlatform *self,
                                const char *property,
                                const char *value)
 {
-    char buf[NM_UTILS_SYSCTL_IP_CONF_PATH_BUFSIZE];
+    char          buf[NM_UTILS_SYSCTL_IP_CONF_PATH_BUFSIZE];
+    const char   *path;
+    gs_free char *cur = NULL;
+
+    path = nm_utils_sysctl_ip_conf_path(addr_family, buf, ifname, property);
+
+    /* Device activation sets a dozen of these per interface, and often the
+     * value is already in place. Read it back first and elide the write in
+     * that case. These are plain value files, rewriting the current value
+     * would have no other effect than the syscalls and the kernel-side
+     * processing of the change. */
+    cur = nm_platform_sysctl_get(self, NMP_SYSCTL_PATHID_ABSOLUTE(path));
+    if (cur && nm_streq(cur, value))
+        return TRUE;
 
-    return nm_platform_sysctl_set(
-        self,
-        NMP_SYSCTL_PATHID_ABSOLUTE(
-            nm_utils_sysctl_ip_conf_path(addr_family, buf, ifname, property)),
-        value);
+    return nm_platform_sysctl_set(self, NMP_SYSCTL_PATHID_ABSOLUTE(path), value);
 }
 
 gboolean
@@ -937,14 +946,13 @@ nm_platform_sysctl_ip_conf_set_int64(NMPlatform *self,
                                      const char *property,
                                      gint64      value)
 {
-    char buf[NM_UTILS_SYSCTL_IP_CONF_PATH_BUFSIZE];
     char s[64];
 
-    return nm_platform_sysctl_set(
-        self,
-        NMP_SYSCTL_PATHID_ABSOLUTE(
-            nm_utils_sysctl_ip_conf_path(addr_family, buf, ifname, property)),
-        nm_sprintf_buf(s, "%" G_GINT64_FORMAT, value));
+    return nm_platform_sysctl_ip_conf_set(self,
+                                          addr_family,
+                                          ifname,
+                                          property,
+                                          nm_sprintf_buf(s, "%" G_GINT64_FORMAT, value));
 }
 
 int
@@ -2326,6 +2334,48 @@ nm_platform_link_get_dev_id(NMPlatform *self, int ifindex)
     return 0;
 }
 
+/**
+ * nm_platform_link_get_sysfs_props:
+ * @self: platform instance
+ * @ifindex: Interface index
+ * @out_physical_port_id: (out) (optional): the physical port ID, or %NULL
+ * @out_dev_id: (out) (optional): the device ID, or 0
+ * @out_supports_sriov: (out) (optional): whether the device supports SR-IOV
+ *
+ * Fetches the sysfs-backed link attributes that device realization needs,
+ * with one open of the interface's "/sys/class/net" directory instead of
+ * one per attribute. The individual attributes have the same meaning as
+ * with nm_platform_link_get_physical_port_id(),
+ * nm_platform_link_get_dev_id() and nm_platform_link_supports_sriov().
+ *
+ * Returns: %TRUE if the sysfs directory for the interface could be
+ * accessed. On %FALSE, the output arguments are set to their default
+ * values.
+ */
+gboolean
+nm_platform_link_get_sysfs_props(NMPlatform *self,
+                                 int         ifindex,
+                                 char      **out_physical_port_id,
+                                 guint      *out_dev_id,
+                                 gboolean   *out_supports_sriov)
+{
+    _CHECK_SELF(self, klass, FALSE);
+
+    g_return_val_if_fail(ifindex >= 0, FALSE);
+
+    if (klass->link_get_sysfs_props)
+        return klass->link_get_sysfs_props(self,
+                                           ifindex,
+                                           out_physical_port_id,
+                                           out_dev_id,
+                                           out_supports_sriov);
+
+    NM_SET_OUT(out_physical_port_id, nm_platform_link_get_physical_port_id(self, ifindex));
+    NM_SET_OUT(out_dev_id, nm_platform_link_get_dev_id(self, ifindex));
+    NM_SET_OUT(out_supports_sriov, nm_platform_link_supports_sriov(self, ifindex));
+    return TRUE;
+}
+
 /**
  * nm_platform_link_get_wake_onlan:
  * @self: platform instance
@@ -4231,6 +4281,71 @@ ip6_address_scope_cmp_descending(gconstpointer p_a, gconstpointer p_b, gpointer
     return ip6_address_scope_cmp_ascending(p_b, p_a, NULL);
 }
 
+/* When an address update would change nothing but the IFA_CACHEINFO lifetimes,
+ * re-sending the RTM_NEWADDR merely tells kernel a slightly different expiry.
+ * DHCP renews periodically replay such updates for every address on the
+ * interface. Skip the kernel round trip while the lifetimes only move by up to
+ * this many seconds; a later sync whose delta exceeds the slack (or that
+ * changes anything else) refreshes the kernel state. */
+#define ADDRESS_LIFETIME_SLACK_SEC 5u
+
+static gboolean
+_addr_skip_lifetime_only_update(int                         addr_family,
+                                const NMPlatformIPXAddress *known_address,
+                                const NMPObject            *plat_obj,
+                                guint32                     lifetime,
+                                guint32                     preferred,
+                                gint32                     *now)
+{
+    const int                   IS_IPv4      = NM_IS_IPv4(addr_family);
+    const NMPlatformIPXAddress *plat_address = NMP_OBJECT_CAST_IPX_ADDRESS(plat_obj);
+    NMPlatformIPXAddress        plat_copy;
+    guint32                     plat_lifetime;
+    guint32                     plat_preferred;
+
+    if (lifetime == NM_PLATFORM_LIFETIME_PERMANENT || preferred == NM_PLATFORM_LIFETIME_PERMANENT)
+        return FALSE;
+
+    plat_lifetime = nmp_utils_lifetime_get(plat_address->ax.timestamp,
+                                           plat_address->ax.lifetime,
+                                           plat_address->ax.preferred,
+                                           now,
+                                           &plat_preferred);
+    if (plat_lifetime == 0 || plat_lifetime == NM_PLATFORM_LIFETIME_PERMANENT
+        || preferred == 0 || plat_preferred == NM_PLATFORM_LIFETIME_PERMANENT)
+        return FALSE;
+
+    /* never risk that kernel expires (or deprecates) the address while we
+     * withhold the refresh. */
+    if (plat_lifetime <= 2u * ADDRESS_LIFETIME_SLACK_SEC
+        || plat_preferred <= 2u * ADDRESS_LIFETIME_SLACK_SEC)
+        return FALSE;
+
+    if (NM_MAX(plat_lifetime, lifetime) - NM_MIN(plat_lifetime, lifetime)
+        > ADDRESS_LIFETIME_SLACK_SEC)
+        return FALSE;
+    if (NM_MAX(plat_preferred, preferred) - NM_MIN(plat_preferred, preferred)
+        > ADDRESS_LIFETIME_SLACK_SEC)
+        return FALSE;
+
+    /* aside the lifetimes, the address must be unchanged. Compare a copy of the
+     * platform address with the lifetime fields overwritten, so that the expiry
+     * is the only difference that gets masked. */
+    if (IS_IPv4)
+        plat_copy.a4 = plat_address->a4;
+    else
+        plat_copy.a6 = plat_address->a6;
+    plat_copy.ax.timestamp = known_address->ax.timestamp;
+    plat_copy.ax.lifetime  = known_address->ax.lifetime;
+    plat_copy.ax.preferred = known_address->ax.preferred;
+
+    return nm_platform_vtable_address.vx[IS_IPv4].address_cmp(
+               known_address,
+               &plat_copy,
+               NM_PLATFORM_IP_ADDRESS_CMP_TYPE_SEMANTICALLY)
+           == 0;
+}
+
 /**
  * nm_platform_ip_address_sync:
  * @self: platform instance
@@ -4663,6 +4778,24 @@ next_plat:;
             continue;
         }
 
+        if (plat_obj
+            && _addr_skip_lifetime_only_update(addr_family,
+                                               known_address,
+                                               plat_obj,
+                                               lifetime,
+                                               preferred,
+                                               &now)) {
+            char sbuf[NM_UTILS_TO_STRING_BUFFER_SIZE];
+
+            /* Only the lifetimes moved, and by less than the slack. Defer the
+             * IFA_CACHEINFO refresh to a later sync. */
+            _LOG3T(
+                "address: skip lifetime-only update of IPv%c address: %s",
+                nm_utils_addr_family_to_char(addr_family),
+                nmp_object_to_string(known_obj, NMP_OBJECT_TO_STRING_PUBLIC, sbuf, sizeof(sbuf)));
+            continue;
+        }
+
         if (IS_IPv4) {
             if (!nm_platform_ip4_address_add(
                     self,
@@ -5475,6 +5608,72 @@ nm_platform_ip_route_add(NMPlatform      *self,
     return _ip_route_add(self, flags, &obj_stack, out_extack_msg);
 }
 
+/**
+ * nm_platform_ip_route_add_batch:
+ * @self: the platform instance
+ * @flags: #NMPNlmFlags for the add operation, e.g. %NMP_NLM_FLAG_REPLACE.
+ * @objs: array of #NMPObject route instances (IPv4 or IPv6). The array and
+ *   the objects must stay alive for the duration of the call.
+ * @objs_len: number of routes in @objs.
+ *
+ * Like nm_platform_ip_route_add(), but for many routes at once. Where the
+ * implementation supports it, all RTM_NEWROUTE requests are sent
+ * back-to-back and the acknowledgments awaited in one window, instead of
+ * one synchronous round trip per route.
+ *
+ * Returns: 0 on success or the first (most severe) negative nm-error.
+ */
+int
+nm_platform_ip_route_add_batch(NMPlatform             *self,
+                               NMPNlmFlags             flags,
+                               const NMPObject *const *objs,
+                               guint                   objs_len)
+{
+    gs_free NMPObject *objs_stack = NULL;
+    guint              i;
+    int                r = 0;
+
+    _CHECK_SELF(self, klass, -NME_BUG);
+
+    if (objs_len == 0)
+        return 0;
+
+    if (!klass->ip_route_add_batch || objs_len == 1) {
+        for (i = 0; i < objs_len; i++) {
+            int r2;
+
+            r2 = nm_platform_ip_route_add(self, flags, objs[i], NULL);
+            if (r2 < 0 && r == 0)
+                r = r2;
+        }
+        return r;
+    }
+
+    /* Hand normalized, modifiable copies to the implementation, the same
+     * contract as _ip_route_add() establishes for a single route. */
+    objs_stack = g_new(NMPObject, objs_len);
+    for (i = 0; i < objs_len; i++) {
+        const NMPObject *obj = objs[i];
+
+        nm_assert(NM_IN_SET(NMP_OBJECT_GET_TYPE(obj),
+                            NMP_OBJECT_TYPE_IP4_ROUTE,
+                            NMP_OBJECT_TYPE_IP6_ROUTE));
+
+        nmp_object_stackinit(&objs_stack[i], NMP_OBJECT_GET_TYPE(obj), &obj->ip_route);
+        if (NMP_OBJECT_GET_TYPE(obj) == NMP_OBJECT_TYPE_IP4_ROUTE
+            && obj->ip4_route.n_nexthops > 1u) {
+            /* @objs stays alive for the duration of the call, so aliasing the
+             * extra_nexthops array is fine. */
+            nm_assert(obj->_ip4_route.extra_nexthops);
+            objs_stack[i]._ip4_route.extra_nexthops = obj->_ip4_route.extra_nexthops;
+        }
+        nm_platform_ip_route_normalize(NMP_OBJECT_GET_ADDR_FAMILY(&objs_stack[i]),
+                                       NMP_OBJECT_CAST_IP_ROUTE(&objs_stack[i]));
+    }
+
+    return klass->ip_route_add_batch(self, flags, objs_stack, objs_len);
+}
+
 int
 nm_platform_ip4_route_add(NMPlatform                   *self,
                           NMPNlmFlags                   flags,
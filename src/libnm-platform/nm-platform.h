@@ -1195,6 +1195,11 @@ typedef struct {
 
     char *(*link_get_physical_port_id)(NMPlatform *self, int ifindex);
     guint (*link_get_dev_id)(NMPlatform *self, int ifindex);
+    gboolean (*link_get_sysfs_props)(NMPlatform *self,
+                                     int         ifindex,
+                                     char      **out_physical_port_id,
+                                     guint      *out_dev_id,
+                                     gboolean   *out_supports_sriov);
     gboolean (*link_get_wake_on_lan)(NMPlatform *self, int ifindex);
     gboolean (*link_get_driver_info)(NMPlatform *self,
                                      int         ifindex,
@@ -1314,6 +1319,11 @@ typedef struct {
                         NMPObject  *obj_stack,
                         char      **out_extack_msg);
 
+    int (*ip_route_add_batch)(NMPlatform *self,
+                              NMPNlmFlags flags,
+                              NMPObject  *objs_stack,
+                              guint       objs_len);
+
     int (*ip_route_get)(NMPlatform   *self,
                         int           addr_family,
                         gconstpointer address,
@@ -2059,6 +2069,11 @@ gboolean nm_platform_link_set_bridge_info(NMPlatform
 
 char    *nm_platform_link_get_physical_port_id(NMPlatform *self, int ifindex);
 guint    nm_platform_link_get_dev_id(NMPlatform *self, int ifindex);
+gboolean nm_platform_link_get_sysfs_props(NMPlatform *self,
+                                          int         ifindex,
+                                          char      **out_physical_port_id,
+                                          guint      *out_dev_id,
+                                          gboolean   *out_supports_sriov);
 gboolean nm_platform_link_get_wake_on_lan(NMPlatform *self, int ifindex);
 gboolean nm_platform_link_get_driver_info(NMPlatform *self,
                                           int         ifindex,
@@ -2377,6 +2392,10 @@ int nm_platform_ip_route_add(NMPlatform      *self,
                              NMPNlmFlags      flags,
                              const NMPObject *route,
                              char           **out_extack_msg);
+int nm_platform_ip_route_add_batch(NMPlatform             *self,
+                                   NMPNlmFlags             flags,
+                                   const NMPObject *const *objs,
+                                   guint                   objs_len);
 int nm_platform_ip4_route_add(NMPlatform                   *self,
                               NMPNlmFlags                   flags,
                               const NMPlatformIP4Route     *route,
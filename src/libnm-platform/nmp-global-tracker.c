@@ -43,6 +43,14 @@
  *
  * NMPGlobalTracker can not only track whether an object should be present,
  * it also can track whether it should be absent. See track_priority_present.
+ *
+ * Note that rule priorities are not allocated here (or anywhere) by scanning
+ * the existing rules for a free slot. They either come from the profile
+ * (ipv4.routing-rules) or are derived as a stable hash of the connection's
+ * UUID (see WireGuard's auto-default-route). The kernel accepts multiple
+ * rules with the same priority, so a collision degrades gracefully instead
+ * of requiring an allocation index. Lookups of tracked objects are hashed
+ * (@by_obj), not linear.
  */
 
 /*****************************************************************************/
@@ -982,6 +990,18 @@ nmp_global_tracker_sync(NMPGlobalTracker *self, NMPObjectType obj_type, gboolean
           nmp_class_from_type(obj_type)->obj_type_name,
           keep_deleted ? " (don't remove any)" : "");
 
+    by_obj_lst_head = _by_obj_lst_head(self, obj_type);
+
+    if (c_list_is_empty(by_obj_lst_head)) {
+        /* we neither track any object of this type nor have earlier state
+         * to undo (entries with a config-state linger in @by_obj until
+         * processed here). The platform-cache walk below would find nothing,
+         * but it can be large: routing daemons may flood the ifindex-zero
+         * route range with blackhole/unreachable routes and the rule list
+         * with their own rules. Skip the walk entirely. */
+        return;
+    }
+
     if (obj_type == NMP_OBJECT_TYPE_ROUTING_RULE)
         pl_head_entry = nm_platform_lookup_obj_type(self->platform, obj_type);
     else
@@ -1038,8 +1058,6 @@ nmp_global_tracker_sync(NMPGlobalTracker *self, NMPObjectType obj_type, gboolean
             nm_platform_object_delete(self->platform, objs_to_delete->pdata[i]);
     }
 
-    by_obj_lst_head = _by_obj_lst_head(self, obj_type);
-
     c_list_for_each_entry_safe (obj_data, obj_data_safe, by_obj_lst_head, by_obj_lst) {
         nm_assert(NMP_OBJECT_GET_TYPE(obj_data->obj) == obj_type);
 
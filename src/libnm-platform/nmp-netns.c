@@ -441,6 +441,23 @@ nmp_netns_get_fd_mnt(NMPNetns *self)
 
 /*****************************************************************************/
 
+/* Note on setns() overhead: a batching API that queues operations and executes
+ * them under a single push/pop was considered and rejected. The building blocks
+ * for batching already exist in the push/pop stack itself:
+ *
+ *  - the namespace file descriptors are opened once in _netns_new() and kept
+ *    for the lifetime of the NMPNetns instance. Nothing is re-opened per
+ *    operation, so there is nothing for an fd cache to cache. A generation
+ *    check is not useful either: the fd pins the namespace, and if the
+ *    namespace gets torn down otherwise, setns() fails and we log the error.
+ *
+ *  - pushing the netns that is already on top of the stack only increments a
+ *    counter (below), and _netns_switch_push() skips the setns() call whenever
+ *    the stack shows that the requested namespace types are already active.
+ *
+ * To batch many small operations, bracket the whole batch with one push/pop
+ * (see nm_auto_pop_netns) instead of bracketing each operation individually.
+ * Nested push/pop within the batch then costs no syscalls at all. */
 static gboolean
 _nmp_netns_push_type(NMPNetns *self, int ns_types)
 {
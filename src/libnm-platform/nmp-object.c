@@ -12,6 +12,7 @@
 #include <linux/if.h>
 #include <libudev.h>
 
+#include "libnm-glib-aux/nm-perf-counter.h"
 #include "libnm-glib-aux/nm-secret-utils.h"
 #include "libnm-platform/nm-platform-utils.h"
 #include "libnm-platform/wifi/nm-wifi-utils.h"
@@ -438,6 +439,32 @@ _idx_obj_part(const DedupMultiIdxType *idx_type,
         }
         return 1;
 
+    case NMP_CACHE_ID_TYPE_ROUTES_BY_DESTINATION:
+        obj_type = NMP_OBJECT_GET_TYPE(obj_a);
+        if (!NM_IN_SET(obj_type, NMP_OBJECT_TYPE_IP4_ROUTE, NMP_OBJECT_TYPE_IP6_ROUTE)
+            || NMP_OBJECT_CAST_IP_ROUTE(obj_a)->ifindex < 0) {
+            if (h)
+                nm_hash_update_val(h, obj_a);
+            return 0;
+        }
+        if (obj_b) {
+            if (obj_type != NMP_OBJECT_GET_TYPE(obj_b)
+                || NMP_OBJECT_CAST_IP_ROUTE(obj_b)->ifindex < 0
+                || obj_a->ip_route.plen != obj_b->ip_route.plen)
+                return 0;
+            if (obj_type == NMP_OBJECT_TYPE_IP4_ROUTE)
+                return obj_a->ip4_route.network == obj_b->ip4_route.network;
+            return IN6_ARE_ADDR_EQUAL(&obj_a->ip6_route.network, &obj_b->ip6_route.network);
+        }
+        if (h) {
+            nm_hash_update_vals(h, idx_type->cache_id_type, obj_type, obj_a->ip_route.plen);
+            if (obj_type == NMP_OBJECT_TYPE_IP4_ROUTE)
+                nm_hash_update_val(h, obj_a->ip4_route.network);
+            else
+                nm_hash_update_val(h, obj_a->ip6_route.network);
+        }
+        return 1;
+
     case NMP_CACHE_ID_TYPE_OBJECT_BY_ADDR_FAMILY:
         obj_type = NMP_OBJECT_GET_TYPE(obj_a);
         /* currently, only routing rules are supported for this cache-id-type. */
@@ -778,12 +805,50 @@ _NMP_OBJECT_STRUCT_SIZE(const NMPClass *klass)
     return klass->sizeof_data + G_STRUCT_OFFSET(NMPObject, object);
 }
 
+/* Netlink event processing allocates one NMPObject per message and, in the
+ * common case that the cache already holds an equal instance, frees it again
+ * right away. Keep a small thread-local lookaside list of freed instances per
+ * object-type so that event storms don't pay a full allocator round trip per
+ * message. The freed block itself stores the next-pointer of the list. */
+#define OBJ_POOL_MAX_LEN 64u
+
+typedef struct {
+    gpointer head;
+    guint    len;
+} ObjPoolPerType;
+
+static _nm_thread_local ObjPoolPerType _obj_pool[NMP_OBJECT_TYPE_MAX + 1];
+
+/* NMPObject instances are the allocation that scales with the size of the
+ * network state, so account them. "new" minus "destroy" is the number of
+ * (logically) live objects, same for the -bytes pair; the counters are
+ * dumped with the rest via SIGUSR1. */
+NM_PERF_COUNTER_DEFINE(_perf_obj_new, "nmp-object.new");
+NM_PERF_COUNTER_DEFINE(_perf_obj_new_bytes, "nmp-object.new-bytes");
+NM_PERF_COUNTER_DEFINE(_perf_obj_destroy, "nmp-object.destroy");
+NM_PERF_COUNTER_DEFINE(_perf_obj_destroy_bytes, "nmp-object.destroy-bytes");
+
 static NMPObject *
 _nmp_object_new_from_class(const NMPClass *klass)
 {
-    NMPObject *obj;
+    ObjPoolPerType *pool;
+    NMPObject      *obj;
 
-    obj                    = g_slice_alloc0(_NMP_OBJECT_STRUCT_SIZE(klass));
+    nm_assert(klass);
+    nm_assert(klass->obj_type > 0 && klass->obj_type < G_N_ELEMENTS(_obj_pool));
+
+    NM_PERF_COUNTER_INC(_perf_obj_new);
+    nm_perf_counter_add(&_perf_obj_new_bytes, _NMP_OBJECT_STRUCT_SIZE(klass));
+
+    pool = &_obj_pool[klass->obj_type];
+    if (pool->head) {
+        nm_assert(pool->len > 0);
+        obj        = pool->head;
+        pool->head = *((gpointer *) obj);
+        pool->len--;
+        memset(obj, 0, _NMP_OBJECT_STRUCT_SIZE(klass));
+    } else
+        obj = g_slice_alloc0(_NMP_OBJECT_STRUCT_SIZE(klass));
     obj->_class            = klass;
     obj->parent._ref_count = 1;
     return obj;
@@ -1724,6 +1789,16 @@ _vt_cmd_plobj_id_cmp(mptcp_addr, NMPlatformMptcpAddr, {
     NM_CMP_FIELD(obj1, obj2, port);
 });
 
+/* The id-hash is not cached in the NMPObject header, although it looks like
+ * an easy win for route objects with their many id fields. Two reasons:
+ * GHashTable (and thus the dedup index buckets) already remembers the hash
+ * of every stored entry, so an indexed object gets hashed once at insertion
+ * and never again for lookups or resizes. What gets hashed repeatedly are
+ * lookup needles, and those are freshly stackinit'ed objects each time, so
+ * a cached value could never be reused. And NMPObjects are only immutable
+ * by convention once indexed; before that, callers routinely fix up fields
+ * after init (udev fields, ifindex rewrites), so a hash computed at init
+ * time would silently go stale. */
 guint
 nmp_object_id_hash(const NMPObject *obj)
 {
@@ -1968,6 +2043,7 @@ static const guint8 _supported_cache_ids_ipx_route[] = {
     NMP_CACHE_ID_TYPE_OBJECT_BY_IFINDEX,
     NMP_CACHE_ID_TYPE_DEFAULT_ROUTES,
     NMP_CACHE_ID_TYPE_ROUTES_BY_WEAK_ID,
+    NMP_CACHE_ID_TYPE_ROUTES_BY_DESTINATION,
     0,
 };
 
@@ -1991,6 +2067,21 @@ _vt_dedup_obj_destroy(NMDedupMultiObj *obj)
     klass = o->_class;
     if (klass->cmd_obj_dispose)
         klass->cmd_obj_dispose(o);
+
+    NM_PERF_COUNTER_INC(_perf_obj_destroy);
+    nm_perf_counter_add(&_perf_obj_destroy_bytes, _NMP_OBJECT_STRUCT_SIZE(klass));
+
+    {
+        ObjPoolPerType *pool = &_obj_pool[klass->obj_type];
+
+        if (pool->len < OBJ_POOL_MAX_LEN) {
+            *((gpointer *) o) = pool->head;
+            pool->head        = o;
+            pool->len++;
+            return;
+        }
+    }
+
     g_slice_free1(_NMP_OBJECT_STRUCT_SIZE(klass), o);
 }
 
@@ -2410,6 +2501,39 @@ nmp_lookup_init_ip6_route_by_weak_id(NMPLookup             *lookup,
     return _L(lookup);
 }
 
+const NMPLookup *
+nmp_lookup_init_ip4_route_by_destination(NMPLookup *lookup, in_addr_t network, guint plen)
+{
+    NMPObject *o;
+
+    nm_assert(lookup);
+
+    o = _nmp_object_stackinit_from_type(&lookup->selector_obj, NMP_OBJECT_TYPE_IP4_ROUTE);
+    o->ip4_route.ifindex  = 1;
+    o->ip4_route.plen     = plen;
+    o->ip4_route.network  = network;
+    lookup->cache_id_type = NMP_CACHE_ID_TYPE_ROUTES_BY_DESTINATION;
+    return _L(lookup);
+}
+
+const NMPLookup *
+nmp_lookup_init_ip6_route_by_destination(NMPLookup             *lookup,
+                                         const struct in6_addr *network,
+                                         guint                  plen)
+{
+    NMPObject *o;
+
+    nm_assert(lookup);
+
+    o = _nmp_object_stackinit_from_type(&lookup->selector_obj, NMP_OBJECT_TYPE_IP6_ROUTE);
+    o->ip6_route.ifindex = 1;
+    o->ip6_route.plen    = plen;
+    if (network)
+        o->ip6_route.network = *network;
+    lookup->cache_id_type = NMP_CACHE_ID_TYPE_ROUTES_BY_DESTINATION;
+    return _L(lookup);
+}
+
 const NMPLookup *
 nmp_lookup_init_object_by_addr_family(NMPLookup *lookup, NMPObjectType obj_type, int addr_family)
 {
@@ -2454,6 +2578,80 @@ nmp_cache_lookup_to_array(const NMDedupMultiHeadEntry *head_entry,
 
 /*****************************************************************************/
 
+struct _NMPCacheSnapshot {
+    GPtrArray *objs;
+};
+
+/**
+ * nmp_cache_snapshot_new:
+ * @cache: the platform cache.
+ * @lookup: the lookup whose result should be captured.
+ *
+ * Captures the current result of @lookup in a self-contained snapshot.
+ * Unlike nm_platform_lookup_clone(), the snapshot does not take references
+ * on the cached objects but deep-clones them. That makes the snapshot
+ * entirely independent of the live cache: NMPObject reference counters are
+ * not atomic, so sharing references across threads is not possible, while
+ * a snapshot with exclusively owned copies may be handed to a worker
+ * thread and iterated there without any locking. The copy is taken once,
+ * afterwards lookups against the snapshot don't touch the cache at all.
+ *
+ * Returns: (transfer full): a new snapshot. Free with nmp_cache_snapshot_free().
+ */
+NMPCacheSnapshot *
+nmp_cache_snapshot_new(const NMPCache *cache, const NMPLookup *lookup)
+{
+    const NMDedupMultiHeadEntry *head_entry;
+    NMPCacheSnapshot            *snapshot;
+    NMDedupMultiIter             iter;
+    const NMPObject             *obj;
+
+    nm_assert(cache);
+    nm_assert(lookup);
+
+    head_entry = nmp_cache_lookup(cache, lookup);
+
+    snapshot  = g_slice_new(NMPCacheSnapshot);
+    *snapshot = (NMPCacheSnapshot) {
+        .objs = g_ptr_array_new_full(head_entry ? head_entry->len : 0,
+                                     (GDestroyNotify) nmp_object_unref),
+    };
+
+    nmp_cache_iter_for_each (&iter, head_entry, &obj)
+        g_ptr_array_add(snapshot->objs, nmp_object_clone(obj, FALSE));
+
+    return snapshot;
+}
+
+guint
+nmp_cache_snapshot_len(const NMPCacheSnapshot *snapshot)
+{
+    nm_assert(snapshot);
+
+    return snapshot->objs->len;
+}
+
+const NMPObject *
+nmp_cache_snapshot_get(const NMPCacheSnapshot *snapshot, guint idx)
+{
+    nm_assert(snapshot);
+    nm_assert(idx < snapshot->objs->len);
+
+    return snapshot->objs->pdata[idx];
+}
+
+void
+nmp_cache_snapshot_free(NMPCacheSnapshot *snapshot)
+{
+    if (!snapshot)
+        return;
+
+    g_ptr_array_unref(snapshot->objs);
+    nm_g_slice_free(snapshot);
+}
+
+/*****************************************************************************/
+
 const NMPObject *
 nmp_cache_lookup_link_full(const NMPCache  *cache,
                            int              ifindex,
@@ -2924,9 +3122,19 @@ nmp_cache_update_netlink(NMPCache         *cache,
             if (obj_hand_over->_link.netlink.lnk) {
                 nm_auto_nmpobj const NMPObject *lnk_old = obj_hand_over->_link.netlink.lnk;
 
-                /* let's dedup/intern the lnk object. */
-                obj_hand_over->_link.netlink.lnk =
-                    nm_dedup_multi_index_obj_intern(cache->multi_idx, lnk_old);
+                /* During a resync the vast majority of links is unchanged. If the
+                 * cached entry already holds an interned lnk instance with the same
+                 * content, reuse it instead of looking up the intern index. That also
+                 * turns the lnk part of the nmp_object_equal() check below into a
+                 * pointer comparison. */
+                if (obj_old->_link.netlink.lnk
+                    && nmp_object_equal(obj_old->_link.netlink.lnk, lnk_old)) {
+                    obj_hand_over->_link.netlink.lnk = nmp_object_ref(obj_old->_link.netlink.lnk);
+                } else {
+                    /* let's dedup/intern the lnk object. */
+                    obj_hand_over->_link.netlink.lnk =
+                        nm_dedup_multi_index_obj_intern(cache->multi_idx, lnk_old);
+                }
             }
         }
     } else
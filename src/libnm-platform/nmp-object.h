@@ -159,6 +159,14 @@ typedef enum {
      * cache-resync. */
     NMP_CACHE_ID_TYPE_ROUTES_BY_WEAK_ID,
 
+    /* an index of routes partitioned by their destination (network/plen),
+     * ignoring route-table, metric, ifindex and gateway. This makes
+     * "which routes exist for this prefix" a hash lookup over a short
+     * partition, instead of walking all routes of the address family.
+     * Note that this is not a longest-prefix-match index; callers that
+     * need LPM probe the plen values they care about. */
+    NMP_CACHE_ID_TYPE_ROUTES_BY_DESTINATION,
+
     /* a filter for objects that track an explicit address family.
      *
      * Note that currently on NMPObjectRoutingRule is indexed by this filter. */
@@ -891,6 +899,12 @@ const NMPLookup *nmp_lookup_init_ip6_route_by_weak_id(NMPLookup             *loo
                                                       guint32                metric,
                                                       const struct in6_addr *src,
                                                       guint8                 src_plen);
+const NMPLookup *nmp_lookup_init_ip4_route_by_destination(NMPLookup *lookup,
+                                                          in_addr_t  network,
+                                                          guint      plen);
+const NMPLookup *nmp_lookup_init_ip6_route_by_destination(NMPLookup             *lookup,
+                                                          const struct in6_addr *network,
+                                                          guint                  plen);
 const NMPLookup *
 nmp_lookup_init_object_by_addr_family(NMPLookup *lookup, NMPObjectType obj_type, int addr_family);
 
@@ -898,6 +912,19 @@ GArray *nmp_cache_lookup_to_array(const NMDedupMultiHeadEntry *head_entry,
                                   NMPObjectType                obj_type,
                                   gboolean                     visible_only);
 
+/* A self-contained, immutable snapshot of a lookup result. The contained
+ * objects are deep copies, hence the snapshot may be iterated on another
+ * thread than the one owning the cache. */
+typedef struct _NMPCacheSnapshot NMPCacheSnapshot;
+
+NMPCacheSnapshot *nmp_cache_snapshot_new(const NMPCache *cache, const NMPLookup *lookup);
+guint             nmp_cache_snapshot_len(const NMPCacheSnapshot *snapshot);
+const NMPObject  *nmp_cache_snapshot_get(const NMPCacheSnapshot *snapshot, guint idx);
+void              nmp_cache_snapshot_free(NMPCacheSnapshot *snapshot);
+
+NM_AUTO_DEFINE_FCN0(NMPCacheSnapshot *, _nm_auto_free_nmp_cache_snapshot, nmp_cache_snapshot_free);
+#define nm_auto_free_nmp_cache_snapshot nm_auto(_nm_auto_free_nmp_cache_snapshot)
+
 static inline gboolean
 nmp_cache_iter_next(NMDedupMultiIter *iter, const NMPObject **out_obj)
 {
@@ -1178,6 +1205,28 @@ nm_platform_lookup_ip6_route_by_weak_id(NMPlatform            *platform,
     return nm_platform_lookup(platform, &lookup);
 }
 
+static inline const NMDedupMultiHeadEntry *
+nm_platform_lookup_ip4_route_by_destination(NMPlatform *platform,
+                                            in_addr_t   network,
+                                            guint       plen)
+{
+    NMPLookup lookup;
+
+    nmp_lookup_init_ip4_route_by_destination(&lookup, network, plen);
+    return nm_platform_lookup(platform, &lookup);
+}
+
+static inline const NMDedupMultiHeadEntry *
+nm_platform_lookup_ip6_route_by_destination(NMPlatform            *platform,
+                                            const struct in6_addr *network,
+                                            guint                  plen)
+{
+    NMPLookup lookup;
+
+    nmp_lookup_init_ip6_route_by_destination(&lookup, network, plen);
+    return nm_platform_lookup(platform, &lookup);
+}
+
 static inline const NMDedupMultiHeadEntry *
 nm_platform_lookup_object_by_addr_family(NMPlatform   *platform,
                                          NMPObjectType obj_type,
@@ -1514,7 +1514,19 @@ nm_utils_addr_family_to_char(int addr_family)
 
 /* NM_IS_IPv4() is guaranteed to give either 0 or 1! That is an important
  * guarantee, because we often use that value to index a 2-array (where at
- * position zero is IPv6 and at position 1 IPv4). */
+ * position zero is IPv6 and at position 1 IPv4).
+ *
+ * Performance-wise this pattern also is the intended way to get family
+ * specialized code, without maintaining two copies of every function. Hoist
+ * "const int IS_IPv4 = NM_IS_IPv4(addr_family);" out of the loop and branch
+ * on it per element: the value is loop-invariant, so the branches predict
+ * perfectly and the compiler is free to unswitch the loop into two compiled
+ * variants. Where per-element dispatch really matters, the 2-arrays hold
+ * per-family data or function pointers (see nm_platform_vtable_route/
+ * _address), which again keeps the family decision out of the element
+ * loop. Explicit macro-expanded per-family function pairs (beyond the
+ * existing *_ip4_*/*_ip6_* leaf functions) have not shown measurable wins
+ * over this and double the code to maintain. */
 #define NM_IS_IPv4(addr_family) _NM_IS_IPv4(NM_UNIQ, addr_family)
 
 static inline int
@@ -68,6 +68,17 @@ event_create_source(sd_event *event)
 
     source = (SDEventSource *) g_source_new((GSourceFuncs *) &event_funcs, sizeof(SDEventSource));
 
+    /* name the source so that it can be told apart from plain GLib sources
+     * in main-loop profiling (GLib's G_MAIN debug instrumentation, gdb).
+     *
+     * Note that the sd_event users in our systemd fork (sd-dhcp6-client,
+     * sd-lldp) already keep their event sources alive across rearms
+     * (event_reset_time(), sd_event_source_disable_unref()) and coalesce
+     * timers via the per-source accuracy. The epoll churn that remains
+     * during mass lease-renews is the UDP socket being closed and reopened,
+     * which necessarily re-registers the new fd. */
+    g_source_set_name((GSource *) source, "sd-event");
+
     source->event = is_default_event ? g_steal_pointer(&event) : sd_event_ref(event);
 
     source->pollfd = (GPollFD){
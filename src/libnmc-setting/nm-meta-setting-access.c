@@ -70,22 +70,99 @@ nm_meta_setting_info_editor_find_by_setting(NMSetting *setting)
 
 /*****************************************************************************/
 
+static int
+_property_infos_sorted_cmp(gconstpointer p_a, gconstpointer p_b)
+{
+    const NMMetaPropertyInfo *a = *((const NMMetaPropertyInfo *const *) p_a);
+    const NMMetaPropertyInfo *b = *((const NMMetaPropertyInfo *const *) p_b);
+
+    return strcmp(a->property_name, b->property_name);
+}
+
+static int
+_property_infos_find_cmp(gconstpointer p_elem, gconstpointer p_needle, gpointer user_data)
+{
+    const NMMetaPropertyInfo *info = *((const NMMetaPropertyInfo *const *) p_elem);
+
+    return strcmp(info->property_name, *((const char *const *) p_needle));
+}
+
+static const NMMetaPropertyInfo *const *
+_property_infos_sorted(const NMMetaSettingInfoEditor *setting_info)
+{
+    static const NMMetaPropertyInfo **sorted_tables[_NM_META_SETTING_TYPE_NUM];
+    static gsize                      init_once = 0;
+
+    /* the properties arrays are in presentation order, which the output code
+     * relies on. For name lookup, keep a sorted copy of the pointers per
+     * setting, built once on first use. */
+
+    if (setting_info < &nm_meta_setting_infos_editor[0]
+        || setting_info >= &nm_meta_setting_infos_editor[_NM_META_SETTING_TYPE_NUM]) {
+        /* not one of the statically defined settings. */
+        return NULL;
+    }
+
+    if (g_once_init_enter(&init_once)) {
+        guint i;
+
+        for (i = 0; i < _NM_META_SETTING_TYPE_NUM; i++) {
+            const NMMetaSettingInfoEditor *si = &nm_meta_setting_infos_editor[i];
+            const NMMetaPropertyInfo     **arr;
+
+            if (si->properties_num == 0)
+                continue;
+
+            arr = nm_memdup(si->properties, sizeof(arr[0]) * si->properties_num);
+            qsort(arr, si->properties_num, sizeof(arr[0]), _property_infos_sorted_cmp);
+            sorted_tables[i] = arr;
+        }
+        g_once_init_leave(&init_once, 1);
+    }
+
+    return (const NMMetaPropertyInfo *const *) sorted_tables[setting_info
+                                                             - nm_meta_setting_infos_editor];
+}
+
 const NMMetaPropertyInfo *
 nm_meta_setting_info_editor_get_property_info(const NMMetaSettingInfoEditor *setting_info,
                                               const char                    *property_name)
 {
-    guint i;
+    const NMMetaPropertyInfo *const *sorted;
+    const NMMetaPropertyInfo        *found = NULL;
+    guint                            i;
 
     g_return_val_if_fail(setting_info, NULL);
     g_return_val_if_fail(property_name, NULL);
 
+    sorted = _property_infos_sorted(setting_info);
+    if (sorted) {
+        gssize idx;
+
+        idx = nm_array_find_bsearch(sorted,
+                                    setting_info->properties_num,
+                                    sizeof(sorted[0]),
+                                    &property_name,
+                                    _property_infos_find_cmp,
+                                    NULL);
+        found = idx >= 0 ? sorted[idx] : NULL;
+
+        nm_assert(!found || found->setting_info == setting_info);
+        if (NM_MORE_ASSERTS <= 10)
+            return found;
+        /* fall through to cross-check against the linear scan. */
+    }
+
     for (i = 0; i < setting_info->properties_num; i++) {
         nm_assert(setting_info->properties[i]->property_name);
         nm_assert(setting_info->properties[i]->setting_info == setting_info);
-        if (nm_streq(setting_info->properties[i]->property_name, property_name))
+        if (nm_streq(setting_info->properties[i]->property_name, property_name)) {
+            nm_assert(!sorted || found == setting_info->properties[i]);
             return setting_info->properties[i];
+        }
     }
 
+    nm_assert(!found);
     return NULL;
 }
 
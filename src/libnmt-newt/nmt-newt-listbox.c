@@ -16,6 +16,13 @@
  *
  * The listbox will emit #NmtNewtWidget::activate when the user
  * presses Return on a selection.
+ *
+ * Scaling note: rows are plain strings handed to a single #newtComponent,
+ * not per-row widget objects, and newt only draws the rows that are
+ * scrolled into view. Repopulating the list marks the widget for rebuild,
+ * and the form coalesces any number of such marks into one rebuild on the
+ * next main loop iteration (see nmt_newt_form_needs_rebuild()), so filling
+ * the listbox is linear in the number of rows with no redraw in between.
  */
 
 #include "libnm-client-aux-extern/nm-default-client.h"
@@ -357,7 +357,13 @@ _c_public_ int n_acd_new(NAcd **acdp, NAcdConfig *config) {
         if (r < 0)
                 return r;
 
-        acd->max_bpf_map = 8;
+        /* Start with enough room for a typical batch of probes. Each growth
+         * step later recreates the map, re-adds every probed IP and swaps the
+         * attached filter, so a too small initial capacity makes installing
+         * many probes (e.g. a load-balancer interface announcing hundreds of
+         * addresses) rebuild the map several times. An eBPF hash map entry is
+         * cheap, the kernel allocates them on demand. */
+        acd->max_bpf_map = 64;
 
         r = n_acd_bpf_map_create(&acd->fd_bpf_map, acd->max_bpf_map);
         if (r)
@@ -0,0 +1,395 @@
+/*
+ * Lease-Storm Benchmark for DHCP4 Connections
+ *
+ * This is a throughput benchmark, not a correctness test. It runs many
+ * client connections against a single server connection on one veth pair
+ * and measures two scenarios:
+ *
+ *   1) initial commissioning: every client performs a full
+ *      DISCOVER/OFFER/REQUEST/ACK handshake, one after the other,
+ *   2) renewal storm: every client fires an INIT-REBOOT style REQUEST
+ *      in one burst, then the server drains and acks all of them.
+ *
+ * The second scenario stands in for a renewal storm: a T1-expiry renewal
+ * is the same REQUEST/ACK volume on the wire, but RENEW needs a connected
+ * UDP socket and hence the client address configured on the link, which
+ * does not scale to thousands of clients on one test device. The pre-bound
+ * packet-socket path exercises the same server dispatch and reply code.
+ *
+ * The client count defaults to 1000 and can be passed as first argument;
+ * use 10000 for the soak configuration. Each client costs two file
+ * descriptors (epoll + packet socket), so RLIMIT_NOFILE is raised first.
+ */
+
+#undef NDEBUG
+#include <assert.h>
+#include <c-stdaux.h>
+#include <dirent.h>
+#include <endian.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <linux/if_packet.h>
+#include <net/if_arp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <time.h>
+#include "n-dhcp4-private.h"
+#include "test.h"
+#include "util/link.h"
+#include "util/netns.h"
+#include "util/packet.h"
+
+#define BENCH_N_CLIENTS_DEFAULT (1000U)
+
+typedef struct BenchClient {
+        NDhcp4ClientConfig *config;
+        NDhcp4CConnection connection;
+        int fd_epoll;
+        struct in_addr addr;
+} BenchClient;
+
+static uint64_t bench_now_ns(void) {
+        struct timespec ts;
+        int r;
+
+        r = clock_gettime(CLOCK_MONOTONIC, &ts);
+        c_assert(r >= 0);
+
+        return ts.tv_sec * UINT64_C(1000000000) + ts.tv_nsec;
+}
+
+static unsigned int bench_count_fds(void) {
+        DIR *dir;
+        struct dirent *de;
+        unsigned int n = 0;
+
+        dir = opendir("/proc/self/fd");
+        c_assert(dir);
+
+        while ((de = readdir(dir)) != NULL) {
+                if (de->d_name[0] != '.')
+                        ++n;
+        }
+
+        closedir(dir);
+        return n;
+}
+
+static void bench_raise_nofile(unsigned int n_clients) {
+        struct rlimit limit;
+        int r;
+
+        r = getrlimit(RLIMIT_NOFILE, &limit);
+        c_assert(r >= 0);
+
+        if (limit.rlim_cur < n_clients * 3 + 64) {
+                limit.rlim_cur = n_clients * 3 + 64;
+                if (limit.rlim_max < limit.rlim_cur)
+                        limit.rlim_max = limit.rlim_cur;
+                r = setrlimit(RLIMIT_NOFILE, &limit);
+                c_assert(r >= 0);
+        }
+}
+
+static void bench_poll_client(BenchClient *client) {
+        struct epoll_event event = {};
+        int r;
+
+        r = epoll_wait(client->fd_epoll, &event, 1, -1);
+        c_assert(r == 1);
+        c_assert(event.events == EPOLLIN);
+        c_assert(event.data.u32 == N_DHCP4_CLIENT_EPOLL_IO);
+}
+
+static void bench_poll_server(NDhcp4SConnection *connection) {
+        struct pollfd pfd = { .events = POLLIN };
+        int r;
+
+        n_dhcp4_s_connection_get_fd(connection, &pfd.fd);
+
+        r = poll(&pfd, 1, -1);
+        c_assert(r == 1);
+        c_assert(pfd.revents == POLLIN);
+}
+
+static void bench_client_receive(BenchClient *client, uint8_t expected_type, NDhcp4Incoming **messagep) {
+        _c_cleanup_(n_dhcp4_incoming_freep) NDhcp4Incoming *message = NULL;
+        uint8_t received_type;
+        int r;
+
+        bench_poll_client(client);
+
+        r = n_dhcp4_c_connection_dispatch_io(&client->connection, &message);
+        c_assert(!r);
+        c_assert(message);
+
+        r = n_dhcp4_incoming_query_message_type(message, &received_type);
+        c_assert(!r);
+        c_assert(received_type == expected_type);
+
+        if (messagep) {
+                *messagep = message;
+                message = NULL;
+        }
+}
+
+static void bench_server_receive(NDhcp4SConnection *connection, uint8_t expected_type, NDhcp4Incoming **messagep) {
+        _c_cleanup_(n_dhcp4_incoming_freep) NDhcp4Incoming *message = NULL;
+        uint8_t received_type;
+        int r;
+
+        bench_poll_server(connection);
+
+        r = n_dhcp4_s_connection_dispatch_io(connection, &message);
+        c_assert(!r);
+        c_assert(message);
+
+        r = n_dhcp4_incoming_query_message_type(message, &received_type);
+        c_assert(!r);
+        c_assert(received_type == expected_type);
+
+        if (messagep) {
+                *messagep = message;
+                message = NULL;
+        }
+}
+
+/* the client index is stored in mac[2..5], so a request received by the
+ * server maps back to the client it came from. */
+static unsigned int bench_client_index(NDhcp4Incoming *request, unsigned int n_clients) {
+        NDhcp4Header *header = n_dhcp4_incoming_get_header(request);
+        unsigned int i;
+
+        c_assert(header->chaddr[0] == 0x02);
+
+        i = ((unsigned int)header->chaddr[2] << 24) |
+            ((unsigned int)header->chaddr[3] << 16) |
+            ((unsigned int)header->chaddr[4] << 8) |
+            (unsigned int)header->chaddr[5];
+        c_assert(i < n_clients);
+
+        return i;
+}
+
+static void bench_client_init(BenchClient *client,
+                              NDhcp4ClientProbeConfig *probe_config,
+                              NDhcp4LogQueue *log_queue,
+                              int netns,
+                              int ifindex,
+                              unsigned int i) {
+        uint8_t mac[ETH_ALEN] = {
+                0x02, 0x00,
+                (i >> 24) & 0xff, (i >> 16) & 0xff, (i >> 8) & 0xff, i & 0xff,
+        };
+        char client_id[32];
+        int r, oldns;
+
+        client->addr = (struct in_addr){ htonl((10 << 24) | (i + 2)) };
+
+        client->fd_epoll = epoll_create1(EPOLL_CLOEXEC);
+        c_assert(client->fd_epoll >= 0);
+
+        r = n_dhcp4_client_config_new(&client->config);
+        c_assert(!r);
+
+        n_dhcp4_client_config_set_ifindex(client->config, ifindex);
+        n_dhcp4_client_config_set_transport(client->config, N_DHCP4_TRANSPORT_ETHERNET);
+        n_dhcp4_client_config_set_request_broadcast(client->config, false);
+        n_dhcp4_client_config_set_mac(client->config, mac, sizeof(mac));
+        n_dhcp4_client_config_set_broadcast_mac(client->config,
+                                                (const uint8_t[]){
+                                                        0xff, 0xff, 0xff,
+                                                        0xff, 0xff, 0xff,
+                                                },
+                                                ETH_ALEN);
+
+        sprintf(client_id, "bench-%u", i);
+        r = n_dhcp4_client_config_set_client_id(client->config, client_id, strlen(client_id));
+        c_assert(!r);
+
+        r = n_dhcp4_c_connection_init(&client->connection,
+                                      client->config,
+                                      probe_config,
+                                      log_queue,
+                                      client->fd_epoll);
+        c_assert(!r);
+
+        netns_get(&oldns);
+        netns_set(netns);
+        r = n_dhcp4_c_connection_listen(&client->connection);
+        c_assert(!r);
+        netns_set(oldns);
+}
+
+static void bench_client_deinit(BenchClient *client) {
+        n_dhcp4_c_connection_deinit(&client->connection);
+        n_dhcp4_client_config_free(client->config);
+        c_close(client->fd_epoll);
+}
+
+static void bench_dora(NDhcp4SConnection *connection_server,
+                       BenchClient *client,
+                       const struct in_addr *addr_server) {
+        _c_cleanup_(n_dhcp4_outgoing_freep) NDhcp4Outgoing *discover = NULL;
+        _c_cleanup_(n_dhcp4_incoming_freep) NDhcp4Incoming *discover_in = NULL;
+        _c_cleanup_(n_dhcp4_outgoing_freep) NDhcp4Outgoing *offer_out = NULL;
+        _c_cleanup_(n_dhcp4_incoming_freep) NDhcp4Incoming *offer = NULL;
+        _c_cleanup_(n_dhcp4_outgoing_freep) NDhcp4Outgoing *select_out = NULL;
+        _c_cleanup_(n_dhcp4_incoming_freep) NDhcp4Incoming *request_in = NULL;
+        _c_cleanup_(n_dhcp4_outgoing_freep) NDhcp4Outgoing *ack_out = NULL;
+        int r;
+
+        r = n_dhcp4_c_connection_discover_new(&client->connection, &discover);
+        c_assert(!r);
+        r = n_dhcp4_c_connection_start_request(&client->connection, discover, 0);
+        c_assert(!r);
+        discover = NULL;
+
+        bench_server_receive(connection_server, N_DHCP4_MESSAGE_DISCOVER, &discover_in);
+
+        r = n_dhcp4_s_connection_offer_new(connection_server, &offer_out, discover_in, addr_server, &client->addr, 60);
+        c_assert(!r);
+        r = n_dhcp4_s_connection_send_reply(connection_server, addr_server, offer_out);
+        c_assert(!r);
+
+        bench_client_receive(client, N_DHCP4_MESSAGE_OFFER, &offer);
+
+        r = n_dhcp4_c_connection_select_new(&client->connection, &select_out, offer);
+        c_assert(!r);
+        r = n_dhcp4_c_connection_start_request(&client->connection, select_out, 0);
+        c_assert(!r);
+        select_out = NULL;
+
+        bench_server_receive(connection_server, N_DHCP4_MESSAGE_REQUEST, &request_in);
+
+        r = n_dhcp4_s_connection_ack_new(connection_server, &ack_out, request_in, addr_server, &client->addr, 60);
+        c_assert(!r);
+        r = n_dhcp4_s_connection_send_reply(connection_server, addr_server, ack_out);
+        c_assert(!r);
+
+        bench_client_receive(client, N_DHCP4_MESSAGE_ACK, NULL);
+}
+
+static void bench_lease_storm(unsigned int n_clients) {
+        const struct in_addr addr_server = (struct in_addr){ htonl(10 << 24 | 1) };
+        _c_cleanup_(netns_closep) int ns_server = -1, ns_client = -1;
+        _c_cleanup_(link_deinit) Link link_server = LINK_NULL(link_server);
+        _c_cleanup_(link_deinit) Link link_client = LINK_NULL(link_client);
+        _c_cleanup_(n_dhcp4_client_probe_config_freep) NDhcp4ClientProbeConfig *probe_config = NULL;
+        NDhcp4SConnection connection_server = N_DHCP4_S_CONNECTION_NULL(connection_server);
+        NDhcp4SConnectionIp connection_server_ip = N_DHCP4_S_CONNECTION_IP_NULL(connection_server_ip);
+        NDhcp4LogQueue log_queue = N_DHCP4_LOG_QUEUE_NULL_DEFUNCT();
+        BenchClient *clients;
+        uint64_t t_start, t_end;
+        unsigned int i;
+        int r, oldns;
+
+        bench_raise_nofile(n_clients);
+
+        netns_new(&ns_server);
+        netns_new(&ns_client);
+
+        link_new_veth(&link_server, &link_client, ns_server, ns_client);
+        link_add_ip4(&link_server, &addr_server, 8);
+
+        netns_get(&oldns);
+        netns_set(ns_server);
+        r = n_dhcp4_s_connection_init(&connection_server, link_server.ifindex);
+        c_assert(!r);
+        netns_set(oldns);
+
+        n_dhcp4_s_connection_ip_init(&connection_server_ip, addr_server);
+        n_dhcp4_s_connection_ip_link(&connection_server_ip, &connection_server);
+
+        r = n_dhcp4_client_probe_config_new(&probe_config);
+        c_assert(!r);
+
+        clients = calloc(n_clients, sizeof(*clients));
+        c_assert(clients);
+
+        t_start = bench_now_ns();
+        for (i = 0; i < n_clients; ++i)
+                bench_client_init(&clients[i], probe_config, &log_queue, ns_client, link_client.ifindex, i);
+        t_end = bench_now_ns();
+
+        fprintf(stderr, "# bench: setup: %u clients in %"PRIu64" ms, %u fds open\n",
+                n_clients, (t_end - t_start) / UINT64_C(1000000), bench_count_fds());
+
+        /* scenario 1: full handshake per client */
+
+        t_start = bench_now_ns();
+        for (i = 0; i < n_clients; ++i)
+                bench_dora(&connection_server, &clients[i], &addr_server);
+        t_end = bench_now_ns();
+
+        fprintf(stderr, "# bench: dora: %u leases in %"PRIu64" ms = %.0f leases/sec\n",
+                n_clients,
+                (t_end - t_start) / UINT64_C(1000000),
+                n_clients * 1e9 / (double)(t_end - t_start));
+
+        /* scenario 2: request burst, then the server drains and acks */
+
+        t_start = bench_now_ns();
+
+        for (i = 0; i < n_clients; ++i) {
+                _c_cleanup_(n_dhcp4_outgoing_freep) NDhcp4Outgoing *request = NULL;
+
+                r = n_dhcp4_c_connection_reboot_new(&clients[i].connection, &request, &addr_server);
+                c_assert(!r);
+                r = n_dhcp4_c_connection_start_request(&clients[i].connection, request, 0);
+                c_assert(!r);
+                request = NULL;
+        }
+
+        for (i = 0; i < n_clients; ++i) {
+                _c_cleanup_(n_dhcp4_incoming_freep) NDhcp4Incoming *request_in = NULL;
+                _c_cleanup_(n_dhcp4_outgoing_freep) NDhcp4Outgoing *ack_out = NULL;
+                BenchClient *client;
+
+                bench_server_receive(&connection_server, N_DHCP4_MESSAGE_REQUEST, &request_in);
+                client = &clients[bench_client_index(request_in, n_clients)];
+
+                r = n_dhcp4_s_connection_ack_new(&connection_server, &ack_out, request_in, &addr_server, &client->addr, 60);
+                c_assert(!r);
+                r = n_dhcp4_s_connection_send_reply(&connection_server, &addr_server, ack_out);
+                c_assert(!r);
+        }
+
+        for (i = 0; i < n_clients; ++i)
+                bench_client_receive(&clients[i], N_DHCP4_MESSAGE_ACK, NULL);
+
+        t_end = bench_now_ns();
+
+        fprintf(stderr, "# bench: storm: %u renewals in %"PRIu64" ms = %.0f acks/sec\n",
+                n_clients,
+                (t_end - t_start) / UINT64_C(1000000),
+                n_clients * 1e9 / (double)(t_end - t_start));
+
+        for (i = 0; i < n_clients; ++i)
+                bench_client_deinit(&clients[i]);
+        free(clients);
+
+        n_dhcp4_s_connection_ip_unlink(&connection_server_ip);
+        n_dhcp4_s_connection_ip_deinit(&connection_server_ip);
+        n_dhcp4_s_connection_deinit(&connection_server);
+
+        link_del_ip4(&link_server, &addr_server, 8);
+}
+
+int main(int argc, char **argv) {
+        unsigned int n_clients = BENCH_N_CLIENTS_DEFAULT;
+
+        if (argc > 1)
+                n_clients = strtoul(argv[1], NULL, 0);
+        c_assert(n_clients > 0);
+
+        test_setup();
+
+        bench_lease_storm(n_clients);
+
+        return 0;
+}
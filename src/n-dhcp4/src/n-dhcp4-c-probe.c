@@ -920,6 +920,46 @@ static int n_dhcp4_client_probe_transition_offer(NDhcp4ClientProbe *probe, NDhcp
         return 0;
 }
 
+static uint64_t n_dhcp4_client_probe_config_get_random_u64(NDhcp4ClientProbeConfig *config) {
+        uint64_t hi = n_dhcp4_client_probe_config_get_random(config);
+
+        return (hi << 32) | n_dhcp4_client_probe_config_get_random(config);
+}
+
+static void n_dhcp4_client_probe_fuzz_lease_timers(NDhcp4ClientProbe *probe, NDhcp4ClientLease *lease) {
+        uint64_t range;
+
+        /*
+         * RFC2131 (4.4.5) recommends choosing T1/T2 with some random fuzz
+         * around the fixed points, so clients that acquired their leases at
+         * the same moment (e.g., after an outage or a fleet-wide restart) do
+         * not renew in lock-step and stampede the server. We pull each timer
+         * earlier by a random amount of up to 1/8th of the interval to the
+         * next deadline, which preserves the ordering T1 < T2 < lifetime and
+         * never exceeds the server-provided times. The timers are nanosecond
+         * timestamps, so the random draw must be 64 bit wide; a 32 bit draw
+         * would cap the spread at ~4.3s regardless of the interval.
+         */
+
+        if (lease->t1 != UINT64_MAX && lease->t2 != UINT64_MAX && lease->t2 > lease->t1) {
+                range = (lease->t2 - lease->t1) / 8;
+                if (range)
+                        lease->t1 -= n_dhcp4_client_probe_config_get_random_u64(probe->config) % range;
+        }
+
+        if (lease->t2 != UINT64_MAX && lease->lifetime != UINT64_MAX && lease->lifetime > lease->t2) {
+                range = (lease->lifetime - lease->t2) / 8;
+                /*
+                 * T2 may sit close to T1 while far from the lifetime; bound
+                 * the fuzz by the gap to T1 so we never move t2 below t1.
+                 */
+                if (lease->t1 != UINT64_MAX && range > lease->t2 - lease->t1)
+                        range = lease->t2 - lease->t1;
+                if (range)
+                        lease->t2 -= n_dhcp4_client_probe_config_get_random_u64(probe->config) % range;
+        }
+}
+
 static int n_dhcp4_client_probe_transition_ack(NDhcp4ClientProbe *probe, NDhcp4Incoming *message_take) {
         _c_cleanup_(n_dhcp4_incoming_freep) NDhcp4Incoming *message = message_take;
         _c_cleanup_(n_dhcp4_client_lease_unrefp) NDhcp4ClientLease *lease = NULL;
@@ -957,6 +997,7 @@ static int n_dhcp4_client_probe_transition_ack(NDhcp4ClientProbe *probe, NDhcp4I
 
                 node->event.extended.lease = n_dhcp4_client_lease_ref(lease);
                 n_dhcp4_client_lease_unref(probe->current_lease);
+                n_dhcp4_client_probe_fuzz_lease_timers(probe, lease);
                 probe->current_lease = n_dhcp4_client_lease_ref(lease);
                 probe->state = N_DHCP4_CLIENT_PROBE_STATE_BOUND;
                 n_dhcp4_client_lease_get_yiaddr(lease, &probe->last_address);
@@ -981,6 +1022,7 @@ static int n_dhcp4_client_probe_transition_ack(NDhcp4ClientProbe *probe, NDhcp4I
                 n_dhcp4_client_lease_link(lease, probe);
 
                 node->event.granted.lease = n_dhcp4_client_lease_ref(lease);
+                n_dhcp4_client_probe_fuzz_lease_timers(probe, lease);
                 probe->current_lease = n_dhcp4_client_lease_ref(lease);
                 probe->state = N_DHCP4_CLIENT_PROBE_STATE_GRANTED;
                 probe->ns_nak_restart_delay = 0;
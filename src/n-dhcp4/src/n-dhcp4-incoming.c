@@ -94,8 +94,10 @@ static void n_dhcp4_incoming_merge(NDhcp4Incoming *incoming, size_t *offset, uin
 }
 
 static void n_dhcp4_incoming_linearize(NDhcp4Incoming *incoming) {
+        size_t sizes[_N_DHCP4_OPTION_N] = {};
+        bool seen[_N_DHCP4_OPTION_N] = {};
         uint8_t *m, o, l, overload;
-        size_t i, pos, end, offset;
+        size_t i, j, pass, pos, end, offset;
 
         /*
          * Linearize all OPTIONs of the incoming message. We know that
@@ -106,8 +108,8 @@ static void n_dhcp4_incoming_linearize(NDhcp4Incoming *incoming) {
          * instances we find.
          *
          * Before we can copy the individual options, we must scan for the
-         * OVERLOAD option. This is required so our prefetcher knows which data
-         * arrays to scan for prefetching.
+         * OVERLOAD option. This is required so we know which data arrays to
+         * scan for options.
          *
          * So far, we require the OVERLOAD option to be present in the
          * options-array (which is obvious and a given). However, if the option
@@ -116,6 +118,13 @@ static void n_dhcp4_incoming_linearize(NDhcp4Incoming *incoming) {
          * multiple OVERLOAD options, anyway. Hence, this behavior only defines
          * what we do when we see broken implementations, and we currently seem
          * to support all styles we saw in the wild so far.
+         *
+         * We walk the sections twice: the first pass accumulates the total
+         * length of each option, so every option can be assigned a contiguous
+         * range of the trailing space up-front. The second pass copies the
+         * individual fragments into place. This keeps the linearization O(n)
+         * in the message size, rather than rescanning all sections once for
+         * each distinct option.
          */
 
         m = (uint8_t *)&incoming->message;
@@ -127,41 +136,65 @@ static void n_dhcp4_incoming_linearize(NDhcp4Incoming *incoming) {
         else
                 overload = 0;
 
-        for (i = 0; i < 3; ++i) {
-                if (i == 0) { /* walk OPTIONS */
-                        pos = offsetof(NDhcp4Message, options);
-                        end = incoming->n_message;
-                } else if (i == 1) { /* walk FILE */
-                        if (!(overload & N_DHCP4_OVERLOAD_FILE))
-                                continue;
-
-                        pos = offsetof(NDhcp4Message, file);
-                        end = pos + sizeof(incoming->message.file);
-                } else { /* walk SNAME */
-                        if (!(overload & N_DHCP4_OVERLOAD_SNAME))
-                                continue;
-
-                        pos = offsetof(NDhcp4Message, sname);
-                        end = pos + sizeof(incoming->message.sname);
+        for (pass = 0; pass < 2; ++pass) {
+                for (i = 0; i < 3; ++i) {
+                        if (i == 0) { /* walk OPTIONS */
+                                pos = offsetof(NDhcp4Message, options);
+                                end = incoming->n_message;
+                        } else if (i == 1) { /* walk FILE */
+                                if (!(overload & N_DHCP4_OVERLOAD_FILE))
+                                        continue;
+
+                                pos = offsetof(NDhcp4Message, file);
+                                end = pos + sizeof(incoming->message.file);
+                        } else { /* walk SNAME */
+                                if (!(overload & N_DHCP4_OVERLOAD_SNAME))
+                                        continue;
+
+                                pos = offsetof(NDhcp4Message, sname);
+                                end = pos + sizeof(incoming->message.sname);
+                        }
+
+                        while (pos < end) {
+                                o = m[pos++];
+                                if (o == N_DHCP4_OPTION_PAD)
+                                        continue;
+                                if (o == N_DHCP4_OPTION_END)
+                                        break;
+                                if (pos >= end)
+                                        break;
+
+                                l = m[pos++];
+                                if (l > end || pos > end - l)
+                                        break;
+
+                                if (pass == 0) {
+                                        /* OVERLOAD was merged above already
+                                         * and is the only option with a
+                                         * value at this point. */
+                                        if (!incoming->options[o].value) {
+                                                seen[o] = true;
+                                                sizes[o] += l;
+                                        }
+                                } else if (seen[o]) {
+                                        memcpy(incoming->options[o].value + incoming->options[o].size,
+                                               m + pos, l);
+                                        incoming->options[o].size += l;
+                                }
+
+                                pos += l;
+                        }
                 }
 
-                while (pos < end) {
-                        o = m[pos++];
-                        if (o == N_DHCP4_OPTION_PAD)
-                                continue;
-                        if (o == N_DHCP4_OPTION_END)
-                                break;
-                        if (pos >= end)
-                                break;
-
-                        l = m[pos++];
-                        if (l > end || pos > end - l)
-                                break;
-
-                        if (!incoming->options[o].value)
-                                n_dhcp4_incoming_merge(incoming, &offset, overload, o);
-
-                        pos += l;
+                if (pass == 0) {
+                        /* assign each option its contiguous slice of the
+                         * trailing space; the copies fill it in pass two. */
+                        for (j = 0; j < _N_DHCP4_OPTION_N; ++j) {
+                                if (seen[j]) {
+                                        incoming->options[j].value = m + offset;
+                                        offset += sizes[j];
+                                }
+                        }
                 }
         }
 }
@@ -776,6 +776,14 @@ constructed(GObject *object)
         curl_multi_setopt(priv->mhandle, CURLMOPT_SOCKETDATA, self);
         curl_multi_setopt(priv->mhandle, CURLMOPT_TIMERFUNCTION, _mhandle_timerfunction_cb);
         curl_multi_setopt(priv->mhandle, CURLMOPT_TIMERDATA, self);
+
+        /* all requests target the one link-local metadata server, and the
+         * providers queue two requests per interface at once. Let curl keep
+         * the parallelism but bound the connection pool, so a many-NIC
+         * instance reuses a handful of kept-alive connections instead of
+         * opening one per request (metadata services throttle aggressively). */
+        curl_multi_setopt(priv->mhandle, CURLMOPT_MAX_TOTAL_CONNECTIONS, 8L);
+        curl_multi_setopt(priv->mhandle, CURLMOPT_MAX_HOST_CONNECTIONS, 8L);
     }
 
     G_OBJECT_CLASS(nm_http_client_parent_class)->constructed(object);
@@ -119,6 +119,12 @@ main(int argc, char **argv)
 {
     nm_auto_free char *cmd = NULL;
 
+    /* One process serves exactly one request and exits. This is intentional:
+     * it guarantees that no NSS module state survives between requests (see
+     * also __nss_configure_lookup(), which cannot be undone within a
+     * process). See the comment at nm_utils_spawn_helper() for why there is
+     * no persistent/pipelined mode. */
+
     cmd = read_arg();
     if (!cmd)
         return RETURN_INVALID_CMD;
@@ -23,7 +23,7 @@
 #include <getopt.h>
 #include <locale.h>
 
-#include "libnm-client-aux-extern/nm-libnm-aux.h"
+#include "nm-dbus-interface.h"
 
 #define PROGRESS_STEPS 15
 
@@ -33,13 +33,21 @@
 #define EXIT_FAILURE_LIBNM_BUG   42
 #define EXIT_FAILURE_UNSPECIFIED 43
 
+/* All we ever look at is the "State" and "Startup" properties of the
+ * manager object and whether the well-known name has an owner. A plain
+ * GDBusProxy gives us exactly that (cached properties plus change
+ * notification), without NMClient's download of every device, connection
+ * and IP configuration object, which on profile-heavy systems costs the
+ * better part of a second during boot. */
+
 typedef struct {
     GMainLoop    *loop;
-    NMClient     *client;
-    GCancellable *client_new_cancellable;
-    guint         client_new_timeout_id;
+    GDBusProxy   *proxy;
+    GCancellable *proxy_new_cancellable;
+    guint         proxy_new_timeout_id;
     guint         handle_timeout_id;
-    gulong        client_notify_id;
+    gulong        proxy_properties_id;
+    gulong        proxy_name_owner_id;
     gboolean      exit_no_nm;
     gboolean      wait_startup;
     gboolean      quiet;
@@ -62,7 +70,8 @@ _return(OnlineData *data, int retval)
     nm_assert(data->retval == EXIT_FAILURE_UNSPECIFIED);
 
     data->retval = retval;
-    nm_clear_g_signal_handler(data->client, &data->client_notify_id);
+    nm_clear_g_signal_handler(data->proxy, &data->proxy_properties_id);
+    nm_clear_g_signal_handler(data->proxy, &data->proxy_name_owner_id);
     g_main_loop_quit(data->loop);
 }
 
@@ -99,19 +108,53 @@ _print_progress(gboolean wait_startup, int progress_next_step_i, gint64 remainin
     fflush(stdout);
 }
 
+static gboolean
+_nm_running(OnlineData *data)
+{
+    gs_free char *owner = NULL;
+
+    owner = g_dbus_proxy_get_name_owner(data->proxy);
+    return !!owner;
+}
+
+static NMState
+_nm_state(OnlineData *data)
+{
+    gs_unref_variant GVariant *value = NULL;
+
+    value = g_dbus_proxy_get_cached_property(data->proxy, "State");
+    if (!value || !g_variant_is_of_type(value, G_VARIANT_TYPE_UINT32))
+        return NM_STATE_UNKNOWN;
+    return g_variant_get_uint32(value);
+}
+
+static gboolean
+_nm_startup(OnlineData *data)
+{
+    gs_unref_variant GVariant *value = NULL;
+
+    value = g_dbus_proxy_get_cached_property(data->proxy, "Startup");
+    if (!value || !g_variant_is_of_type(value, G_VARIANT_TYPE_BOOLEAN)) {
+        /* the name has an owner but the property is not (yet) known.
+         * Treat startup as still pending until we see it FALSE. */
+        return TRUE;
+    }
+    return g_variant_get_boolean(value);
+}
+
 static gboolean
 quit_if_connected(OnlineData *data)
 {
     NMState state;
 
-    state = nm_client_get_state(data->client);
-    if (!nm_client_get_nm_running(data->client)) {
+    state = _nm_state(data);
+    if (!_nm_running(data)) {
         if (data->exit_no_nm) {
             _return(data, EXIT_FAILURE_OFFLINE);
             return TRUE;
         }
     } else if (data->wait_startup) {
-        if (!nm_client_get_startup(data->client)) {
+        if (!_nm_startup(data)) {
             _return(data, EXIT_SUCCESS);
             return TRUE;
         }
@@ -131,11 +174,30 @@ quit_if_connected(OnlineData *data)
 }
 
 static void
-client_properties_changed(GObject *object, GParamSpec *pspec, gpointer user_data)
+proxy_properties_changed(GDBusProxy *proxy,
+                         GVariant   *changed_properties,
+                         char      **invalidated_properties,
+                         gpointer    user_data)
 {
     quit_if_connected(user_data);
 }
 
+static void
+proxy_name_owner_changed(GObject *object, GParamSpec *pspec, gpointer user_data)
+{
+    OnlineData   *data  = user_data;
+    gs_free char *owner = NULL;
+
+    /* when a new owner appears, GDBusProxy first emits this notification
+     * and loads the properties of the new owner afterwards. Hold off
+     * evaluating until g-properties-changed, so we don't judge a running
+     * daemon by an empty property cache. Only the owner-lost case is
+     * meaningful here. */
+    owner = g_dbus_proxy_get_name_owner(data->proxy);
+    if (!owner)
+        quit_if_connected(data);
+}
+
 static gboolean
 handle_timeout(gpointer user_data)
 {
@@ -180,34 +242,32 @@ handle_timeout(gpointer user_data)
 }
 
 static gboolean
-got_client_timeout(gpointer user_data)
+got_proxy_timeout(gpointer user_data)
 {
     OnlineData *data = user_data;
 
-    data->client_new_timeout_id = 0;
-    data->quiet                 = TRUE;
-    g_printerr(_("Error: timeout creating NMClient object\n"));
+    data->proxy_new_timeout_id = 0;
+    data->quiet                = TRUE;
+    g_printerr(_("Error: timeout creating D-Bus proxy\n"));
     _return(data, EXIT_FAILURE_LIBNM_BUG);
     return G_SOURCE_REMOVE;
 }
 
 static void
-got_client(GObject *source_object, GAsyncResult *res, gpointer user_data)
+got_proxy(GObject *source_object, GAsyncResult *res, gpointer user_data)
 {
     OnlineData           *data  = user_data;
     gs_free_error GError *error = NULL;
 
-    nm_assert(NM_IS_CLIENT(source_object));
-    nm_assert(NM_CLIENT(source_object) == data->client);
-
-    nm_clear_g_source(&data->client_new_timeout_id);
-    g_clear_object(&data->client_new_cancellable);
+    nm_clear_g_source(&data->proxy_new_timeout_id);
+    g_clear_object(&data->proxy_new_cancellable);
 
-    if (!g_async_initable_init_finish(G_ASYNC_INITABLE(source_object), res, &error)) {
+    data->proxy = g_dbus_proxy_new_for_bus_finish(res, &error);
+    if (!data->proxy) {
         if (g_error_matches(error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
             return;
         data->quiet = TRUE;
-        g_printerr(_("Error: Could not create NMClient object: %s\n"), error->message);
+        g_printerr(_("Error: Could not create D-Bus proxy: %s\n"), error->message);
         _return(data, EXIT_FAILURE_ERROR);
         return;
     }
@@ -215,8 +275,14 @@ got_client(GObject *source_object, GAsyncResult *res, gpointer user_data)
     if (quit_if_connected(data))
         return;
 
-    data->client_notify_id =
-        g_signal_connect(data->client, "notify", G_CALLBACK(client_properties_changed), data);
+    data->proxy_properties_id  = g_signal_connect(data->proxy,
+                                                 "g-properties-changed",
+                                                 G_CALLBACK(proxy_properties_changed),
+                                                 data);
+    data->proxy_name_owner_id  = g_signal_connect(data->proxy,
+                                                 "notify::g-name-owner",
+                                                 G_CALLBACK(proxy_name_owner_changed),
+                                                 data);
     data->handle_timeout_id =
         g_timeout_add(data->quiet ? NM_MAX(0, data->end_timestamp_ms - _now_ms()) : 0,
                       handle_timeout,
@@ -307,24 +373,28 @@ main(int argc, char *argv[])
         1,
         (data.end_timestamp_ms - data.start_timestamp_ms + PROGRESS_STEPS / 2) / PROGRESS_STEPS);
 
-    data.client_new_cancellable = g_cancellable_new();
+    data.proxy_new_cancellable = g_cancellable_new();
 
-    data.client_new_timeout_id = g_timeout_add_seconds(30, got_client_timeout, &data);
+    data.proxy_new_timeout_id = g_timeout_add_seconds(30, got_proxy_timeout, &data);
 
-    data.client = nmc_client_new_async(data.client_new_cancellable,
-                                       got_client,
-                                       &data,
-                                       NM_CLIENT_INSTANCE_FLAGS,
-                                       (guint) NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_PERMISSIONS,
-                                       NULL);
+    g_dbus_proxy_new_for_bus(G_BUS_TYPE_SYSTEM,
+                             G_DBUS_PROXY_FLAGS_DO_NOT_AUTO_START,
+                             NULL,
+                             NM_DBUS_SERVICE,
+                             NM_DBUS_PATH,
+                             NM_DBUS_INTERFACE,
+                             data.proxy_new_cancellable,
+                             got_proxy,
+                             &data);
 
     g_main_loop_run(data.loop);
 
-    nm_clear_g_cancellable(&data.client_new_cancellable);
-    nm_clear_g_source(&data.client_new_timeout_id);
+    nm_clear_g_cancellable(&data.proxy_new_cancellable);
+    nm_clear_g_source(&data.proxy_new_timeout_id);
     nm_clear_g_source(&data.handle_timeout_id);
-    nm_clear_g_signal_handler(data.client, &data.client_notify_id);
-    g_clear_object(&data.client);
+    nm_clear_g_signal_handler(data.proxy, &data.proxy_properties_id);
+    nm_clear_g_signal_handler(data.proxy, &data.proxy_name_owner_id);
+    g_clear_object(&data.proxy);
 
     nm_clear_pointer(&data.loop, g_main_loop_unref);
 
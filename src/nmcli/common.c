@@ -1226,6 +1226,44 @@ typedef struct {
 static void
 call_cmd(NmCli *nmc, GTask *task, const NMCCommand *cmd, int argc, const char *const *argv);
 
+static void got_client(GObject *source_object, GAsyncResult *res, gpointer user_data);
+
+static void
+got_connections_settings(GObject *source_object, GAsyncResult *res, gpointer user_data)
+{
+    gs_unref_object GTask *task  = NULL;
+    gs_free_error GError  *error = NULL;
+    CmdCall               *call  = user_data;
+    NmCli                 *nmc;
+
+    task = g_steal_pointer(&call->task);
+    nmc  = g_task_get_task_data(task);
+
+    nmc->should_wait--;
+
+    if (!nm_client_load_connections_settings_finish(NM_CLIENT(source_object), res, &error)) {
+        /* Presumably the daemon is older and does not implement
+         * GetConnectionsSettings(). Create the client anew, fetching the
+         * settings the traditional way with one GetSettings() call per
+         * profile. */
+        g_clear_object(&nmc->client);
+        call->task = g_steal_pointer(&task);
+        nmc->should_wait++;
+        nmc_client_new_async(NULL,
+                             got_client,
+                             call,
+                             NM_CLIENT_INSTANCE_FLAGS,
+                             (guint) NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_PERMISSIONS,
+                             NULL);
+        return;
+    }
+
+    call_cmd(nmc, g_steal_pointer(&task), call->cmd, call->argc, (const char *const *) call->argv);
+
+    g_strfreev(call->argv);
+    nm_g_slice_free(call);
+}
+
 static void
 got_client(GObject *source_object, GAsyncResult *res, gpointer user_data)
 {
@@ -1251,6 +1289,31 @@ got_client(GObject *source_object, GAsyncResult *res, gpointer user_data)
     } else {
         nmc->client = NM_CLIENT(source_object);
         nmc_warn_if_version_mismatch(nmc->client);
+
+        if (NM_FLAGS_HAS(nm_client_get_instance_flags(nmc->client),
+                         NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_SETTINGS)) {
+            const GPtrArray *connections = nm_client_get_connections(nmc->client);
+
+            if (connections->len > 0) {
+                gs_free const char **paths = NULL;
+                guint                i;
+
+                paths = g_new(const char *, connections->len + 1u);
+                for (i = 0; i < connections->len; i++)
+                    paths[i] = nm_object_get_path(connections->pdata[i]);
+                paths[i] = NULL;
+
+                call->task = g_steal_pointer(&task);
+                nmc->should_wait++;
+                nm_client_load_connections_settings(nmc->client,
+                                                    paths,
+                                                    NULL,
+                                                    got_connections_settings,
+                                                    call);
+                return;
+            }
+        }
+
         call_cmd(nmc,
                  g_steal_pointer(&task),
                  call->cmd,
@@ -1436,11 +1499,16 @@ call_cmd(NmCli *nmc, GTask *task, const NMCCommand *cmd, int argc, const char *c
             .argv = nm_strv_dup(argv, argc, TRUE),
             .task = task,
         };
+        /* Don't fetch the profiles' settings with one GetSettings() call per
+         * profile during initialization. got_client() hydrates them all with a
+         * single bulk call instead, which on profile-heavy hosts saves
+         * thousands of D-Bus messages before the first line of output. */
         nmc_client_new_async(NULL,
                              got_client,
                              call,
                              NM_CLIENT_INSTANCE_FLAGS,
-                             (guint) NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_PERMISSIONS,
+                             (guint) (NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_PERMISSIONS
+                                      | NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_SETTINGS),
                              NULL);
     }
 }
@@ -1521,7 +1521,7 @@ print_bond_bridge_info(NMDevice   *device,
     set_val_str(arr, 1, g_string_free(ports_str, FALSE));
     g_ptr_array_add(out.output_data, arr);
 
-    print_data_prepare_width(out.output_data);
+    print_data_prepare_width(&nmc->nmc_config, out.output_data);
     print_data(&nmc->nmc_config, &nmc->pager_data, out_indices, NULL, 0, &out);
 
     return TRUE;
@@ -1585,7 +1585,7 @@ print_team_info(NMDevice *device, NmCli *nmc, const char *group_prefix, const ch
     set_val_str(arr, 2, sanitize_team_config(nm_device_team_get_config(NM_DEVICE_TEAM(device))));
     g_ptr_array_add(out.output_data, arr);
 
-    print_data_prepare_width(out.output_data);
+    print_data_prepare_width(&nmc->nmc_config, out.output_data);
     print_data(&nmc->nmc_config, &nmc->pager_data, out_indices, NULL, 0, &out);
 
     return TRUE;
@@ -1778,7 +1778,7 @@ show_device_info(NMDevice *device, NmCli *nmc)
                     g_ptr_array_foreach(aps, fill_output_access_point_void, (gpointer) &info);
                 }
 
-                print_data_prepare_width(out.output_data);
+                print_data_prepare_width(&nmc->nmc_config, out.output_data);
                 print_data(&nmc->nmc_config, &nmc->pager_data, out_indices, NULL, 0, &out);
                 was_output = TRUE;
             }
@@ -1884,7 +1884,7 @@ show_device_info(NMDevice *device, NmCli *nmc)
                 set_val_str(arr, 2, vlan_id_str);
                 g_ptr_array_add(out.output_data, arr);
 
-                print_data_prepare_width(out.output_data);
+                print_data_prepare_width(&nmc->nmc_config, out.output_data);
                 print_data(&nmc->nmc_config, &nmc->pager_data, out_indices, NULL, 0, &out);
 
                 was_output = TRUE;
@@ -1909,7 +1909,7 @@ show_device_info(NMDevice *device, NmCli *nmc)
                     bluetooth_caps_to_string(nm_device_bt_get_capabilities(NM_DEVICE_BT(device))));
                 g_ptr_array_add(out.output_data, arr);
 
-                print_data_prepare_width(out.output_data);
+                print_data_prepare_width(&nmc->nmc_config, out.output_data);
                 print_data(&nmc->nmc_config, &nmc->pager_data, out_indices, NULL, 0, &out);
                 was_output = TRUE;
             }
@@ -3107,7 +3107,7 @@ show_access_point_info(NMDeviceWifi *wifi, NmCli *nmc, NmcOutputData *out)
         g_ptr_array_foreach(aps, fill_output_access_point_void, (gpointer) &info);
     }
 
-    print_data_prepare_width(out->output_data);
+    print_data_prepare_width(&nmc->nmc_config, out->output_data);
 }
 
 static void
@@ -3163,7 +3163,7 @@ wifi_print_aps(NMDeviceWifi                    *wifi,
 
             fill_output_access_point(ap, &info);
 
-            print_data_prepare_width(out.output_data);
+            print_data_prepare_width(&nmc->nmc_config, out.output_data);
             print_data(&nmc->nmc_config, &nmc->pager_data, out_indices, header_name, 0, &out);
 
             *bssid_found = TRUE;
@@ -4976,7 +4976,7 @@ show_device_lldp_list(NMDevice *device, NmCli *nmc, const char *fields_str, int
         g_ptr_array_add(out.output_data, arr);
     }
 
-    print_data_prepare_width(out.output_data);
+    print_data_prepare_width(&nmc->nmc_config, out.output_data);
     print_data(&nmc->nmc_config, &nmc->pager_data, out_indices, header_name, 0, &out);
 
     return neighbors->len;
@@ -720,6 +720,77 @@ set_colors(NmcColorOption   color_option,
 
 /*************************************************************************************/
 
+static gboolean process_command_line(NmCli *nmc, int argc, char **argv_orig);
+
+/* Whether we are executing commands read from standard input ('--batch'). */
+static gboolean nmcli_in_batch = FALSE;
+
+static gboolean
+run_batch(NmCli *nmc)
+{
+    NmcConfig          config_backup          = nmc->nmc_config;
+    gs_free char      *required_fields_backup = g_strdup(nmc->required_fields);
+    gboolean           mode_specified_backup  = nmc->mode_specified;
+    NMCResultCode      batch_result           = NMC_RESULT_SUCCESS;
+    nm_auto_free char *line                   = NULL;
+    size_t             line_alloc             = 0;
+    ssize_t            len;
+
+    nmcli_in_batch = TRUE;
+
+    while ((len = getline(&line, &line_alloc, stdin)) != -1) {
+        gs_strfreev char    **argv_line = NULL;
+        gs_free const char  **argv_cmd  = NULL;
+        gs_free_error GError *error     = NULL;
+        int                   argc_line = 0;
+        char                 *l;
+        int                   i;
+
+        l = nm_strstrip(line);
+        if (l[0] == '\0' || l[0] == '#')
+            continue;
+
+        if (!g_shell_parse_argv(l, &argc_line, &argv_line, &error)) {
+            nmc_printerr(_("Error: %s\n"), error->message);
+            batch_result = NMC_RESULT_ERROR_USER_INPUT;
+            continue;
+        }
+
+        /* Reset the state that the previous command's option parsing may have
+         * changed. The NMClient and its object cache are deliberately kept, so
+         * that one initialization is amortized over all commands. */
+        nmc->return_value = NMC_RESULT_SUCCESS;
+        g_string_assign(nmc->return_text, _("Success"));
+        nmc->nmc_config_mutable = config_backup;
+        nmc->mode_specified     = mode_specified_backup;
+        nm_clear_g_free(&nmc->required_fields);
+        nmc->required_fields = g_strdup(required_fields_backup);
+
+        argv_cmd    = g_new(const char *, ((gsize) argc_line) + 2u);
+        argv_cmd[0] = "nmcli";
+        for (i = 0; i < argc_line; i++)
+            argv_cmd[i + 1] = argv_line[i];
+        argv_cmd[argc_line + 1] = NULL;
+
+        if (process_command_line(nmc, argc_line + 1, (char **) argv_cmd))
+            g_main_loop_run(loop);
+
+        if (nmc->return_value != NMC_RESULT_SUCCESS) {
+            nmc_printerr("%s\n", nmc->return_text->str);
+            batch_result = nmc->return_value;
+        }
+    }
+
+    nmc->return_value = batch_result;
+    if (batch_result != NMC_RESULT_SUCCESS)
+        g_string_printf(nmc->return_text, _("Error: one or more batch commands failed."));
+    else
+        g_string_assign(nmc->return_text, _("Success"));
+
+    /* All commands already ran, the caller must not iterate the main loop again. */
+    return FALSE;
+}
+
 static gboolean
 process_command_line(NmCli *nmc, int argc, char **argv_orig)
 {
@@ -734,6 +805,7 @@ process_command_line(NmCli *nmc, int argc, char **argv_orig)
         {NULL, nmc_command_func_overview, usage, TRUE, TRUE},
     };
     NmcColorOption     colors = NMC_USE_COLOR_AUTO;
+    gboolean           batch  = FALSE;
     const char        *base;
     const char *const *argv;
 
@@ -765,6 +837,7 @@ process_command_line(NmCli *nmc, int argc, char **argv_orig)
             nmc_complete_strings(argv[0],
                                  "--overview",
                                  "--offline",
+                                 "--batch",
                                  "--terse",
                                  "--pretty",
                                  "--mode",
@@ -788,6 +861,14 @@ process_command_line(NmCli *nmc, int argc, char **argv_orig)
             nmc->nmc_config_mutable.overview = TRUE;
         } else if (matches_arg(nmc, &argc, &argv, "-offline", NULL)) {
             nmc->nmc_config_mutable.offline = TRUE;
+        } else if (matches_arg(nmc, &argc, &argv, "-batch", NULL)) {
+            if (nmcli_in_batch) {
+                g_string_printf(nmc->return_text,
+                                _("Error: Option '--batch' cannot be used in batch mode."));
+                nmc->return_value = NMC_RESULT_ERROR_USER_INPUT;
+                return FALSE;
+            }
+            batch = TRUE;
         } else if (matches_arg(nmc, &argc, &argv, "-terse", NULL)) {
             if (nmc->nmc_config.print_output == NMC_PRINT_TERSE) {
                 g_string_printf(nmc->return_text,
@@ -919,6 +1000,17 @@ process_command_line(NmCli *nmc, int argc, char **argv_orig)
                &nmc->palette_buffer,
                &nmc->nmc_config_mutable.palette);
 
+    if (batch) {
+        if (argc > 0) {
+            g_string_printf(nmc->return_text,
+                            _("Error: Option '--batch' takes no further arguments, the "
+                              "commands are read from standard input."));
+            nmc->return_value = NMC_RESULT_ERROR_USER_INPUT;
+            return FALSE;
+        }
+        return run_batch(nmc);
+    }
+
     /* Now run the requested command */
     nmc_do_cmd(nmc, nmcli_cmds, *argv, argc, argv);
 
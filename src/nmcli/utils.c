@@ -1147,36 +1147,41 @@ _print_fill(const NmcConfig    *nmc_config,
         }
     }
 
-    for (i_col = 0; i_col < header_row->len; i_col++) {
-        PrintDataHeaderCell *header_cell =
-            &nm_g_array_index(header_row, PrintDataHeaderCell, i_col);
+    /* The column widths only align the tabular output of the normal and pretty
+     * modes. Terse and multiline modes print unaligned, don't measure the
+     * screen width of every cell for them. */
+    if (!nmc_config->multiline_output && nmc_config->print_output != NMC_PRINT_TERSE) {
+        for (i_col = 0; i_col < header_row->len; i_col++) {
+            PrintDataHeaderCell *header_cell =
+                &nm_g_array_index(header_row, PrintDataHeaderCell, i_col);
 
-        header_cell->width = nmc_string_screen_width(header_cell->title, NULL);
+            header_cell->width = nmc_string_screen_width(header_cell->title, NULL);
 
-        for (i_row = 0; i_row < targets_len; i_row++) {
-            const PrintDataCell *cells_line =
-                &nm_g_array_index(cells, PrintDataCell, i_row * header_row->len);
-            const PrintDataCell *cell = &cells_line[i_col];
-            const char *const   *i_strv;
+            for (i_row = 0; i_row < targets_len; i_row++) {
+                const PrintDataCell *cells_line =
+                    &nm_g_array_index(cells, PrintDataCell, i_row * header_row->len);
+                const PrintDataCell *cell = &cells_line[i_col];
+                const char *const   *i_strv;
 
-            switch (cell->text_format) {
-            case PRINT_DATA_CELL_FORMAT_TYPE_PLAIN:
-                header_cell->width =
-                    NM_MAX(header_cell->width, nmc_string_screen_width(cell->text.plain, NULL));
-                break;
-            case PRINT_DATA_CELL_FORMAT_TYPE_STRV:
-                i_strv = cell->text.strv;
-                if (i_strv) {
-                    for (; *i_strv; i_strv++) {
-                        header_cell->width =
-                            NM_MAX(header_cell->width, nmc_string_screen_width(*i_strv, NULL));
+                switch (cell->text_format) {
+                case PRINT_DATA_CELL_FORMAT_TYPE_PLAIN:
+                    header_cell->width =
+                        NM_MAX(header_cell->width, nmc_string_screen_width(cell->text.plain, NULL));
+                    break;
+                case PRINT_DATA_CELL_FORMAT_TYPE_STRV:
+                    i_strv = cell->text.strv;
+                    if (i_strv) {
+                        for (; *i_strv; i_strv++) {
+                            header_cell->width =
+                                NM_MAX(header_cell->width, nmc_string_screen_width(*i_strv, NULL));
+                        }
                     }
+                    break;
                 }
-                break;
             }
-        }
 
-        header_cell->width += 1;
+            header_cell->width += 1;
+        }
     }
 
     *out_header_row = header_row;
@@ -1229,10 +1234,16 @@ _print_do(const NmcConfig           *nmc_config,
     int                           width1, width2;
     int                           table_width = 0;
     guint                         i_row, i_col;
+    gsize                         row_start;
     nm_auto_free_gstring GString *str = NULL;
 
     g_return_if_fail(col_len);
 
+    /* The entire table is accumulated in one buffer and written out with a
+     * single call at the end. For tables with thousands of rows this avoids
+     * one write per line when stdout is a terminal or unbuffered. */
+    str = g_string_sized_new(NM_MAX(100u, ((gsize) row_len) * 32u));
+
     /* Main header */
     if (nmc_config->print_output == NMC_PRINT_PRETTY && header_name_no_l10n) {
         gs_free char *line = NULL;
@@ -1251,16 +1262,18 @@ _print_do(const NmcConfig           *nmc_config,
 
         width1 = strlen(header_name);
         width2 = nmc_string_screen_width(header_name, NULL);
-        nmc_print("%s\n", line);
-        nmc_print("%*s\n", (table_width + width2) / 2 + width1 - width2, header_name);
-        nmc_print("%s\n", line);
+        g_string_append_printf(str, "%s\n", line);
+        g_string_append_printf(str,
+                               "%*s\n",
+                               (table_width + width2) / 2 + width1 - width2,
+                               header_name);
+        g_string_append_printf(str, "%s\n", line);
     }
 
-    str = !nmc_config->multiline_output ? g_string_sized_new(100) : NULL;
-
     /* print the header for the tabular form */
     if (NM_IN_SET(nmc_config->print_output, NMC_PRINT_NORMAL, NMC_PRINT_PRETTY)
         && !nmc_config->multiline_output) {
+        row_start = str->len;
         for (i_col = 0; i_col < col_len; i_col++) {
             const PrintDataHeaderCell *header_cell = &header_row[i_col];
             const char                *title;
@@ -1281,22 +1294,23 @@ _print_do(const NmcConfig           *nmc_config,
             table_width += header_cell->width + width1 - width2 + 1;
         }
 
-        if (str->len)
+        if (str->len > row_start)
             g_string_truncate(str, str->len - 1); /* Chop off last column separator */
-        nmc_print("%s\n", str->str);
-        g_string_truncate(str, 0);
+        g_string_append_c(str, '\n');
 
         /* Print horizontal separator */
         if (nmc_config->print_output == NMC_PRINT_PRETTY) {
             gs_free char *line = NULL;
 
-            nmc_print("%s\n", (line = g_strnfill(table_width, '-')));
+            g_string_append_printf(str, "%s\n", (line = g_strnfill(table_width, '-')));
         }
     }
 
     for (i_row = 0; i_row < row_len; i_row++) {
         const PrintDataCell *current_line = &cells[i_row * col_len];
 
+        row_start = str->len;
+
         for (i_col = 0; i_col < col_len; i_col++) {
             const PrintDataCell *cell  = &current_line[i_col];
             const char *const   *lines = NULL;
@@ -1332,14 +1346,14 @@ _print_do(const NmcConfig           *nmc_config,
                         prefix = g_strdup_printf("%s:", cell->header_cell->title);
                     width1 = strlen(prefix);
                     width2 = nmc_string_screen_width(prefix, NULL);
-                    nmc_print("%-*s%s\n",
-                              (int) (nmc_config->print_output == NMC_PRINT_TERSE
-                                         ? 0
-                                         : ML_VALUE_INDENT + width1 - width2),
-                              prefix,
-                              text);
+                    g_string_append_printf(str,
+                                           "%-*s%s\n",
+                                           (int) (nmc_config->print_output == NMC_PRINT_TERSE
+                                                      ? 0
+                                                      : ML_VALUE_INDENT + width1 - width2),
+                                           prefix,
+                                           text);
                 } else {
-                    nm_assert(str);
                     if (nmc_config->print_output == NMC_PRINT_TERSE) {
                         if (nmc_config->escape_values) {
                             const char *p = text;
@@ -1371,19 +1385,20 @@ _print_do(const NmcConfig           *nmc_config,
         }
 
         if (!nmc_config->multiline_output) {
-            if (str->len)
+            if (str->len > row_start)
                 g_string_truncate(str, str->len - 1); /* Chop off last column separator */
-            nmc_print("%s\n", str->str);
-
-            g_string_truncate(str, 0);
+            g_string_append_c(str, '\n');
         }
 
         if (nmc_config->print_output == NMC_PRINT_PRETTY && nmc_config->multiline_output) {
             gs_free char *line = NULL;
 
-            nmc_print("%s\n", (line = g_strnfill(ML_HEADER_WIDTH, '-')));
+            g_string_append_printf(str, "%s\n", (line = g_strnfill(ML_HEADER_WIDTH, '-')));
         }
     }
+
+    if (str->len > 0)
+        nmc_print("%s", str->str);
 }
 
 gboolean
@@ -1762,7 +1777,7 @@ print_required_fields(const NmcConfig      *nmc_config,
 }
 
 void
-print_data_prepare_width(GPtrArray *output_data)
+print_data_prepare_width(const NmcConfig *nmc_config, GPtrArray *output_data)
 {
     int             i, j;
     size_t          len;
@@ -1772,6 +1787,12 @@ print_data_prepare_width(GPtrArray *output_data)
     if (!output_data || output_data->len < 1)
         return;
 
+    /* The widths only align the tabular output of the normal and pretty modes.
+     * Rendering every value just to measure it is not cheap, skip it when the
+     * output is unaligned anyway. */
+    if (nmc_config->multiline_output || nmc_config->print_output == NMC_PRINT_TERSE)
+        return;
+
     /* How many fields? */
     row = g_ptr_array_index(output_data, 0);
     while (row->info) {
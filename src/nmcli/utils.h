@@ -64,7 +64,7 @@ void            print_required_fields(const NmcConfig      *nmc_config,
                                       const char           *header_name,
                                       int                   indent,
                                       const NmcOutputField *field_values);
-void            print_data_prepare_width(GPtrArray *output_data);
+void            print_data_prepare_width(const NmcConfig *nmc_config, GPtrArray *output_data);
 void            print_data(const NmcConfig     *nmc_config,
                            NmcPagerData        *pager_data,
                            const GArray        *indices,